@@ -0,0 +1,881 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "bench_crypto_common.h"
+
+/* Buffers shared by the benchmarks, their content does not matter to the
+ * measured algorithms
+ */
+uint8_t       bench_input[ARCH_TEST_BENCH_MAX_SIZE];
+uint8_t       bench_output[ARCH_TEST_BENCH_MAX_SIZE + BENCH_OUTPUT_OVERHEAD];
+const uint8_t bench_nonce[BENCH_NONCE_SIZE] = {
+ 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B};
+uint8_t       bench_reference[BENCH_CHUNK_PAYLOAD + BENCH_OUTPUT_OVERHEAD];
+
+/* Key lifetimes swept by the key management benchmarks */
+static const struct {
+    const char         *name;
+    psa_key_lifetime_t  lifetime;
+} bench_lifetimes[] = {
+    {"volatile",   PSA_KEY_LIFETIME_VOLATILE},
+    {"persistent", PSA_KEY_LIFETIME_PERSISTENT},
+};
+
+/* Buffer layouts swept by the buffer aliasing benchmarks. The first one,
+ * distinct input and output buffers, is the reference of the others.
+ */
+static const struct {
+    const char *name;
+    bool_t      aliased;    /* Input read from bench_output */
+    size_t      offset;     /* Distance of the output after the input */
+} bench_layouts[] = {
+    {"separate", 0, 0},
+    {"in-place", 1, 0},
+    {"overlap",  1, BENCH_ALIAS_OFFSET},
+};
+
+/**
+    @brief    - Sets the attributes of the key of a benchmarked algorithm
+    @param    - val        : VAL APIs
+                alg        : Benchmarked algorithm
+                lifetime   : Key lifetime, persistent keys get the BENCH_KEY_ID
+                             identifier
+                attributes : Key attributes
+    @return   - None
+**/
+static void bench_crypto_key_attributes(val_api_t *val, const bench_crypto_alg_t *alg,
+                                        psa_key_lifetime_t lifetime,
+                                        psa_key_attributes_t *attributes)
+{
+    val->crypto->set_key_type(attributes, alg->key_type);
+    val->crypto->set_key_bits(attributes, alg->key_bits);
+    val->crypto->set_key_usage_flags(attributes, alg->usage);
+    val->crypto->set_key_algorithm(attributes, alg->alg);
+    if (lifetime != PSA_KEY_LIFETIME_VOLATILE)
+    {
+        val->crypto->set_key_id(attributes, BENCH_KEY_ID);
+        val->crypto->set_key_lifetime(attributes, lifetime);
+    }
+}
+
+/**
+    @brief    - Creates the key of a benchmarked algorithm, imported from its
+                key data, or from the key fixture cache of the platform when
+                it has none, so that slow key pairs are generated once only
+    @param    - val      : VAL APIs
+                alg      : Benchmarked algorithm
+                lifetime : Key lifetime, persistent keys get the BENCH_KEY_ID
+                           identifier
+                key      : Created key, 0 for keyless algorithms
+    @return   - PSA status
+**/
+int32_t bench_crypto_create_key(val_api_t *val, const bench_crypto_alg_t *alg,
+                                psa_key_lifetime_t lifetime, psa_key_id_t *key)
+{
+    psa_key_attributes_t  attributes = PSA_KEY_ATTRIBUTES_INIT;
+    int32_t               status;
+
+    *key = 0;
+    if (alg->key_type == PSA_KEY_TYPE_NONE)
+    {
+        return PSA_SUCCESS;
+    }
+
+    bench_crypto_key_attributes(val, alg, lifetime, &attributes);
+    if (alg->key_data != NULL)
+    {
+        status = val->crypto->import_key(&attributes, alg->key_data, alg->key_length, key);
+    }
+    else
+    {
+        status = val->crypto->fixture_key(&attributes, key);
+    }
+    val->crypto->reset_key_attributes(&attributes);
+    return status;
+}
+
+/**
+    @brief    - Generates a random key of the type and size of a benchmarked
+                algorithm, bypassing the key fixture cache
+    @param    - val      : VAL APIs
+                alg      : Benchmarked algorithm
+                lifetime : Key lifetime, persistent keys get the BENCH_KEY_ID
+                           identifier
+                key      : Generated key
+    @return   - PSA status
+**/
+int32_t bench_crypto_generate_key(val_api_t *val, const bench_crypto_alg_t *alg,
+                                  psa_key_lifetime_t lifetime, psa_key_id_t *key)
+{
+    psa_key_attributes_t  attributes = PSA_KEY_ATTRIBUTES_INIT;
+    int32_t               status;
+
+    bench_crypto_key_attributes(val, alg, lifetime, &attributes);
+    status = val->crypto->generate_key(&attributes, key);
+    val->crypto->reset_key_attributes(&attributes);
+    return status;
+}
+
+/**
+    @brief    - Derives a benchmark name from the description of a crypto
+                suite test vector, "Test psa_export_key with EC keypair\n"
+                giving "EC keypair"
+    @param    - desc : Test vector description
+                name : Benchmark name
+                size : Size of the name buffer
+    @return   - None
+**/
+void bench_crypto_key_name(const char *desc, char *name, size_t size)
+{
+    size_t length;
+
+    /* Skip the "Test <api> " prefix, then a "with " or "- " one */
+    if (memcmp(desc, "Test ", 5) == 0)
+    {
+        desc += 5;
+        while ((*desc != '\0') && (*desc != ' '))
+        {
+            desc++;
+        }
+        while (*desc == ' ')
+        {
+            desc++;
+        }
+    }
+    if (memcmp(desc, "with ", 5) == 0)
+    {
+        desc += 5;
+    }
+    else if (memcmp(desc, "- ", 2) == 0)
+    {
+        desc += 2;
+    }
+
+    for (length = 0; (desc[length] != '\0') && (desc[length] != '\n') && ((length + 1) < size);
+         length++)
+    {
+        name[length] = desc[length];
+    }
+    name[length] = '\0';
+}
+
+/**
+    @brief    - Sets up a key derivation with the key of the context as the
+                secret or password, and fixed salt, info, seed and label inputs
+    @param    - val       : VAL APIs
+                ctx       : Context of a HKDF, TLS 1.2 PRF or PBKDF2 algorithm,
+                            the PBKDF2 iteration count being the algorithm
+                            parameter
+                operation : Key derivation operation, set up on success
+    @return   - PSA status
+**/
+int32_t bench_crypto_kdf_setup(val_api_t *val, const bench_crypto_ctx_t *ctx,
+                               psa_key_derivation_operation_t *operation)
+{
+    psa_algorithm_t  alg = ctx->alg->alg;
+    int32_t          status;
+
+    status = val->crypto->key_derivation_setup(operation, alg);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    if (PSA_ALG_IS_HKDF(alg))
+    {
+        status = val->crypto->key_derivation_input_bytes(operation, PSA_KEY_DERIVATION_INPUT_SALT,
+                                                         input_salt, INPUT_SALT_LEN);
+        if (status == PSA_SUCCESS)
+        {
+            status = val->crypto->key_derivation_input_key(operation,
+                                                           PSA_KEY_DERIVATION_INPUT_SECRET,
+                                                           ctx->key);
+        }
+        if (status == PSA_SUCCESS)
+        {
+            status = val->crypto->key_derivation_input_bytes(operation,
+                                                             PSA_KEY_DERIVATION_INPUT_INFO,
+                                                             input_info, INPUT_INFO_LEN);
+        }
+    }
+    else if (PSA_ALG_IS_TLS12_PRF(alg))
+    {
+        status = val->crypto->key_derivation_input_bytes(operation, PSA_KEY_DERIVATION_INPUT_SEED,
+                                                         input_seed, INPUT_SEED_LEN);
+        if (status == PSA_SUCCESS)
+        {
+            status = val->crypto->key_derivation_input_key(operation,
+                                                           PSA_KEY_DERIVATION_INPUT_SECRET,
+                                                           ctx->key);
+        }
+        if (status == PSA_SUCCESS)
+        {
+            status = val->crypto->key_derivation_input_bytes(operation,
+                                                             PSA_KEY_DERIVATION_INPUT_LABEL,
+                                                             input_label, INPUT_LABEL_LEN);
+        }
+    }
+    else
+    {
+        status = val->crypto->key_derivation_input_integer(operation,
+                                                           PSA_KEY_DERIVATION_INPUT_COST,
+                                                           ctx->alg->param);
+        if (status == PSA_SUCCESS)
+        {
+            status = val->crypto->key_derivation_input_bytes(operation,
+                                                             PSA_KEY_DERIVATION_INPUT_SALT,
+                                                             input_salt, INPUT_SALT_LEN);
+        }
+        if (status == PSA_SUCCESS)
+        {
+            status = val->crypto->key_derivation_input_key(operation,
+                                                           PSA_KEY_DERIVATION_INPUT_PASSWORD,
+                                                           ctx->key);
+        }
+    }
+
+    if (status != PSA_SUCCESS)
+    {
+        val->crypto->key_derivation_abort(operation);
+    }
+    return status;
+}
+
+/**
+    @brief    - Prints the check header of a benchmarked algorithm
+    @param    - val   : VAL APIs
+                check : Check number
+                op    : Name of the measured API
+                alg   : Benchmarked algorithm
+    @return   - None
+**/
+static void bench_crypto_print_check(val_api_t *val, uint32_t check, const char *op,
+                                     const bench_crypto_alg_t *alg)
+{
+    val->print(PRINT_TEST, "[Check %d] Benchmark ", check);
+    val->print(PRINT_TEST, op, 0);
+    val->print(PRINT_TEST, " ", 0);
+    val->print(PRINT_TEST, alg->name, 0);
+    val->print(PRINT_TEST, "\n", 0);
+}
+
+/**
+    @brief    - Measures an operation for each algorithm of a list and each
+                benchmarked buffer size, up to the largest size of the
+                algorithm. The algorithms which need a key have it imported
+                or taken from the key fixture cache.
+    @param    - val   : VAL APIs
+                op    : Name of the measured API, e.g. "hash_compute"
+                algs  : Algorithms to be measured
+                count : Number of algorithms
+                fn    : Operation, called with a bench_crypto_ctx_t context
+    @return   - Test status
+**/
+int32_t bench_crypto_sweep(val_api_t *val, const char *op, const bench_crypto_alg_t *algs,
+                           uint32_t count, val_bench_op_t fn)
+{
+    bench_crypto_ctx_t    ctx;
+    val_bench_sample_t    sample;
+    int32_t               status;
+    uint32_t              i;
+    size_t                size, max_size;
+
+    if (count == 0)
+    {
+        val->print(PRINT_TEST, "No benchmark available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto->crypto_init();
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    memset(bench_input, 0xA5, sizeof(bench_input));
+
+    for (i = 0; i < count; i++)
+    {
+        bench_crypto_print_check(val, i + 1, op, &algs[i]);
+
+        memset(&ctx, 0, sizeof(ctx));
+        ctx.alg = &algs[i];
+        status = bench_crypto_create_key(val, &algs[i], PSA_KEY_LIFETIME_VOLATILE, &ctx.key);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        max_size = algs[i].max_size ? algs[i].max_size : ARCH_TEST_BENCH_MAX_SIZE;
+        if (max_size > ARCH_TEST_BENCH_MAX_SIZE)
+        {
+            max_size = ARCH_TEST_BENCH_MAX_SIZE;
+        }
+
+        for (size = BENCH_MIN_SIZE; size <= max_size; size *= BENCH_SIZE_FACTOR)
+        {
+            /* Setting up the watchdog timer for each sample */
+            status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+            TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(3));
+
+            memset(&sample, 0, sizeof(sample));
+            sample.op       = op;
+            sample.alg_name = algs[i].name;
+            sample.alg      = algs[i].alg;
+            sample.key_bits = (uint32_t)algs[i].key_bits;
+            sample.size     = (uint32_t)size;
+            ctx.size        = size;
+
+            status = val->bench_run(&sample, fn, &ctx);
+            if (IS_TEST_SKIP(status))
+            {
+                return status;
+            }
+            TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(4));
+        }
+
+        if (ctx.key != 0)
+        {
+            status = val->crypto->destroy_key(ctx.key);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
+        }
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Measures the operation rate and latency distribution of an
+                operation for each algorithm of a list, each operation being
+                timed on its own
+    @param    - val     : VAL APIs
+                op      : Name of the measured API, e.g. "sign_hash"
+                algs    : Algorithms to be measured
+                count   : Number of algorithms
+                prepare : Sets the input size in the context and prepares the
+                          input of the operation, e.g. a signature to verify
+                fn      : Operation, called with a bench_crypto_ctx_t context
+    @return   - Test status
+**/
+int32_t bench_crypto_latency_sweep(val_api_t *val, const char *op, const bench_crypto_alg_t *algs,
+                                   uint32_t count, val_bench_op_t prepare, val_bench_op_t fn)
+{
+    bench_crypto_ctx_t    ctx;
+    val_bench_sample_t    sample;
+    int32_t               status;
+    uint32_t              i;
+
+    if (count == 0)
+    {
+        val->print(PRINT_TEST, "No benchmark available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto->crypto_init();
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    memset(bench_input, 0xA5, sizeof(bench_input));
+
+    for (i = 0; i < count; i++)
+    {
+        bench_crypto_print_check(val, i + 1, op, &algs[i]);
+
+        memset(&ctx, 0, sizeof(ctx));
+        ctx.alg = &algs[i];
+        status = bench_crypto_create_key(val, &algs[i], PSA_KEY_LIFETIME_VOLATILE, &ctx.key);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        /* Setting up the watchdog timer for each sample */
+        status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+        TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(3));
+
+        status = prepare(&ctx);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
+
+        memset(&sample, 0, sizeof(sample));
+        sample.op       = op;
+        sample.alg_name = algs[i].name;
+        sample.alg      = algs[i].alg;
+        sample.key_bits = (uint32_t)algs[i].key_bits;
+        sample.size     = (uint32_t)ctx.size;
+        sample.latency  = 1;
+
+        status = val->bench_run(&sample, fn, &ctx);
+        if (IS_TEST_SKIP(status))
+        {
+            return status;
+        }
+        TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(5));
+
+        if (ctx.key != 0)
+        {
+            status = val->crypto->destroy_key(ctx.key);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(6));
+        }
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Feeds a fixed payload through a multipart API for each
+                algorithm of a list, in chunks from BENCH_CHUNK_MIN bytes up to
+                the whole payload. The output of each chunk size is checked,
+                then its throughput is measured and compared with the
+                single-shot API, giving the overhead of each update.
+    @param    - val   : VAL APIs
+                algs  : Algorithms to be measured
+                count : Number of algorithms
+                ops   : Single-shot and multipart operations, called with a
+                        bench_crypto_ctx_t context
+    @return   - Test status
+**/
+int32_t bench_crypto_chunk_sweep(val_api_t *val, const bench_crypto_alg_t *algs, uint32_t count,
+                                 const bench_crypto_chunk_ops_t *ops)
+{
+    bench_crypto_ctx_t    ctx;
+    val_bench_sample_t    sample;
+    int32_t               status;
+    uint32_t              i, baseline_ns;
+    size_t                chunk, reference_length;
+
+    if (count == 0)
+    {
+        val->print(PRINT_TEST, "No benchmark available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto->crypto_init();
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    memset(bench_input, 0xA5, sizeof(bench_input));
+
+    for (i = 0; i < count; i++)
+    {
+        bench_crypto_print_check(val, i + 1, ops->multi_op, &algs[i]);
+
+        memset(&ctx, 0, sizeof(ctx));
+        ctx.alg = &algs[i];
+        ctx.size = BENCH_CHUNK_PAYLOAD;
+        status = bench_crypto_create_key(val, &algs[i], PSA_KEY_LIFETIME_VOLATILE, &ctx.key);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        /* Setting up the watchdog timer for the single-shot sample */
+        status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+        TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(3));
+
+        status = ops->single(&ctx);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
+        memcpy(bench_reference, bench_output, ctx.length);
+        reference_length = ctx.length;
+
+        memset(&sample, 0, sizeof(sample));
+        sample.op       = ops->single_op;
+        sample.alg_name = algs[i].name;
+        sample.alg      = algs[i].alg;
+        sample.key_bits = (uint32_t)algs[i].key_bits;
+        sample.size     = BENCH_CHUNK_PAYLOAD;
+
+        status = val->bench_run(&sample, ops->single, &ctx);
+        if (IS_TEST_SKIP(status))
+        {
+            return status;
+        }
+        TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(5));
+        baseline_ns = (sample.ns_per_op != VAL_BENCH_UNKNOWN) ? sample.ns_per_op : 0;
+
+        for (chunk = BENCH_CHUNK_MIN; chunk <= BENCH_CHUNK_PAYLOAD; chunk *= BENCH_SIZE_FACTOR)
+        {
+            /* Setting up the watchdog timer for each sample */
+            status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+            TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(6));
+
+            ctx.chunk = chunk;
+            status = ops->multi(&ctx);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(7));
+
+            if (ops->verify != NULL)
+            {
+                status = ops->verify(&ctx);
+                TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
+            }
+            else
+            {
+                TEST_ASSERT_EQUAL(ctx.length, reference_length, TEST_CHECKPOINT_NUM(9));
+                TEST_ASSERT_MEMCMP(bench_output, bench_reference, reference_length,
+                                   TEST_CHECKPOINT_NUM(10));
+            }
+
+            memset(&sample, 0, sizeof(sample));
+            sample.op          = ops->multi_op;
+            sample.alg_name    = algs[i].name;
+            sample.alg         = algs[i].alg;
+            sample.key_bits    = (uint32_t)algs[i].key_bits;
+            sample.size        = BENCH_CHUNK_PAYLOAD;
+            sample.chunk       = (uint32_t)chunk;
+            sample.baseline_ns = baseline_ns;
+
+            status = val->bench_run(&sample, ops->multi, &ctx);
+            TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(11));
+        }
+
+        if (ctx.key != 0)
+        {
+            status = val->crypto->destroy_key(ctx.key);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(12));
+        }
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Tells if the platform supports persistent keys, by creating and
+                destroying one. A BENCH_KEY_ID key left over by an interrupted
+                run is destroyed first.
+    @param    - val : VAL APIs
+    @return   - TRUE/FALSE
+**/
+bool_t bench_crypto_persistent_keys(val_api_t *val)
+{
+    psa_key_attributes_t  attributes = PSA_KEY_ATTRIBUTES_INIT;
+    psa_key_id_t          key;
+    int32_t               status;
+
+    (void)val->crypto->destroy_key(BENCH_KEY_ID);
+
+    val->crypto->set_key_type(&attributes, PSA_KEY_TYPE_RAW_DATA);
+    val->crypto->set_key_id(&attributes, BENCH_KEY_ID);
+    val->crypto->set_key_lifetime(&attributes, PSA_KEY_LIFETIME_PERSISTENT);
+    status = val->crypto->import_key(&attributes, key_data, AES_16B_KEY_SIZE, &key);
+    val->crypto->reset_key_attributes(&attributes);
+    if (status != PSA_SUCCESS)
+    {
+        return 0;
+    }
+
+    return (val->crypto->destroy_key(key) == PSA_SUCCESS) ? 1 : 0;
+}
+
+/**
+    @brief    - Measures the latency distribution of a key management
+                operation for each key of a list, with volatile then
+                persistent keys. The persistent keys are skipped if the
+                platform does not support them.
+    @param    - val   : VAL APIs
+                op    : Name of the measured API, e.g. "import_key"
+                algs  : Keys to be measured
+                count : Number of keys
+                ops   : Steps of the benchmark
+    @return   - Test status
+**/
+int32_t bench_crypto_key_sweep(val_api_t *val, const char *op, const bench_crypto_alg_t *algs,
+                               uint32_t count, const bench_crypto_key_ops_t *ops)
+{
+    bench_crypto_ctx_t    ctx;
+    val_bench_sample_t    sample;
+    int32_t               status;
+    uint32_t              i, j, lifetimes;
+
+    if (count == 0)
+    {
+        val->print(PRINT_TEST, "No benchmark available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto->crypto_init();
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    lifetimes = sizeof(bench_lifetimes)/sizeof(bench_lifetimes[0]);
+    if (!bench_crypto_persistent_keys(val))
+    {
+        val->print(PRINT_TEST, "No persistent key support, volatile keys only\n", 0);
+        lifetimes = 1;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        bench_crypto_print_check(val, i + 1, op, &algs[i]);
+
+        for (j = 0; j < lifetimes; j++)
+        {
+            /* Setting up the watchdog timer for each sample */
+            status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+            TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+            memset(&ctx, 0, sizeof(ctx));
+            ctx.alg      = &algs[i];
+            ctx.lifetime = bench_lifetimes[j].lifetime;
+            ctx.size     = (algs[i].key_bits + 7) / 8;
+            if (ops->prepare != NULL)
+            {
+                status = ops->prepare(&ctx);
+                TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
+            }
+
+            memset(&sample, 0, sizeof(sample));
+            sample.op       = op;
+            sample.alg_name = algs[i].name;
+            sample.variant  = bench_lifetimes[j].name;
+            sample.alg      = algs[i].alg;
+            sample.key_bits = (uint32_t)algs[i].key_bits;
+            sample.size     = (uint32_t)ctx.size;
+            sample.latency  = 1;
+            sample.setup    = ops->setup;
+            sample.teardown = ops->teardown;
+
+            status = val->bench_run(&sample, ops->fn, &ctx);
+            if (IS_TEST_SKIP(status))
+            {
+                return status;
+            }
+            TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(4));
+
+            if (ctx.key != 0)
+            {
+                status = val->crypto->destroy_key(ctx.key);
+                TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
+            }
+        }
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Measures an operation for each algorithm of a list and each
+                benchmarked buffer size, with separate input and output
+                buffers, then with the output on top of the input and with
+                the output overlapping the input BENCH_ALIAS_OFFSET bytes
+                after it. The aliased throughputs are printed relative to the
+                separate buffer one.
+    @param    - val   : VAL APIs
+                op    : Name of the measured API, e.g. "cipher_encrypt"
+                algs  : Algorithms to be measured
+                count : Number of algorithms
+                fn    : Operation, called with a bench_crypto_ctx_t context
+                        giving its input and output buffers
+    @return   - Test status
+**/
+int32_t bench_crypto_alias_sweep(val_api_t *val, const char *op, const bench_crypto_alg_t *algs,
+                                 uint32_t count, val_bench_op_t fn)
+{
+    bench_crypto_ctx_t    ctx;
+    val_bench_sample_t    sample;
+    int32_t               status;
+    uint32_t              i, j, reference = 0;
+    size_t                size, max_size;
+
+    if (count == 0)
+    {
+        val->print(PRINT_TEST, "No benchmark available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto->crypto_init();
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    memset(bench_input, 0xA5, sizeof(bench_input));
+
+    for (i = 0; i < count; i++)
+    {
+        bench_crypto_print_check(val, i + 1, op, &algs[i]);
+
+        memset(&ctx, 0, sizeof(ctx));
+        ctx.alg = &algs[i];
+        status = bench_crypto_create_key(val, &algs[i], PSA_KEY_LIFETIME_VOLATILE, &ctx.key);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        max_size = algs[i].max_size ? algs[i].max_size : ARCH_TEST_BENCH_MAX_SIZE;
+        if (max_size > ARCH_TEST_BENCH_MAX_SIZE)
+        {
+            max_size = ARCH_TEST_BENCH_MAX_SIZE;
+        }
+
+        for (size = BENCH_MIN_SIZE; size <= max_size; size *= BENCH_SIZE_FACTOR)
+        {
+            for (j = 0; j < sizeof(bench_layouts)/sizeof(bench_layouts[0]); j++)
+            {
+                /* Setting up the watchdog timer for each sample */
+                status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+                TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(3));
+
+                /* The aliased layouts start from the same input, which the
+                 * operations then overwrite from one iteration to the next
+                 */
+                if (bench_layouts[j].aliased)
+                {
+                    memcpy(bench_output, bench_input, size);
+                    ctx.input = bench_output;
+                }
+                else
+                {
+                    ctx.input = bench_input;
+                }
+                ctx.output      = bench_output + bench_layouts[j].offset;
+                ctx.output_size = sizeof(bench_output) - bench_layouts[j].offset;
+                ctx.size        = size;
+
+                memset(&sample, 0, sizeof(sample));
+                sample.op       = op;
+                sample.alg_name = algs[i].name;
+                sample.variant  = bench_layouts[j].name;
+                sample.alg      = algs[i].alg;
+                sample.key_bits = (uint32_t)algs[i].key_bits;
+                sample.size     = (uint32_t)size;
+
+                status = val->bench_run(&sample, fn, &ctx);
+                if (IS_TEST_SKIP(status))
+                {
+                    return status;
+                }
+                TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(4));
+
+                if (j == 0)
+                {
+                    reference = sample.mb_per_s_x100;
+                }
+                else if (reference != 0)
+                {
+                    val->print(PRINT_TEST, "\t", 0);
+                    val->print(PRINT_TEST, bench_layouts[j].name, 0);
+                    val->print(PRINT_TEST, " at %d bytes: ", (int32_t)size);
+                    val->print(PRINT_TEST, "%d percent of the separate buffer throughput\n",
+                               (int32_t)(((uint64_t)sample.mb_per_s_x100 * 100) / reference));
+                }
+            }
+        }
+
+        if (ctx.key != 0)
+        {
+            status = val->crypto->destroy_key(ctx.key);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
+        }
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Checks the result of a timing leakage operation against the
+                input class
+    @param    - input_class : 0 for the valid input, 1 for the altered one
+                status      : PSA status of the operation
+                rejected    : Status expected for the altered input
+    @return   - 0 if the status is the one expected for the class
+**/
+int32_t bench_crypto_leakage_status(uint32_t input_class, psa_status_t status,
+                                    psa_status_t rejected)
+{
+    if (status == ((input_class == 0) ? PSA_SUCCESS : rejected))
+    {
+        return 0;
+    }
+
+    return (status == PSA_SUCCESS) ? VAL_STATUS_DATA_MISMATCH : status;
+}
+
+/**
+    @brief    - Tests whether the duration of an operation depends on the
+                validity of its input, for each algorithm of a list, and
+                fails if any of them leaks
+    @param    - val     : VAL APIs
+                op      : Name of the measured API, e.g. "mac_verify"
+                variant : Alteration of the invalid input, e.g. "first byte"
+                algs    : Algorithms to be measured
+                count   : Number of algorithms
+                prepare : Sets the input size in the context and prepares the
+                          valid and the altered input of the operation
+                fn      : Operation, called with a bench_crypto_ctx_t context
+                          and the input class
+    @return   - Test status
+**/
+int32_t bench_crypto_leakage_sweep(val_api_t *val, const char *op, const char *variant,
+                                   const bench_crypto_alg_t *algs, uint32_t count,
+                                   val_bench_op_t prepare, val_leakage_op_t fn)
+{
+    bench_crypto_ctx_t    ctx;
+    val_leakage_sample_t  sample;
+    int32_t               status;
+    uint32_t              i, leaks = 0;
+
+    if (count == 0)
+    {
+        val->print(PRINT_TEST, "No benchmark available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto->crypto_init();
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    memset(bench_input, 0xA5, sizeof(bench_input));
+
+    for (i = 0; i < count; i++)
+    {
+        val->print(PRINT_TEST, "[Check %d] Timing leakage of ", i + 1);
+        val->print(PRINT_TEST, op, 0);
+        val->print(PRINT_TEST, " ", 0);
+        val->print(PRINT_TEST, algs[i].name, 0);
+        val->print(PRINT_TEST, "\n", 0);
+
+        memset(&ctx, 0, sizeof(ctx));
+        ctx.alg = &algs[i];
+        status = bench_crypto_create_key(val, &algs[i], PSA_KEY_LIFETIME_VOLATILE, &ctx.key);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        /* Setting up the watchdog timer for each sample */
+        status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+        TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(3));
+
+        status = prepare(&ctx);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
+
+        memset(&sample, 0, sizeof(sample));
+        sample.op       = op;
+        sample.alg_name = algs[i].name;
+        sample.variant  = variant;
+        sample.alg      = algs[i].alg;
+        sample.key_bits = (uint32_t)algs[i].key_bits;
+        sample.size     = (uint32_t)ctx.size;
+
+        status = val->leakage_run(&sample, fn, &ctx);
+        if (IS_TEST_SKIP(status))
+        {
+            return status;
+        }
+        TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(5));
+
+        if (sample.leak)
+        {
+            leaks++;
+        }
+
+        if (ctx.key != 0)
+        {
+            status = val->crypto->destroy_key(ctx.key);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(6));
+        }
+    }
+
+    if (leaks != 0)
+    {
+        val->print(PRINT_ERROR, "\tTiming leak in %d algorithm(s)\n", leaks);
+    }
+    TEST_ASSERT_EQUAL(leaks, 0, TEST_CHECKPOINT_NUM(7));
+
+    return VAL_STATUS_SUCCESS;
+}
@@ -0,0 +1,168 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _BENCH_CRYPTO_COMMON_H_
+#define _BENCH_CRYPTO_COMMON_H_
+
+#include "val_interfaces.h"
+#include "val_crypto.h"
+#include "test_crypto_common.h"
+
+/* Buffer sizes swept by the benchmarks, from BENCH_MIN_SIZE up to
+ * ARCH_TEST_BENCH_MAX_SIZE (pal_crypto_config.h) by powers of four
+ */
+#define BENCH_MIN_SIZE              16
+#define BENCH_SIZE_FACTOR           4
+
+#ifndef ARCH_TEST_BENCH_MAX_SIZE
+#define ARCH_TEST_BENCH_MAX_SIZE    (1024 * 1024)
+#endif
+
+#if ARCH_TEST_BENCH_MAX_SIZE < BENCH_MIN_SIZE
+#error "ARCH_TEST_BENCH_MAX_SIZE is below the smallest benchmarked size"
+#endif
+
+/* The chunk size sweeps feed a payload of BENCH_CHUNK_PAYLOAD bytes through
+ * the multipart APIs, in updates of BENCH_CHUNK_MIN bytes up to the whole
+ * payload by powers of BENCH_SIZE_FACTOR
+ */
+#define BENCH_CHUNK_MIN             1
+#define BENCH_CHUNK_MAX             (64 * 1024)
+
+#if ARCH_TEST_BENCH_MAX_SIZE < BENCH_CHUNK_MAX
+#define BENCH_CHUNK_PAYLOAD         ARCH_TEST_BENCH_MAX_SIZE
+#else
+#define BENCH_CHUNK_PAYLOAD         BENCH_CHUNK_MAX
+#endif
+
+/* Output room beyond the input size, for a cipher IV and padding or a MAC or tag */
+#define BENCH_OUTPUT_OVERHEAD       64
+
+/* AEAD nonce size, valid for both CCM and GCM. It leaves CCM a 3 byte message
+ * length field, enough for 16 MiB messages.
+ */
+#define BENCH_NONCE_SIZE            12
+
+/* AEAD tag size, the default tag length of CCM and GCM */
+#define BENCH_TAG_SIZE              16
+
+/* Message size of the sign and verify message benchmarks, short enough for
+ * the asymmetric operation to dominate
+ */
+#define BENCH_SIGN_MESSAGE_SIZE     64
+
+/* Largest output of the key derivation benchmarks, below the capacity of
+ * HKDF and the TLS 1.2 PRF with SHA-256 (255 hash blocks)
+ */
+#define BENCH_KDF_MAX_OUTPUT        4096
+
+/* Size of the keys derived by the key derivation benchmarks, an AES-128 key */
+#define BENCH_KDF_KEY_SIZE          16
+
+/* Identifier of the persistent keys of the key management benchmarks */
+#define BENCH_KEY_ID                0x5B01
+
+/* Distance of the output after the input in the overlapping buffer aliasing
+ * benchmarks, one AES block. What is left of bench_output past the output
+ * still holds a cipher IV and padding or an AEAD tag.
+ */
+#define BENCH_ALIAS_OFFSET          16
+
+/* Benchmarked algorithm */
+typedef struct {
+    const char      *name;      /* Algorithm name in the results */
+    psa_algorithm_t  alg;
+    psa_key_type_t   key_type;  /* PSA_KEY_TYPE_NONE for keyless operations */
+    size_t           key_bits;
+    psa_key_usage_t  usage;
+    const uint8_t   *key_data;  /* Key to import, NULL to take one from the key
+                                   fixture cache */
+    size_t           key_length;
+    size_t           max_size;  /* Largest benchmarked size, 0 for
+                                   ARCH_TEST_BENCH_MAX_SIZE */
+    uint32_t         param;     /* Algorithm parameter, e.g. the PBKDF2
+                                   iteration count */
+} bench_crypto_alg_t;
+
+/* Context of a benchmarked operation */
+typedef struct {
+    const bench_crypto_alg_t *alg;
+    psa_key_id_t              key;
+    size_t                    size;
+    size_t                    chunk;    /* Update size of multipart operations */
+    size_t                    length;   /* Output length, set by the operation */
+    psa_key_lifetime_t        lifetime; /* Lifetime of the keys created by key
+                                           management operations */
+    psa_key_id_t              target;   /* Key created by the operation */
+    const uint8_t            *input;    /* Operation buffers, set by the */
+    uint8_t                  *output;   /* buffer aliasing sweeps */
+    size_t                    output_size;
+} bench_crypto_ctx_t;
+
+/* Operations compared by a chunk size sweep. Both write their output to
+ * bench_output.
+ */
+typedef struct {
+    const char     *single_op;  /* Single-shot API name, e.g. "hash_compute" */
+    const char     *multi_op;   /* Multipart API name, e.g. "hash_update" */
+    val_bench_op_t  single;
+    val_bench_op_t  multi;
+    val_bench_op_t  verify;     /* Checks the multipart output, NULL to compare
+                                   it with the single-shot output */
+} bench_crypto_chunk_ops_t;
+
+/* Steps of a key management benchmark, all called with a bench_crypto_ctx_t
+ * context. The size of the context is the size of the key, and the key of the
+ * context is destroyed after the sample if prepare created one.
+ */
+typedef struct {
+    val_bench_op_t  prepare;    /* Untimed, before the sample, NULL if none */
+    val_bench_op_t  setup;      /* Untimed, before each operation, NULL if none */
+    val_bench_op_t  fn;         /* Measured operation */
+    val_bench_op_t  teardown;   /* Untimed, after each operation, NULL if none */
+} bench_crypto_key_ops_t;
+
+extern uint8_t       bench_input[ARCH_TEST_BENCH_MAX_SIZE];
+extern uint8_t       bench_output[ARCH_TEST_BENCH_MAX_SIZE + BENCH_OUTPUT_OVERHEAD];
+extern const uint8_t bench_nonce[BENCH_NONCE_SIZE];
+extern uint8_t       bench_reference[BENCH_CHUNK_PAYLOAD + BENCH_OUTPUT_OVERHEAD];
+
+int32_t bench_crypto_create_key(val_api_t *val, const bench_crypto_alg_t *alg,
+                                psa_key_lifetime_t lifetime, psa_key_id_t *key);
+int32_t bench_crypto_generate_key(val_api_t *val, const bench_crypto_alg_t *alg,
+                                  psa_key_lifetime_t lifetime, psa_key_id_t *key);
+bool_t bench_crypto_persistent_keys(val_api_t *val);
+void bench_crypto_key_name(const char *desc, char *name, size_t size);
+int32_t bench_crypto_kdf_setup(val_api_t *val, const bench_crypto_ctx_t *ctx,
+                               psa_key_derivation_operation_t *operation);
+int32_t bench_crypto_sweep(val_api_t *val, const char *op, const bench_crypto_alg_t *algs,
+                           uint32_t count, val_bench_op_t fn);
+int32_t bench_crypto_latency_sweep(val_api_t *val, const char *op, const bench_crypto_alg_t *algs,
+                                   uint32_t count, val_bench_op_t prepare, val_bench_op_t fn);
+int32_t bench_crypto_chunk_sweep(val_api_t *val, const bench_crypto_alg_t *algs, uint32_t count,
+                                 const bench_crypto_chunk_ops_t *ops);
+int32_t bench_crypto_key_sweep(val_api_t *val, const char *op, const bench_crypto_alg_t *algs,
+                               uint32_t count, const bench_crypto_key_ops_t *ops);
+int32_t bench_crypto_alias_sweep(val_api_t *val, const char *op, const bench_crypto_alg_t *algs,
+                                 uint32_t count, val_bench_op_t fn);
+int32_t bench_crypto_leakage_status(uint32_t input_class, psa_status_t status,
+                                    psa_status_t rejected);
+int32_t bench_crypto_leakage_sweep(val_api_t *val, const char *op, const char *variant,
+                                   const bench_crypto_alg_t *algs, uint32_t count,
+                                   val_bench_op_t prepare, val_leakage_op_t fn);
+
+#endif /* _BENCH_CRYPTO_COMMON_H_ */
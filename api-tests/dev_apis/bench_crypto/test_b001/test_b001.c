@@ -0,0 +1,46 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_b001.h"
+#include "test_data.h"
+
+const client_test_t test_b001_crypto_list[] = {
+    NULL,
+    psa_hash_compute_bench,
+    NULL,
+};
+
+/**
+    @brief    - Benchmarked operation, psa_hash_compute of a bench_input prefix
+    @param    - arg : bench_crypto_ctx_t context
+    @return   - PSA status of the operation
+**/
+static int32_t hash_compute_op(void *arg)
+{
+    bench_crypto_ctx_t *ctx = (bench_crypto_ctx_t *)arg;
+    size_t              length;
+
+    return val->crypto->hash_compute(ctx->alg->alg, bench_input, ctx->size,
+                                     bench_output, sizeof(bench_output), &length);
+}
+
+int32_t psa_hash_compute_bench(caller_security_t caller __UNUSED)
+{
+    return bench_crypto_sweep(val, "hash_compute", check1, sizeof(check1)/sizeof(check1[0]), hash_compute_op);
+}
@@ -0,0 +1,82 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "bench_crypto_common.h"
+
+static const bench_crypto_alg_t check1[] = {
+#ifdef ARCH_TEST_HASH
+#ifdef ARCH_TEST_MD2
+{"MD2", PSA_ALG_MD2, PSA_KEY_TYPE_NONE, 0, 0, NULL, 0, 0, 0},
+#endif
+
+#ifdef ARCH_TEST_MD4
+{"MD4", PSA_ALG_MD4, PSA_KEY_TYPE_NONE, 0, 0, NULL, 0, 0, 0},
+#endif
+
+#ifdef ARCH_TEST_MD5
+{"MD5", PSA_ALG_MD5, PSA_KEY_TYPE_NONE, 0, 0, NULL, 0, 0, 0},
+#endif
+
+#ifdef ARCH_TEST_RIPEMD160
+{"RIPEMD160", PSA_ALG_RIPEMD160, PSA_KEY_TYPE_NONE, 0, 0, NULL, 0, 0, 0},
+#endif
+
+#ifdef ARCH_TEST_SHA1
+{"SHA_1", PSA_ALG_SHA_1, PSA_KEY_TYPE_NONE, 0, 0, NULL, 0, 0, 0},
+#endif
+
+#ifdef ARCH_TEST_SHA224
+{"SHA_224", PSA_ALG_SHA_224, PSA_KEY_TYPE_NONE, 0, 0, NULL, 0, 0, 0},
+#endif
+
+#ifdef ARCH_TEST_SHA256
+{"SHA_256", PSA_ALG_SHA_256, PSA_KEY_TYPE_NONE, 0, 0, NULL, 0, 0, 0},
+#endif
+
+#ifdef ARCH_TEST_SHA384
+{"SHA_384", PSA_ALG_SHA_384, PSA_KEY_TYPE_NONE, 0, 0, NULL, 0, 0, 0},
+#endif
+
+#ifdef ARCH_TEST_SHA512
+{"SHA_512", PSA_ALG_SHA_512, PSA_KEY_TYPE_NONE, 0, 0, NULL, 0, 0, 0},
+#endif
+
+#ifdef ARCH_TEST_SHA512_224
+{"SHA_512_224", PSA_ALG_SHA_512_224, PSA_KEY_TYPE_NONE, 0, 0, NULL, 0, 0, 0},
+#endif
+
+#ifdef ARCH_TEST_SHA512_256
+{"SHA_512_256", PSA_ALG_SHA_512_256, PSA_KEY_TYPE_NONE, 0, 0, NULL, 0, 0, 0},
+#endif
+
+#ifdef ARCH_TEST_SHA3_224
+{"SHA3_224", PSA_ALG_SHA3_224, PSA_KEY_TYPE_NONE, 0, 0, NULL, 0, 0, 0},
+#endif
+
+#ifdef ARCH_TEST_SHA3_256
+{"SHA3_256", PSA_ALG_SHA3_256, PSA_KEY_TYPE_NONE, 0, 0, NULL, 0, 0, 0},
+#endif
+
+#ifdef ARCH_TEST_SHA3_384
+{"SHA3_384", PSA_ALG_SHA3_384, PSA_KEY_TYPE_NONE, 0, 0, NULL, 0, 0, 0},
+#endif
+
+#ifdef ARCH_TEST_SHA3_512
+{"SHA3_512", PSA_ALG_SHA3_512, PSA_KEY_TYPE_NONE, 0, 0, NULL, 0, 0, 0},
+#endif
+#endif
+};
@@ -0,0 +1,101 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "bench_crypto_common.h"
+
+static const bench_crypto_alg_t check1[] = {
+#ifdef ARCH_TEST_HMAC
+#ifdef ARCH_TEST_MD5
+{"HMAC(MD5)", PSA_ALG_HMAC(PSA_ALG_MD5), PSA_KEY_TYPE_HMAC, 256,
+ PSA_KEY_USAGE_SIGN_HASH, NULL, 0, 0, 0},
+#endif
+
+#ifdef ARCH_TEST_RIPEMD160
+{"HMAC(RIPEMD160)", PSA_ALG_HMAC(PSA_ALG_RIPEMD160), PSA_KEY_TYPE_HMAC, 256,
+ PSA_KEY_USAGE_SIGN_HASH, NULL, 0, 0, 0},
+#endif
+
+#ifdef ARCH_TEST_SHA1
+{"HMAC(SHA_1)", PSA_ALG_HMAC(PSA_ALG_SHA_1), PSA_KEY_TYPE_HMAC, 256,
+ PSA_KEY_USAGE_SIGN_HASH, NULL, 0, 0, 0},
+#endif
+
+#ifdef ARCH_TEST_SHA224
+{"HMAC(SHA_224)", PSA_ALG_HMAC(PSA_ALG_SHA_224), PSA_KEY_TYPE_HMAC, 256,
+ PSA_KEY_USAGE_SIGN_HASH, NULL, 0, 0, 0},
+#endif
+
+#ifdef ARCH_TEST_SHA256
+{"HMAC(SHA_256)", PSA_ALG_HMAC(PSA_ALG_SHA_256), PSA_KEY_TYPE_HMAC, 256,
+ PSA_KEY_USAGE_SIGN_HASH, NULL, 0, 0, 0},
+#endif
+
+#ifdef ARCH_TEST_SHA384
+{"HMAC(SHA_384)", PSA_ALG_HMAC(PSA_ALG_SHA_384), PSA_KEY_TYPE_HMAC, 256,
+ PSA_KEY_USAGE_SIGN_HASH, NULL, 0, 0, 0},
+#endif
+
+#ifdef ARCH_TEST_SHA512
+{"HMAC(SHA_512)", PSA_ALG_HMAC(PSA_ALG_SHA_512), PSA_KEY_TYPE_HMAC, 256,
+ PSA_KEY_USAGE_SIGN_HASH, NULL, 0, 0, 0},
+#endif
+
+#ifdef ARCH_TEST_SHA512_224
+{"HMAC(SHA_512_224)", PSA_ALG_HMAC(PSA_ALG_SHA_512_224), PSA_KEY_TYPE_HMAC, 256,
+ PSA_KEY_USAGE_SIGN_HASH, NULL, 0, 0, 0},
+#endif
+
+#ifdef ARCH_TEST_SHA512_256
+{"HMAC(SHA_512_256)", PSA_ALG_HMAC(PSA_ALG_SHA_512_256), PSA_KEY_TYPE_HMAC, 256,
+ PSA_KEY_USAGE_SIGN_HASH, NULL, 0, 0, 0},
+#endif
+
+#ifdef ARCH_TEST_SHA3_224
+{"HMAC(SHA3_224)", PSA_ALG_HMAC(PSA_ALG_SHA3_224), PSA_KEY_TYPE_HMAC, 256,
+ PSA_KEY_USAGE_SIGN_HASH, NULL, 0, 0, 0},
+#endif
+
+#ifdef ARCH_TEST_SHA3_256
+{"HMAC(SHA3_256)", PSA_ALG_HMAC(PSA_ALG_SHA3_256), PSA_KEY_TYPE_HMAC, 256,
+ PSA_KEY_USAGE_SIGN_HASH, NULL, 0, 0, 0},
+#endif
+
+#ifdef ARCH_TEST_SHA3_384
+{"HMAC(SHA3_384)", PSA_ALG_HMAC(PSA_ALG_SHA3_384), PSA_KEY_TYPE_HMAC, 256,
+ PSA_KEY_USAGE_SIGN_HASH, NULL, 0, 0, 0},
+#endif
+
+#ifdef ARCH_TEST_SHA3_512
+{"HMAC(SHA3_512)", PSA_ALG_HMAC(PSA_ALG_SHA3_512), PSA_KEY_TYPE_HMAC, 256,
+ PSA_KEY_USAGE_SIGN_HASH, NULL, 0, 0, 0},
+#endif
+#endif
+
+#if defined(ARCH_TEST_CMAC) && defined(ARCH_TEST_AES)
+#ifdef ARCH_TEST_AES_128
+{"CMAC(AES_128)", PSA_ALG_CMAC, PSA_KEY_TYPE_AES, 128, PSA_KEY_USAGE_SIGN_HASH, NULL, 0, 0, 0},
+#endif
+
+#ifdef ARCH_TEST_AES_192
+{"CMAC(AES_192)", PSA_ALG_CMAC, PSA_KEY_TYPE_AES, 192, PSA_KEY_USAGE_SIGN_HASH, NULL, 0, 0, 0},
+#endif
+
+#ifdef ARCH_TEST_AES_256
+{"CMAC(AES_256)", PSA_ALG_CMAC, PSA_KEY_TYPE_AES, 256, PSA_KEY_USAGE_SIGN_HASH, NULL, 0, 0, 0},
+#endif
+#endif
+};
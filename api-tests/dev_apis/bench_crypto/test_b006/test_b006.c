@@ -0,0 +1,81 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_b006.h"
+#include "test_data.h"
+
+const client_test_t test_b006_crypto_list[] = {
+    NULL,
+    psa_mac_update_bench,
+    NULL,
+};
+
+/**
+    @brief    - Single-shot operation, psa_mac_compute of the payload
+    @param    - arg : bench_crypto_ctx_t context
+    @return   - PSA status of the operation
+**/
+static int32_t mac_compute_op(void *arg)
+{
+    bench_crypto_ctx_t *ctx = (bench_crypto_ctx_t *)arg;
+
+    return val->crypto->mac_compute(ctx->key, ctx->alg->alg, bench_input, ctx->size,
+                                    bench_output, sizeof(bench_output), &ctx->length);
+}
+
+/**
+    @brief    - Multipart operation, psa_mac_update of the payload in chunks
+    @param    - arg : bench_crypto_ctx_t context
+    @return   - PSA status of the operation
+**/
+static int32_t mac_update_op(void *arg)
+{
+    bench_crypto_ctx_t   *ctx = (bench_crypto_ctx_t *)arg;
+    psa_mac_operation_t   operation = PSA_MAC_OPERATION_INIT;
+    size_t                offset, length;
+    int32_t               status;
+
+    status = val->crypto->mac_sign_setup(&operation, ctx->key, ctx->alg->alg);
+    for (offset = 0; (status == PSA_SUCCESS) && (offset < ctx->size); offset += length)
+    {
+        length = ((ctx->size - offset) < ctx->chunk) ? (ctx->size - offset) : ctx->chunk;
+        status = val->crypto->mac_update(&operation, bench_input + offset, length);
+    }
+
+    if (status == PSA_SUCCESS)
+    {
+        status = val->crypto->mac_sign_finish(&operation, bench_output, sizeof(bench_output),
+                                              &ctx->length);
+    }
+
+    if (status != PSA_SUCCESS)
+    {
+        val->crypto->mac_abort(&operation);
+    }
+    return status;
+}
+
+static const bench_crypto_chunk_ops_t mac_ops = {
+    "mac_compute", "mac_update", mac_compute_op, mac_update_op, NULL
+};
+
+int32_t psa_mac_update_bench(caller_security_t caller __UNUSED)
+{
+    return bench_crypto_chunk_sweep(val, check1, sizeof(check1)/sizeof(check1[0]), &mac_ops);
+}
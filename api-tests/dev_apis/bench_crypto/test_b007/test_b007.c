@@ -0,0 +1,121 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_b007.h"
+#include "test_data.h"
+
+const client_test_t test_b007_crypto_list[] = {
+    NULL,
+    psa_cipher_update_bench,
+    NULL,
+};
+
+/**
+    @brief    - Single-shot operation, psa_cipher_encrypt of the payload
+    @param    - arg : bench_crypto_ctx_t context
+    @return   - PSA status of the operation
+**/
+static int32_t cipher_encrypt_op(void *arg)
+{
+    bench_crypto_ctx_t *ctx = (bench_crypto_ctx_t *)arg;
+
+    return val->crypto->cipher_encrypt(ctx->key, ctx->alg->alg, bench_input, ctx->size,
+                                       bench_output, sizeof(bench_output), &ctx->length);
+}
+
+/**
+    @brief    - Multipart operation, psa_cipher_update of the payload in chunks.
+                A random IV is generated and written before the ciphertext, as
+                psa_cipher_encrypt does.
+    @param    - arg : bench_crypto_ctx_t context
+    @return   - PSA status of the operation
+**/
+static int32_t cipher_update_op(void *arg)
+{
+    bench_crypto_ctx_t     *ctx = (bench_crypto_ctx_t *)arg;
+    psa_cipher_operation_t  operation = PSA_CIPHER_OPERATION_INIT;
+    size_t                  offset, length, output_length;
+    int32_t                 status;
+
+    ctx->length = 0;
+    status = val->crypto->cipher_encrypt_setup(&operation, ctx->key, ctx->alg->alg);
+    if (status == PSA_SUCCESS)
+    {
+        status = val->crypto->cipher_generate_iv(&operation, bench_output, sizeof(bench_output),
+                                                 &ctx->length);
+    }
+
+    for (offset = 0; (status == PSA_SUCCESS) && (offset < ctx->size); offset += length)
+    {
+        length = ((ctx->size - offset) < ctx->chunk) ? (ctx->size - offset) : ctx->chunk;
+        status = val->crypto->cipher_update(&operation, bench_input + offset, length,
+                                            bench_output + ctx->length,
+                                            sizeof(bench_output) - ctx->length, &output_length);
+        ctx->length += output_length;
+    }
+
+    if (status == PSA_SUCCESS)
+    {
+        status = val->crypto->cipher_finish(&operation, bench_output + ctx->length,
+                                            sizeof(bench_output) - ctx->length, &output_length);
+        ctx->length += output_length;
+    }
+
+    if (status != PSA_SUCCESS)
+    {
+        val->crypto->cipher_abort(&operation);
+    }
+    return status;
+}
+
+/**
+    @brief    - Checks the multipart output, the IV being random it cannot be
+                compared with the single-shot one: it must decrypt to the payload
+    @param    - arg : bench_crypto_ctx_t context
+    @return   - PSA status of the decryption, VAL_STATUS_DATA_MISMATCH if it
+                does not give the payload back
+**/
+static int32_t cipher_update_verify(void *arg)
+{
+    bench_crypto_ctx_t *ctx = (bench_crypto_ctx_t *)arg;
+    size_t              length;
+    int32_t             status;
+
+    status = val->crypto->cipher_decrypt(ctx->key, ctx->alg->alg, bench_output, ctx->length,
+                                         bench_reference, sizeof(bench_reference), &length);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    if ((length != ctx->size) || memcmp(bench_reference, bench_input, length))
+    {
+        return VAL_STATUS_DATA_MISMATCH;
+    }
+    return PSA_SUCCESS;
+}
+
+static const bench_crypto_chunk_ops_t cipher_ops = {
+    "cipher_encrypt", "cipher_update", cipher_encrypt_op, cipher_update_op, cipher_update_verify
+};
+
+int32_t psa_cipher_update_bench(caller_security_t caller __UNUSED)
+{
+    return bench_crypto_chunk_sweep(val, check1, sizeof(check1)/sizeof(check1[0]), &cipher_ops);
+}
@@ -0,0 +1,93 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "bench_crypto_common.h"
+
+static const bench_crypto_alg_t check1[] = {
+#ifdef ARCH_TEST_AES
+#ifdef ARCH_TEST_CTR_AES
+#ifdef ARCH_TEST_AES_128
+{"CTR(AES_128)", PSA_ALG_CTR, PSA_KEY_TYPE_AES, 128,
+ PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT, NULL, 0, 0, 0},
+#endif
+#ifdef ARCH_TEST_AES_192
+{"CTR(AES_192)", PSA_ALG_CTR, PSA_KEY_TYPE_AES, 192,
+ PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT, NULL, 0, 0, 0},
+#endif
+#ifdef ARCH_TEST_AES_256
+{"CTR(AES_256)", PSA_ALG_CTR, PSA_KEY_TYPE_AES, 256,
+ PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT, NULL, 0, 0, 0},
+#endif
+#endif
+
+#ifdef ARCH_TEST_CBC_AES_NO_PADDING
+#ifdef ARCH_TEST_AES_128
+{"CBC_NO_PADDING(AES_128)", PSA_ALG_CBC_NO_PADDING, PSA_KEY_TYPE_AES, 128,
+ PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT, NULL, 0, 0, 0},
+#endif
+#ifdef ARCH_TEST_AES_192
+{"CBC_NO_PADDING(AES_192)", PSA_ALG_CBC_NO_PADDING, PSA_KEY_TYPE_AES, 192,
+ PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT, NULL, 0, 0, 0},
+#endif
+#ifdef ARCH_TEST_AES_256
+{"CBC_NO_PADDING(AES_256)", PSA_ALG_CBC_NO_PADDING, PSA_KEY_TYPE_AES, 256,
+ PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT, NULL, 0, 0, 0},
+#endif
+#endif
+
+#ifdef ARCH_TEST_CBC_PKCS7
+#ifdef ARCH_TEST_AES_128
+{"CBC_PKCS7(AES_128)", PSA_ALG_CBC_PKCS7, PSA_KEY_TYPE_AES, 128,
+ PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT, NULL, 0, 0, 0},
+#endif
+#ifdef ARCH_TEST_AES_192
+{"CBC_PKCS7(AES_192)", PSA_ALG_CBC_PKCS7, PSA_KEY_TYPE_AES, 192,
+ PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT, NULL, 0, 0, 0},
+#endif
+#ifdef ARCH_TEST_AES_256
+{"CBC_PKCS7(AES_256)", PSA_ALG_CBC_PKCS7, PSA_KEY_TYPE_AES, 256,
+ PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT, NULL, 0, 0, 0},
+#endif
+#endif
+
+#ifdef ARCH_TEST_CFB_AES
+#ifdef ARCH_TEST_AES_128
+{"CFB(AES_128)", PSA_ALG_CFB, PSA_KEY_TYPE_AES, 128,
+ PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT, NULL, 0, 0, 0},
+#endif
+#ifdef ARCH_TEST_AES_192
+{"CFB(AES_192)", PSA_ALG_CFB, PSA_KEY_TYPE_AES, 192,
+ PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT, NULL, 0, 0, 0},
+#endif
+#ifdef ARCH_TEST_AES_256
+{"CFB(AES_256)", PSA_ALG_CFB, PSA_KEY_TYPE_AES, 256,
+ PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT, NULL, 0, 0, 0},
+#endif
+#endif
+#endif
+
+#if defined(ARCH_TEST_DES) && defined(ARCH_TEST_CBC_NO_PADDING)
+#ifdef ARCH_TEST_DES_2KEY
+{"CBC_NO_PADDING(DES_128)", PSA_ALG_CBC_NO_PADDING, PSA_KEY_TYPE_DES, 128,
+ PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT, NULL, 0, 0, 0},
+#endif
+#ifdef ARCH_TEST_DES_3KEY
+{"CBC_NO_PADDING(DES_192)", PSA_ALG_CBC_NO_PADDING, PSA_KEY_TYPE_DES, 192,
+ PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT, NULL, 0, 0, 0},
+#endif
+#endif
+};
@@ -0,0 +1,108 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_b008.h"
+#include "test_data.h"
+
+const client_test_t test_b008_crypto_list[] = {
+    NULL,
+    psa_aead_update_bench,
+    NULL,
+};
+
+/**
+    @brief    - Single-shot operation, psa_aead_encrypt of the payload
+    @param    - arg : bench_crypto_ctx_t context
+    @return   - PSA status of the operation
+**/
+static int32_t aead_encrypt_op(void *arg)
+{
+    bench_crypto_ctx_t *ctx = (bench_crypto_ctx_t *)arg;
+
+    return val->crypto->aead_encrypt(ctx->key, ctx->alg->alg, bench_nonce, sizeof(bench_nonce),
+                                     NULL, 0, bench_input, ctx->size,
+                                     bench_output, sizeof(bench_output), &ctx->length);
+}
+
+/**
+    @brief    - Multipart operation, psa_aead_update of the payload in chunks.
+                The tag is copied after the ciphertext, as psa_aead_encrypt
+                writes it.
+    @param    - arg : bench_crypto_ctx_t context
+    @return   - PSA status of the operation
+**/
+static int32_t aead_update_op(void *arg)
+{
+    bench_crypto_ctx_t   *ctx = (bench_crypto_ctx_t *)arg;
+    psa_aead_operation_t  operation = PSA_AEAD_OPERATION_INIT;
+    size_t                offset, length, output_length, tag_length;
+    uint8_t               tag[BENCH_TAG_SIZE];
+    int32_t               status;
+
+    ctx->length = 0;
+    status = val->crypto->aead_encrypt_setup(&operation, ctx->key, ctx->alg->alg);
+    if (status == PSA_SUCCESS)
+    {
+        /* The lengths are mandatory for CCM */
+        status = val->crypto->aead_set_lengths(&operation, 0, ctx->size);
+    }
+
+    if (status == PSA_SUCCESS)
+    {
+        status = val->crypto->aead_set_nonce(&operation, bench_nonce, sizeof(bench_nonce));
+    }
+
+    for (offset = 0; (status == PSA_SUCCESS) && (offset < ctx->size); offset += length)
+    {
+        length = ((ctx->size - offset) < ctx->chunk) ? (ctx->size - offset) : ctx->chunk;
+        status = val->crypto->aead_update(&operation, bench_input + offset, length,
+                                          bench_output + ctx->length,
+                                          sizeof(bench_output) - ctx->length, &output_length);
+        ctx->length += output_length;
+    }
+
+    if (status == PSA_SUCCESS)
+    {
+        status = val->crypto->aead_finish(&operation, bench_output + ctx->length,
+                                          sizeof(bench_output) - ctx->length, &output_length,
+                                          tag, sizeof(tag), &tag_length);
+        ctx->length += output_length;
+    }
+
+    if (status == PSA_SUCCESS)
+    {
+        memcpy(bench_output + ctx->length, tag, tag_length);
+        ctx->length += tag_length;
+    }
+
+    if (status != PSA_SUCCESS)
+    {
+        val->crypto->aead_abort(&operation);
+    }
+    return status;
+}
+
+static const bench_crypto_chunk_ops_t aead_ops = {
+    "aead_encrypt", "aead_update", aead_encrypt_op, aead_update_op, NULL
+};
+
+int32_t psa_aead_update_bench(caller_security_t caller __UNUSED)
+{
+    return bench_crypto_chunk_sweep(val, check1, sizeof(check1)/sizeof(check1[0]), &aead_ops);
+}
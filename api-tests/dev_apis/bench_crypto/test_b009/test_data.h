@@ -0,0 +1,108 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "bench_crypto_common.h"
+
+static const bench_crypto_alg_t check1[] = {
+#ifdef ARCH_TEST_SHA256
+#ifdef ARCH_TEST_ECC_CURVE_SECP256R1
+#ifdef ARCH_TEST_ECDSA
+{"ECDSA(P-256, SHA_256)", PSA_ALG_ECDSA(PSA_ALG_SHA_256),
+ PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1), 256,
+ PSA_KEY_USAGE_SIGN_HASH,
+ ec_keypair_deterministic, 32, 0, 0},
+#endif
+#endif
+#endif
+
+#ifdef ARCH_TEST_SHA256
+#ifdef ARCH_TEST_ECC_CURVE_SECP256R1
+#ifdef ARCH_TEST_DETERMINISTIC_ECDSA
+{"DETERMINISTIC_ECDSA(P-256, SHA_256)", PSA_ALG_DETERMINISTIC_ECDSA(PSA_ALG_SHA_256),
+ PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1), 256,
+ PSA_KEY_USAGE_SIGN_HASH,
+ ec_keypair_deterministic, 32, 0, 0},
+#endif
+#endif
+#endif
+
+#ifdef ARCH_TEST_SHA384
+#ifdef ARCH_TEST_ECC_CURVE_SECP384R1
+#ifdef ARCH_TEST_ECDSA
+{"ECDSA(P-384, SHA_384)", PSA_ALG_ECDSA(PSA_ALG_SHA_384),
+ PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1), 384,
+ PSA_KEY_USAGE_SIGN_HASH,
+ ecdh_secp_384_r1_prv_key, ECDH_SECP_384_R1_PRV_KEY_LEN, 0, 0},
+#endif
+#endif
+#endif
+
+#ifdef ARCH_TEST_SHA384
+#ifdef ARCH_TEST_ECC_CURVE_SECP384R1
+#ifdef ARCH_TEST_DETERMINISTIC_ECDSA
+{"DETERMINISTIC_ECDSA(P-384, SHA_384)", PSA_ALG_DETERMINISTIC_ECDSA(PSA_ALG_SHA_384),
+ PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1), 384,
+ PSA_KEY_USAGE_SIGN_HASH,
+ ecdh_secp_384_r1_prv_key, ECDH_SECP_384_R1_PRV_KEY_LEN, 0, 0},
+#endif
+#endif
+#endif
+
+#ifdef ARCH_TEST_SHA256
+#ifdef ARCH_TEST_RSA_2048
+#ifdef ARCH_TEST_RSA_PKCS1V15_SIGN
+{"RSA_PKCS1V15_SIGN(RSA-2048, SHA_256)", PSA_ALG_RSA_PKCS1V15_SIGN(PSA_ALG_SHA_256),
+ PSA_KEY_TYPE_RSA_KEY_PAIR, 2048,
+ PSA_KEY_USAGE_SIGN_HASH,
+ rsa_256_key_pair, 1193, 0, 0},
+#endif
+#endif
+#endif
+
+#ifdef ARCH_TEST_SHA256
+#ifdef ARCH_TEST_RSA_3072
+#ifdef ARCH_TEST_RSA_PKCS1V15_SIGN
+{"RSA_PKCS1V15_SIGN(RSA-3072, SHA_256)", PSA_ALG_RSA_PKCS1V15_SIGN(PSA_ALG_SHA_256),
+ PSA_KEY_TYPE_RSA_KEY_PAIR, 3072,
+ PSA_KEY_USAGE_SIGN_HASH,
+ NULL, 0, 0, 0},
+#endif
+#endif
+#endif
+
+#ifdef ARCH_TEST_SHA256
+#ifdef ARCH_TEST_RSA_2048
+#ifdef ARCH_TEST_RSA_PSS
+{"RSA_PSS(RSA-2048, SHA_256)", PSA_ALG_RSA_PSS(PSA_ALG_SHA_256),
+ PSA_KEY_TYPE_RSA_KEY_PAIR, 2048,
+ PSA_KEY_USAGE_SIGN_HASH,
+ rsa_256_key_pair, 1193, 0, 0},
+#endif
+#endif
+#endif
+
+#ifdef ARCH_TEST_SHA256
+#ifdef ARCH_TEST_RSA_3072
+#ifdef ARCH_TEST_RSA_PSS
+{"RSA_PSS(RSA-3072, SHA_256)", PSA_ALG_RSA_PSS(PSA_ALG_SHA_256),
+ PSA_KEY_TYPE_RSA_KEY_PAIR, 3072,
+ PSA_KEY_USAGE_SIGN_HASH,
+ NULL, 0, 0, 0},
+#endif
+#endif
+#endif
+};
@@ -0,0 +1,60 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_b011.h"
+#include "test_data.h"
+
+const client_test_t test_b011_crypto_list[] = {
+    NULL,
+    psa_sign_message_bench,
+    NULL,
+};
+
+/**
+    @brief    - Sets the input size to BENCH_SIGN_MESSAGE_SIZE
+    @param    - arg : bench_crypto_ctx_t context
+    @return   - PSA_SUCCESS
+**/
+static int32_t message_prepare(void *arg)
+{
+    bench_crypto_ctx_t *ctx = (bench_crypto_ctx_t *)arg;
+
+    ctx->size = BENCH_SIGN_MESSAGE_SIZE;
+    return PSA_SUCCESS;
+}
+
+/**
+    @brief    - Benchmarked operation, psa_sign_message of a bench_input message
+    @param    - arg : bench_crypto_ctx_t context
+    @return   - PSA status of the operation
+**/
+static int32_t sign_message_op(void *arg)
+{
+    bench_crypto_ctx_t *ctx = (bench_crypto_ctx_t *)arg;
+    size_t              length;
+
+    return val->crypto->sign_message(ctx->key, ctx->alg->alg, bench_input, ctx->size,
+                                     bench_output, sizeof(bench_output), &length);
+}
+
+int32_t psa_sign_message_bench(caller_security_t caller __UNUSED)
+{
+    return bench_crypto_latency_sweep(val, "sign_message", check1, sizeof(check1)/sizeof(check1[0]),
+                                      message_prepare, sign_message_op);
+}
@@ -0,0 +1,62 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_b012.h"
+#include "test_data.h"
+
+const client_test_t test_b012_crypto_list[] = {
+    NULL,
+    psa_verify_message_bench,
+    NULL,
+};
+
+/**
+    @brief    - Sets the input size to BENCH_SIGN_MESSAGE_SIZE and signs the
+                input, giving the signature to be verified
+    @param    - arg : bench_crypto_ctx_t context
+    @return   - PSA status of the signature
+**/
+static int32_t message_prepare(void *arg)
+{
+    bench_crypto_ctx_t *ctx = (bench_crypto_ctx_t *)arg;
+
+    ctx->size = BENCH_SIGN_MESSAGE_SIZE;
+    return val->crypto->sign_message(ctx->key, ctx->alg->alg, bench_input, ctx->size,
+                                     bench_reference, sizeof(bench_reference), &ctx->length);
+}
+
+/**
+    @brief    - Benchmarked operation, psa_verify_message of the signature of a
+                bench_input message
+    @param    - arg : bench_crypto_ctx_t context
+    @return   - PSA status of the operation
+**/
+static int32_t verify_message_op(void *arg)
+{
+    bench_crypto_ctx_t *ctx = (bench_crypto_ctx_t *)arg;
+
+    return val->crypto->verify_message(ctx->key, ctx->alg->alg, bench_input, ctx->size,
+                                       bench_reference, ctx->length);
+}
+
+int32_t psa_verify_message_bench(caller_security_t caller __UNUSED)
+{
+    return bench_crypto_latency_sweep(val, "verify_message", check1, sizeof(check1)/sizeof(check1[0]),
+                                      message_prepare, verify_message_op);
+}
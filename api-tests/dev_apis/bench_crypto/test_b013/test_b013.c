@@ -0,0 +1,67 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_b013.h"
+#include "test_data.h"
+
+const client_test_t test_b013_crypto_list[] = {
+    NULL,
+    psa_raw_key_agreement_bench,
+    NULL,
+};
+
+/**
+    @brief    - Exports the public key of the key pair as the peer key. Agreeing
+                with its own public key costs the key pair the same as with
+                another one of the group.
+    @param    - arg : bench_crypto_ctx_t context
+    @return   - PSA status of the export
+**/
+static int32_t agreement_prepare(void *arg)
+{
+    bench_crypto_ctx_t *ctx = (bench_crypto_ctx_t *)arg;
+    int32_t             status;
+
+    status = val->crypto->export_public_key(ctx->key, bench_reference, sizeof(bench_reference),
+                                            &ctx->length);
+    ctx->size = ctx->length;
+    return status;
+}
+
+/**
+    @brief    - Benchmarked operation, psa_raw_key_agreement with the exported
+                peer key
+    @param    - arg : bench_crypto_ctx_t context
+    @return   - PSA status of the operation
+**/
+static int32_t raw_key_agreement_op(void *arg)
+{
+    bench_crypto_ctx_t *ctx = (bench_crypto_ctx_t *)arg;
+    size_t              output_length;
+
+    return val->crypto->raw_key_agreement(ctx->alg->alg, ctx->key, bench_reference, ctx->length,
+                                          bench_output, sizeof(bench_output), &output_length);
+}
+
+int32_t psa_raw_key_agreement_bench(caller_security_t caller __UNUSED)
+{
+    return bench_crypto_latency_sweep(val, "raw_key_agreement", check1,
+                                      sizeof(check1)/sizeof(check1[0]),
+                                      agreement_prepare, raw_key_agreement_op);
+}
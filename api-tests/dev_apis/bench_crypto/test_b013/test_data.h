@@ -0,0 +1,70 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "bench_crypto_common.h"
+
+#define BENCH_DH_KEY_PAIR    PSA_KEY_TYPE_DH_KEY_PAIR(PSA_DH_FAMILY_RFC7919)
+
+static const bench_crypto_alg_t check1[] = {
+#ifdef ARCH_TEST_ECC_CURVE_SECP256R1
+#ifdef ARCH_TEST_ECDH
+{"ECDH(P-256)", PSA_ALG_ECDH,
+ PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1), 256, PSA_KEY_USAGE_DERIVE,
+ ecdh_secp_256_r1_prv_key, ECDH_SECP_256_R1_PRV_KEY_LEN, 0, 0},
+#endif
+#endif
+
+#ifdef ARCH_TEST_ECC_CURVE_SECP384R1
+#ifdef ARCH_TEST_ECDH
+{"ECDH(P-384)", PSA_ALG_ECDH,
+ PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1), 384, PSA_KEY_USAGE_DERIVE,
+ ecdh_secp_384_r1_prv_key, ECDH_SECP_384_R1_PRV_KEY_LEN, 0, 0},
+#endif
+#endif
+
+#ifdef ARCH_TEST_ECC_CURVE_25519
+#ifdef ARCH_TEST_ECDH
+{"ECDH(X25519)", PSA_ALG_ECDH,
+ PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_MONTGOMERY), 255, PSA_KEY_USAGE_DERIVE,
+ NULL, 0, 0, 0},
+#endif
+#endif
+
+#ifdef ARCH_TEST_FFDH
+#ifdef ARCH_TEST_FFDHE2048
+{"FFDH(FFDHE2048)", PSA_ALG_FFDH,
+ BENCH_DH_KEY_PAIR, 2048, PSA_KEY_USAGE_DERIVE,
+ ffdh_key_data_2048, FFDH2048_PRV_KEY_LEN, 0, 0},
+#endif
+#endif
+
+#ifdef ARCH_TEST_FFDH
+#ifdef ARCH_TEST_FFDHE3072
+{"FFDH(FFDHE3072)", PSA_ALG_FFDH,
+ BENCH_DH_KEY_PAIR, 3072, PSA_KEY_USAGE_DERIVE,
+ ffdh_key_data_3072, FFDH3072_PRV_KEY_LEN, 0, 0},
+#endif
+#endif
+
+#ifdef ARCH_TEST_FFDH
+#ifdef ARCH_TEST_FFDHE4096
+{"FFDH(FFDHE4096)", PSA_ALG_FFDH,
+ BENCH_DH_KEY_PAIR, 4096, PSA_KEY_USAGE_DERIVE,
+ ffdh_key_data_4096, FFDH4096_PRV_KEY_LEN, 0, 0},
+#endif
+#endif
+};
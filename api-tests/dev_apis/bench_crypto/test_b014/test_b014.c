@@ -0,0 +1,56 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_b014.h"
+#include "test_data.h"
+
+const client_test_t test_b014_crypto_list[] = {
+    NULL,
+    psa_key_derivation_output_bytes_bench,
+    NULL,
+};
+
+/**
+    @brief    - Benchmarked operation, a key derivation from its setup to the
+                psa_key_derivation_output_bytes of the context size
+    @param    - arg : bench_crypto_ctx_t context
+    @return   - PSA status of the operation
+**/
+static int32_t output_bytes_op(void *arg)
+{
+    bench_crypto_ctx_t             *ctx = (bench_crypto_ctx_t *)arg;
+    psa_key_derivation_operation_t  operation = PSA_KEY_DERIVATION_OPERATION_INIT;
+    int32_t                         status;
+
+    status = bench_crypto_kdf_setup(val, ctx, &operation);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    status = val->crypto->key_derivation_output_bytes(&operation, bench_output, ctx->size);
+    val->crypto->key_derivation_abort(&operation);
+    return status;
+}
+
+int32_t psa_key_derivation_output_bytes_bench(caller_security_t caller __UNUSED)
+{
+    return bench_crypto_sweep(val, "key_derivation_output_bytes", check1,
+                              sizeof(check1)/sizeof(check1[0]), output_bytes_op);
+}
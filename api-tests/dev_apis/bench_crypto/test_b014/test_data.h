@@ -0,0 +1,47 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "bench_crypto_common.h"
+
+/* PBKDF2 runs a single iteration, its iteration cost is measured by test_b016 */
+static const bench_crypto_alg_t check1[] = {
+#ifdef ARCH_TEST_HKDF
+#ifdef ARCH_TEST_SHA256
+{"HKDF(SHA_256)", PSA_ALG_HKDF(PSA_ALG_SHA_256),
+ PSA_KEY_TYPE_DERIVE, BYTES_TO_BITS(AES_16B_KEY_SIZE), PSA_KEY_USAGE_DERIVE,
+ key_data, AES_16B_KEY_SIZE, BENCH_KDF_MAX_OUTPUT, 0},
+#endif
+#endif
+
+#ifdef ARCH_TEST_TLS12_PRF
+#ifdef ARCH_TEST_SHA256
+{"TLS12_PRF(SHA_256)", PSA_ALG_TLS12_PRF(PSA_ALG_SHA_256),
+ PSA_KEY_TYPE_DERIVE, BYTES_TO_BITS(AES_16B_KEY_SIZE), PSA_KEY_USAGE_DERIVE,
+ key_data, AES_16B_KEY_SIZE, BENCH_KDF_MAX_OUTPUT, 0},
+#endif
+#endif
+
+#ifdef ARCH_TEST_PBKDF2
+#ifdef ARCH_TEST_HMAC
+#ifdef ARCH_TEST_SHA256
+{"PBKDF2_HMAC(SHA_256), 1 iteration", PSA_ALG_PBKDF2_HMAC(PSA_ALG_SHA_256),
+ PSA_KEY_TYPE_PASSWORD, BYTES_TO_BITS(AES_16B_KEY_SIZE), PSA_KEY_USAGE_DERIVE,
+ key_data, AES_16B_KEY_SIZE, BENCH_KDF_MAX_OUTPUT, 1},
+#endif
+#endif
+#endif
+};
@@ -0,0 +1,82 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_b015.h"
+#include "test_data.h"
+
+const client_test_t test_b015_crypto_list[] = {
+    NULL,
+    psa_key_derivation_output_key_bench,
+    NULL,
+};
+
+/**
+    @brief    - Sets the input size to the size of the derived key
+    @param    - arg : bench_crypto_ctx_t context
+    @return   - PSA_SUCCESS
+**/
+static int32_t output_key_prepare(void *arg)
+{
+    bench_crypto_ctx_t *ctx = (bench_crypto_ctx_t *)arg;
+
+    ctx->size = BENCH_KDF_KEY_SIZE;
+    return PSA_SUCCESS;
+}
+
+/**
+    @brief    - Benchmarked operation, a key derivation from its setup to the
+                psa_key_derivation_output_key of an AES key, which is then
+                destroyed
+    @param    - arg : bench_crypto_ctx_t context
+    @return   - PSA status of the operation
+**/
+static int32_t output_key_op(void *arg)
+{
+    bench_crypto_ctx_t             *ctx = (bench_crypto_ctx_t *)arg;
+    psa_key_derivation_operation_t  operation = PSA_KEY_DERIVATION_OPERATION_INIT;
+    psa_key_attributes_t            attributes = PSA_KEY_ATTRIBUTES_INIT;
+    psa_key_id_t                    key;
+    int32_t                         status;
+
+    status = bench_crypto_kdf_setup(val, ctx, &operation);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    val->crypto->set_key_type(&attributes, PSA_KEY_TYPE_AES);
+    val->crypto->set_key_bits(&attributes, BYTES_TO_BITS(ctx->size));
+    val->crypto->set_key_usage_flags(&attributes, PSA_KEY_USAGE_ENCRYPT);
+    status = val->crypto->key_derivation_output_key(&attributes, &operation, &key);
+    val->crypto->key_derivation_abort(&operation);
+    val->crypto->reset_key_attributes(&attributes);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    return val->crypto->destroy_key(key);
+}
+
+int32_t psa_key_derivation_output_key_bench(caller_security_t caller __UNUSED)
+{
+    return bench_crypto_latency_sweep(val, "key_derivation_output_key", check1,
+                                      sizeof(check1)/sizeof(check1[0]),
+                                      output_key_prepare, output_key_op);
+}
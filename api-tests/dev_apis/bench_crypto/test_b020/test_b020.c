@@ -0,0 +1,86 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_b020.h"
+#include "test_c004/test_data.h"
+
+#define BENCH_KEY_COUNT (sizeof(check1)/sizeof(check1[0]))
+
+const client_test_t test_b020_crypto_list[] = {
+    NULL,
+    psa_export_public_key_bench,
+    NULL,
+};
+
+/* Test vectors of test_c004 which are expected to succeed */
+static bench_crypto_alg_t bench_keys[BENCH_KEY_COUNT];
+static char               bench_names[BENCH_KEY_COUNT][sizeof(check1[0].test_desc)];
+
+/**
+    @brief    - Imports the key to be exported
+    @param    - arg : bench_crypto_ctx_t context
+    @return   - PSA status of the import
+**/
+static int32_t export_public_key_prepare(void *arg)
+{
+    bench_crypto_ctx_t *ctx = (bench_crypto_ctx_t *)arg;
+
+    return bench_crypto_create_key(val, ctx->alg, ctx->lifetime, &ctx->key);
+}
+
+/**
+    @brief    - Benchmarked operation, psa_export_public_key of the imported key
+    @param    - arg : bench_crypto_ctx_t context
+    @return   - PSA status of the operation
+**/
+static int32_t export_public_key_op(void *arg)
+{
+    bench_crypto_ctx_t *ctx = (bench_crypto_ctx_t *)arg;
+
+    return val->crypto->export_public_key(ctx->key, bench_output, sizeof(bench_output), &ctx->length);
+}
+
+static const bench_crypto_key_ops_t export_public_key_ops = {
+    export_public_key_prepare, NULL, export_public_key_op, NULL
+};
+
+int32_t psa_export_public_key_bench(caller_security_t caller __UNUSED)
+{
+    uint32_t i, count = 0;
+
+    for (i = 0; i < BENCH_KEY_COUNT; i++)
+    {
+        if (check1[i].expected_status != PSA_SUCCESS)
+        {
+            continue;
+        }
+
+        bench_crypto_key_name(check1[i].test_desc, bench_names[count], sizeof(bench_names[0]));
+        bench_keys[count].name       = bench_names[count];
+        bench_keys[count].alg        = 0;
+        bench_keys[count].key_type   = check1[i].type;
+        bench_keys[count].key_bits   = check1[i].bits;
+        bench_keys[count].usage      = check1[i].usage_flags;
+        bench_keys[count].key_data   = check1[i].data;
+        bench_keys[count].key_length = check1[i].data_length;
+        count++;
+    }
+
+    return bench_crypto_key_sweep(val, "export_public_key", bench_keys, count, &export_public_key_ops);
+}
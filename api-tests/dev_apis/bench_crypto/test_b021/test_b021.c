@@ -0,0 +1,110 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_b021.h"
+#include "test_c044/test_data.h"
+
+#define BENCH_KEY_COUNT (sizeof(check1)/sizeof(check1[0]))
+
+const client_test_t test_b021_crypto_list[] = {
+    NULL,
+    psa_copy_key_bench,
+    NULL,
+};
+
+/* Test vectors of test_c044 which are expected to succeed */
+static bench_crypto_alg_t bench_keys[BENCH_KEY_COUNT];
+static char               bench_names[BENCH_KEY_COUNT][sizeof(check1[0].test_desc)];
+
+/**
+    @brief    - Imports the volatile key to be copied
+    @param    - arg : bench_crypto_ctx_t context
+    @return   - PSA status of the import
+**/
+static int32_t copy_key_prepare(void *arg)
+{
+    bench_crypto_ctx_t *ctx = (bench_crypto_ctx_t *)arg;
+
+    return bench_crypto_create_key(val, ctx->alg, PSA_KEY_LIFETIME_VOLATILE, &ctx->key);
+}
+
+/**
+    @brief    - Benchmarked operation, psa_copy_key of the imported key into a
+                key of the context lifetime, with the same policy
+    @param    - arg : bench_crypto_ctx_t context
+    @return   - PSA status of the operation
+**/
+static int32_t copy_key_op(void *arg)
+{
+    bench_crypto_ctx_t   *ctx = (bench_crypto_ctx_t *)arg;
+    psa_key_attributes_t  attributes = PSA_KEY_ATTRIBUTES_INIT;
+    int32_t               status;
+
+    val->crypto->set_key_usage_flags(&attributes, ctx->alg->usage);
+    val->crypto->set_key_algorithm(&attributes, ctx->alg->alg);
+    if (ctx->lifetime != PSA_KEY_LIFETIME_VOLATILE)
+    {
+        val->crypto->set_key_id(&attributes, BENCH_KEY_ID);
+        val->crypto->set_key_lifetime(&attributes, ctx->lifetime);
+    }
+    status = val->crypto->copy_key(ctx->key, &attributes, &ctx->target);
+    val->crypto->reset_key_attributes(&attributes);
+    return status;
+}
+
+/**
+    @brief    - Destroys the copy
+    @param    - arg : bench_crypto_ctx_t context
+    @return   - PSA status
+**/
+static int32_t destroy_target(void *arg)
+{
+    bench_crypto_ctx_t *ctx = (bench_crypto_ctx_t *)arg;
+
+    return val->crypto->destroy_key(ctx->target);
+}
+
+static const bench_crypto_key_ops_t copy_key_ops = {
+    copy_key_prepare, NULL, copy_key_op, destroy_target
+};
+
+int32_t psa_copy_key_bench(caller_security_t caller __UNUSED)
+{
+    uint32_t i, count = 0;
+
+    for (i = 0; i < BENCH_KEY_COUNT; i++)
+    {
+        if (check1[i].expected_status != PSA_SUCCESS)
+        {
+            continue;
+        }
+
+        bench_crypto_key_name(check1[i].test_desc, bench_names[count], sizeof(bench_names[0]));
+        bench_keys[count].name       = bench_names[count];
+        bench_keys[count].alg        = check1[i].alg;
+        bench_keys[count].key_type   = check1[i].type;
+        bench_keys[count].key_bits   = check1[i].target_bits;
+        bench_keys[count].usage      = check1[i].usage_flags;
+        bench_keys[count].key_data   = check1[i].data;
+        bench_keys[count].key_length = check1[i].data_length;
+        count++;
+    }
+
+    return bench_crypto_key_sweep(val, "copy_key", bench_keys, count, &copy_key_ops);
+}
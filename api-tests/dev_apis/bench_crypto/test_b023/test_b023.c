@@ -0,0 +1,268 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_b023.h"
+
+const client_test_t test_b023_crypto_list[] = {
+    NULL,
+    psa_key_store_scaling_bench,
+    NULL,
+};
+
+/* Key store populations, from BENCH_KEYS_MIN keys by BENCH_SIZE_FACTOR up to
+ * ARCH_TEST_BENCH_MAX_KEYS (pal_crypto_config.h) or a full key store
+ */
+#define BENCH_KEYS_MIN              16
+
+#ifndef ARCH_TEST_BENCH_MAX_KEYS
+#define ARCH_TEST_BENCH_MAX_KEYS    1024
+#endif
+
+/* Message size of the MAC lookups */
+#define BENCH_MAC_SIZE              16
+
+/* Lookups of the live keys, in turn */
+typedef struct {
+    uint32_t live;
+    uint32_t next;
+} key_store_ctx_t;
+
+#if defined(ARCH_TEST_HMAC) && defined(ARCH_TEST_SHA256)
+static psa_key_id_t bench_keys[ARCH_TEST_BENCH_MAX_KEYS];
+
+/**
+    @brief    - Imports an HMAC key into the key store
+    @param    - index    : Index of the key, persistent keys get the
+                           BENCH_KEY_ID + index identifier
+                lifetime : Key lifetime
+    @return   - PSA status
+**/
+static int32_t key_store_import(uint32_t index, psa_key_lifetime_t lifetime)
+{
+    psa_key_attributes_t  attributes = PSA_KEY_ATTRIBUTES_INIT;
+    int32_t               status;
+
+    val->crypto->set_key_type(&attributes, PSA_KEY_TYPE_HMAC);
+    val->crypto->set_key_usage_flags(&attributes, PSA_KEY_USAGE_SIGN_MESSAGE);
+    val->crypto->set_key_algorithm(&attributes, PSA_ALG_HMAC(PSA_ALG_SHA_256));
+    if (lifetime != PSA_KEY_LIFETIME_VOLATILE)
+    {
+        val->crypto->set_key_id(&attributes, BENCH_KEY_ID + index);
+        val->crypto->set_key_lifetime(&attributes, lifetime);
+    }
+
+    status = val->crypto->import_key(&attributes, key_data, AES_16B_KEY_SIZE, &bench_keys[index]);
+
+    /* Key left over by an interrupted run */
+    if ((status == PSA_ERROR_ALREADY_EXISTS) &&
+        (val->crypto->destroy_key(BENCH_KEY_ID + index) == PSA_SUCCESS))
+    {
+        status = val->crypto->import_key(&attributes, key_data, AES_16B_KEY_SIZE,
+                                         &bench_keys[index]);
+    }
+
+    val->crypto->reset_key_attributes(&attributes);
+    return status;
+}
+
+/**
+    @brief    - Benchmarked operation, psa_get_key_attributes of the next key
+    @param    - arg : key_store_ctx_t context
+    @return   - PSA status of the operation
+**/
+static int32_t get_key_attributes_op(void *arg)
+{
+    key_store_ctx_t      *ctx = (key_store_ctx_t *)arg;
+    psa_key_attributes_t  attributes = PSA_KEY_ATTRIBUTES_INIT;
+    int32_t               status;
+
+    status = val->crypto->get_key_attributes(bench_keys[ctx->next], &attributes);
+    val->crypto->reset_key_attributes(&attributes);
+    ctx->next = (ctx->next + 1) % ctx->live;
+    return status;
+}
+
+/**
+    @brief    - Benchmarked operation, psa_mac_compute of a short message with
+                the next key
+    @param    - arg : key_store_ctx_t context
+    @return   - PSA status of the operation
+**/
+static int32_t mac_compute_op(void *arg)
+{
+    key_store_ctx_t *ctx = (key_store_ctx_t *)arg;
+    size_t           length;
+    int32_t          status;
+
+    status = val->crypto->mac_compute(bench_keys[ctx->next], PSA_ALG_HMAC(PSA_ALG_SHA_256),
+                                      bench_input, BENCH_MAC_SIZE,
+                                      bench_output, sizeof(bench_output), &length);
+    ctx->next = (ctx->next + 1) % ctx->live;
+    return status;
+}
+
+/**
+    @brief    - Measures the key lookups of a key store populated with a given
+                number of live keys
+    @param    - ctx     : Lookup context, with the number of live keys
+                variant : Lifetime name of the keys
+    @return   - Test status
+**/
+static int32_t key_store_measure(key_store_ctx_t *ctx, const char *variant)
+{
+    static const struct {
+        const char     *op;
+        uint32_t        size;
+        val_bench_op_t  fn;
+    } lookups[] = {
+        {"get_key_attributes", 0,              get_key_attributes_op},
+        {"mac_compute",        BENCH_MAC_SIZE, mac_compute_op},
+    };
+    val_bench_sample_t  sample;
+    int32_t             status;
+    uint32_t            i;
+
+    for (i = 0; i < sizeof(lookups)/sizeof(lookups[0]); i++)
+    {
+        /* Setting up the watchdog timer for each sample */
+        status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+        TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(4));
+
+        memset(&sample, 0, sizeof(sample));
+        sample.op       = lookups[i].op;
+        sample.alg_name = "HMAC(SHA_256)";
+        sample.variant  = variant;
+        sample.alg      = PSA_ALG_HMAC(PSA_ALG_SHA_256);
+        sample.key_bits = BYTES_TO_BITS(AES_16B_KEY_SIZE);
+        sample.size     = lookups[i].size;
+        sample.load     = ctx->live;
+        sample.latency  = 1;
+
+        ctx->next = 0;
+        status = val->bench_run(&sample, lookups[i].fn, ctx);
+        if (IS_TEST_SKIP(status))
+        {
+            return status;
+        }
+        TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(5));
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Fills the key store level by level, measuring the key lookups
+                at each level, until ARCH_TEST_BENCH_MAX_KEYS keys or a full
+                key store. The keys are then destroyed.
+    @param    - lifetime : Key lifetime
+                variant  : Lifetime name
+    @return   - Test status
+**/
+static int32_t key_store_scale(psa_key_lifetime_t lifetime, const char *variant)
+{
+    key_store_ctx_t  ctx = {0, 0};
+    uint32_t         level = BENCH_KEYS_MIN;
+    bool_t           full = 0;
+    int32_t          status;
+
+    while (1)
+    {
+        if (level > ARCH_TEST_BENCH_MAX_KEYS)
+        {
+            level = ARCH_TEST_BENCH_MAX_KEYS;
+        }
+
+        while (ctx.live < level)
+        {
+            status = key_store_import(ctx.live, lifetime);
+            if ((status == PSA_ERROR_INSUFFICIENT_MEMORY) ||
+                (status == PSA_ERROR_INSUFFICIENT_STORAGE))
+            {
+                full = 1;
+                break;
+            }
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+            ctx.live++;
+        }
+        TEST_ASSERT_NOT_EQUAL(ctx.live, 0, TEST_CHECKPOINT_NUM(3));
+
+        status = key_store_measure(&ctx, variant);
+        if (status != VAL_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        if (full || (ctx.live >= ARCH_TEST_BENCH_MAX_KEYS))
+        {
+            break;
+        }
+        level *= BENCH_SIZE_FACTOR;
+    }
+
+    if (full)
+    {
+        val->print(PRINT_TEST, "\tKey store capacity: %d keys\n", ctx.live);
+    }
+    else
+    {
+        val->print(PRINT_TEST, "\tKey store capacity: over %d keys\n", ctx.live);
+    }
+
+    while (ctx.live > 0)
+    {
+        ctx.live--;
+        status = val->crypto->destroy_key(bench_keys[ctx.live]);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(6));
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+#endif
+
+int32_t psa_key_store_scaling_bench(caller_security_t caller __UNUSED)
+{
+#if defined(ARCH_TEST_HMAC) && defined(ARCH_TEST_SHA256)
+    int32_t status;
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto->crypto_init();
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    memset(bench_input, 0xA5, sizeof(bench_input));
+
+    val->print(PRINT_TEST, "[Check 1] Benchmark key store scaling with volatile keys\n", 0);
+    status = key_store_scale(PSA_KEY_LIFETIME_VOLATILE, "volatile");
+    if (status != VAL_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    if (!bench_crypto_persistent_keys(val))
+    {
+        val->print(PRINT_TEST, "No persistent key support, volatile keys only\n", 0);
+        return VAL_STATUS_SUCCESS;
+    }
+
+    val->print(PRINT_TEST, "[Check 2] Benchmark key store scaling with persistent keys\n", 0);
+    return key_store_scale(PSA_KEY_LIFETIME_PERSISTENT, "persistent");
+#else
+    val->print(PRINT_TEST, "No benchmark available for the selected crypto configuration\n", 0);
+    return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+#endif
+}
@@ -0,0 +1,163 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_b024.h"
+
+const client_test_t test_b024_crypto_list[] = {
+    NULL,
+    psa_generate_random_bench,
+    psa_generate_random_contention_bench,
+    NULL,
+};
+
+/* Request sizes, from BENCH_RNG_MIN_SIZE by BENCH_SIZE_FACTOR up to
+ * BENCH_CHUNK_PAYLOAD
+ */
+#define BENCH_RNG_MIN_SIZE          1
+
+/* Largest request of the contention sweep. Small requests are dominated by
+ * the locking of the shared random generator.
+ */
+#if BENCH_CHUNK_PAYLOAD < 1024
+#define BENCH_RNG_THREAD_MAX_SIZE   BENCH_CHUNK_PAYLOAD
+#else
+#define BENCH_RNG_THREAD_MAX_SIZE   1024
+#endif
+
+/* Random request of one thread */
+typedef struct {
+    uint8_t *output;
+    size_t   size;
+} rng_ctx_t;
+
+static uint8_t   rng_thread_output[VAL_BENCH_MAX_THREADS][BENCH_RNG_THREAD_MAX_SIZE];
+static rng_ctx_t rng_thread_ctx[VAL_BENCH_MAX_THREADS];
+static void     *rng_thread_arg[VAL_BENCH_MAX_THREADS];
+
+/**
+    @brief    - Benchmarked operation, psa_generate_random
+    @param    - arg : rng_ctx_t context
+    @return   - PSA status of the operation
+**/
+static int32_t generate_random_op(void *arg)
+{
+    rng_ctx_t *ctx = (rng_ctx_t *)arg;
+
+    return val->crypto->generate_random(ctx->output, ctx->size);
+}
+
+/**
+    @brief    - Describes a random generation sample
+    @param    - sample : Sample to be described
+                size   : Request size
+    @return   - None
+**/
+static void generate_random_sample(val_bench_sample_t *sample, size_t size)
+{
+    memset(sample, 0, sizeof(*sample));
+    sample->op       = "generate_random";
+    sample->alg_name = "RNG";
+    sample->size     = (uint32_t)size;
+}
+
+int32_t psa_generate_random_bench(caller_security_t caller __UNUSED)
+{
+    val_bench_sample_t  sample;
+    rng_ctx_t           ctx = {bench_output, 0};
+    int32_t             status;
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto->crypto_init();
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    val->print(PRINT_TEST, "[Check 1] Benchmark random generation by request size\n", 0);
+    for (ctx.size = BENCH_RNG_MIN_SIZE; ctx.size <= BENCH_CHUNK_PAYLOAD;
+         ctx.size *= BENCH_SIZE_FACTOR)
+    {
+        /* Setting up the watchdog timer for each sample */
+        status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+        TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        generate_random_sample(&sample, ctx.size);
+        status = val->bench_run(&sample, generate_random_op, &ctx);
+        if (IS_TEST_SKIP(status))
+        {
+            return status;
+        }
+        TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(3));
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+int32_t psa_generate_random_contention_bench(caller_security_t caller __UNUSED)
+{
+    val_bench_sample_t  sample;
+    uint32_t            max_threads = val->bench_get_max_threads();
+    uint32_t            threads, i;
+    size_t              size;
+    int32_t             status;
+
+    val->print(PRINT_TEST, "[Check 2] Benchmark random generation from concurrent threads\n", 0);
+    if (max_threads == 0)
+    {
+        val->print(PRINT_TEST, "No benchmark threads on the platform, contention not measured\n",
+                   0);
+        return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+    }
+
+    for (i = 0; i < max_threads; i++)
+    {
+        rng_thread_ctx[i].output = rng_thread_output[i];
+        rng_thread_arg[i] = &rng_thread_ctx[i];
+    }
+
+    for (size = BENCH_RNG_MIN_SIZE; size <= BENCH_RNG_THREAD_MAX_SIZE; size *= BENCH_SIZE_FACTOR)
+    {
+        for (i = 0; i < max_threads; i++)
+        {
+            rng_thread_ctx[i].size = size;
+        }
+
+        /* Thread counts by powers of two, up to the largest one */
+        threads = 1;
+        while (1)
+        {
+            /* Setting up the watchdog timer for each sample */
+            status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+            TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(4));
+
+            generate_random_sample(&sample, size);
+            status = val->bench_run_threads(&sample, generate_random_op, rng_thread_arg, threads);
+            if (IS_TEST_SKIP(status))
+            {
+                return status;
+            }
+            TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(5));
+
+            if (threads == max_threads)
+            {
+                break;
+            }
+            threads = ((threads * 2) < max_threads) ? (threads * 2) : max_threads;
+        }
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
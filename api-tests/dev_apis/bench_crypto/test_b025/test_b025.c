@@ -0,0 +1,449 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_b025.h"
+#include "test_data.h"
+
+const client_test_t test_b025_crypto_list[] = {
+    NULL,
+    psa_crypto_concurrency_stress,
+    NULL,
+};
+
+/* Message size of the stress operations, a multiple of the AES block size */
+#if BENCH_CHUNK_PAYLOAD < 1024
+#define BENCH_STRESS_SIZE           (BENCH_CHUNK_PAYLOAD & ~15u)
+#else
+#define BENCH_STRESS_SIZE           1024
+#endif
+
+#define BENCH_STRESS_OUTPUT_SIZE    (BENCH_STRESS_SIZE + BENCH_OUTPUT_OVERHEAD)
+
+/* Operation objects, keys and buffers of one thread. The first result of a
+ * thread is computed before any other thread runs and is the reference of the
+ * following ones.
+ */
+typedef struct {
+    const stress_alg_t *alg;
+    psa_key_id_t        key;
+    size_t              size;       /* Input size */
+    bool_t              recorded;   /* Reference result recorded */
+    size_t              length;     /* Reference result length */
+    bool_t              mismatch;   /* Result differing from the reference */
+    int32_t             status;     /* Status of the failed operation, 0 if none */
+    uint8_t             output[BENCH_STRESS_OUTPUT_SIZE];
+    uint8_t             reference[BENCH_STRESS_OUTPUT_SIZE];
+    uint8_t             plaintext[BENCH_STRESS_SIZE];
+} stress_ctx_t;
+
+static stress_ctx_t stress_ctx[VAL_BENCH_MAX_THREADS];
+static void        *stress_arg[VAL_BENCH_MAX_THREADS];
+
+/* IV of the cipher operations, the same for every thread so that their
+ * results can be compared
+ */
+static const uint8_t stress_iv[16] = {0};
+
+/**
+    @brief    - Records the first result of a thread, then checks the
+                following ones against it
+    @param    - ctx    : stress_ctx_t context, with the result in its output
+                length : Result length
+    @return   - PSA_SUCCESS, VAL_STATUS_DATA_MISMATCH for an incorrect result
+**/
+static int32_t stress_check(stress_ctx_t *ctx, size_t length)
+{
+    if (!ctx->recorded)
+    {
+        memcpy(ctx->reference, ctx->output, length);
+        ctx->length = length;
+        ctx->recorded = 1;
+        return PSA_SUCCESS;
+    }
+
+    if ((length != ctx->length) || (memcmp(ctx->output, ctx->reference, length) != 0))
+    {
+        ctx->mismatch = 1;
+        return VAL_STATUS_DATA_MISMATCH;
+    }
+    return PSA_SUCCESS;
+}
+
+/**
+    @brief    - Hashes the input with a multipart operation
+    @param    - ctx : stress_ctx_t context
+    @return   - PSA status, VAL_STATUS_DATA_MISMATCH for an incorrect result
+**/
+static int32_t stress_hash(stress_ctx_t *ctx)
+{
+    psa_hash_operation_t  operation = PSA_HASH_OPERATION_INIT;
+    size_t                length;
+    int32_t               status;
+
+    status = val->crypto->hash_setup(&operation, ctx->alg->alg.alg);
+    if (status == PSA_SUCCESS)
+    {
+        status = val->crypto->hash_update(&operation, bench_input, ctx->size);
+    }
+    if (status == PSA_SUCCESS)
+    {
+        status = val->crypto->hash_finish(&operation, ctx->output, sizeof(ctx->output),
+                                          &length);
+    }
+
+    if (status != PSA_SUCCESS)
+    {
+        val->crypto->hash_abort(&operation);
+        return status;
+    }
+    return stress_check(ctx, length);
+}
+
+/**
+    @brief    - Computes the MAC of the input with a multipart operation
+    @param    - ctx : stress_ctx_t context
+    @return   - PSA status, VAL_STATUS_DATA_MISMATCH for an incorrect result
+**/
+static int32_t stress_mac(stress_ctx_t *ctx)
+{
+    psa_mac_operation_t  operation = PSA_MAC_OPERATION_INIT;
+    size_t               length;
+    int32_t              status;
+
+    status = val->crypto->mac_sign_setup(&operation, ctx->key, ctx->alg->alg.alg);
+    if (status == PSA_SUCCESS)
+    {
+        status = val->crypto->mac_update(&operation, bench_input, ctx->size);
+    }
+    if (status == PSA_SUCCESS)
+    {
+        status = val->crypto->mac_sign_finish(&operation, ctx->output, sizeof(ctx->output),
+                                              &length);
+    }
+
+    if (status != PSA_SUCCESS)
+    {
+        val->crypto->mac_abort(&operation);
+        return status;
+    }
+    return stress_check(ctx, length);
+}
+
+/**
+    @brief    - Encrypts the input with a multipart operation and a fixed IV
+    @param    - ctx : stress_ctx_t context
+    @return   - PSA status, VAL_STATUS_DATA_MISMATCH for an incorrect result
+**/
+static int32_t stress_cipher(stress_ctx_t *ctx)
+{
+    psa_cipher_operation_t  operation = PSA_CIPHER_OPERATION_INIT;
+    size_t                  length = 0, finish_length = 0;
+    int32_t                 status;
+
+    status = val->crypto->cipher_encrypt_setup(&operation, ctx->key, ctx->alg->alg.alg);
+    if (status == PSA_SUCCESS)
+    {
+        status = val->crypto->cipher_set_iv(&operation, stress_iv, sizeof(stress_iv));
+    }
+    if (status == PSA_SUCCESS)
+    {
+        status = val->crypto->cipher_update(&operation, bench_input, ctx->size,
+                                            ctx->output, sizeof(ctx->output), &length);
+    }
+    if (status == PSA_SUCCESS)
+    {
+        status = val->crypto->cipher_finish(&operation, ctx->output + length,
+                                            sizeof(ctx->output) - length, &finish_length);
+    }
+
+    if (status != PSA_SUCCESS)
+    {
+        val->crypto->cipher_abort(&operation);
+        return status;
+    }
+    return stress_check(ctx, length + finish_length);
+}
+
+/**
+    @brief    - Encrypts the input with a fixed nonce, then decrypts it back
+    @param    - ctx : stress_ctx_t context
+    @return   - PSA status, VAL_STATUS_DATA_MISMATCH for an incorrect result
+**/
+static int32_t stress_aead(stress_ctx_t *ctx)
+{
+    size_t   length, plaintext_length;
+    int32_t  status;
+
+    status = val->crypto->aead_encrypt(ctx->key, ctx->alg->alg.alg, bench_nonce, BENCH_NONCE_SIZE,
+                                       NULL, 0, bench_input, ctx->size,
+                                       ctx->output, sizeof(ctx->output), &length);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    status = stress_check(ctx, length);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    status = val->crypto->aead_decrypt(ctx->key, ctx->alg->alg.alg, bench_nonce, BENCH_NONCE_SIZE,
+                                       NULL, 0, ctx->output, length,
+                                       ctx->plaintext, sizeof(ctx->plaintext), &plaintext_length);
+    if ((status == PSA_ERROR_INVALID_SIGNATURE) ||
+        ((status == PSA_SUCCESS) && ((plaintext_length != ctx->size) ||
+                                     (memcmp(ctx->plaintext, bench_input, ctx->size) != 0))))
+    {
+        ctx->mismatch = 1;
+        return VAL_STATUS_DATA_MISMATCH;
+    }
+    return status;
+}
+
+/**
+    @brief    - Signs a hash of the input, then verifies the signature. The
+                signature can be randomized, it is not compared.
+    @param    - ctx : stress_ctx_t context
+    @return   - PSA status, VAL_STATUS_DATA_MISMATCH for an incorrect result
+**/
+static int32_t stress_sign(stress_ctx_t *ctx)
+{
+    size_t   length;
+    int32_t  status;
+
+    status = val->crypto->sign_hash(ctx->key, ctx->alg->alg.alg, bench_input, ctx->size,
+                                    ctx->output, sizeof(ctx->output), &length);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    status = val->crypto->verify_hash(ctx->key, ctx->alg->alg.alg, bench_input, ctx->size,
+                                      ctx->output, length);
+    if (status == PSA_ERROR_INVALID_SIGNATURE)
+    {
+        ctx->mismatch = 1;
+        return VAL_STATUS_DATA_MISMATCH;
+    }
+    return status;
+}
+
+/**
+    @brief    - Stress operation, run concurrently by each thread on its own
+                context. Only the PSA APIs are called, the VAL state is not
+                touched from the threads.
+    @param    - arg : stress_ctx_t context
+    @return   - PSA status, VAL_STATUS_DATA_MISMATCH for an incorrect result
+**/
+static int32_t stress_op(void *arg)
+{
+    stress_ctx_t *ctx = (stress_ctx_t *)arg;
+    int32_t       status;
+
+    switch (ctx->alg->kind)
+    {
+        case STRESS_HASH:
+            status = stress_hash(ctx);
+            break;
+        case STRESS_MAC:
+            status = stress_mac(ctx);
+            break;
+        case STRESS_CIPHER:
+            status = stress_cipher(ctx);
+            break;
+        case STRESS_AEAD:
+            status = stress_aead(ctx);
+            break;
+        default:
+            status = stress_sign(ctx);
+            break;
+    }
+
+    if ((status != PSA_SUCCESS) && (ctx->status == 0))
+    {
+        ctx->status = status;
+    }
+    return status;
+}
+
+/**
+    @brief    - Prints the threads which failed or gave an incorrect result
+    @param    - threads : Number of threads of the sample
+    @return   - None
+**/
+static void stress_report_failures(uint32_t threads)
+{
+    uint32_t i;
+
+    for (i = 0; i < threads; i++)
+    {
+        if (stress_ctx[i].mismatch)
+        {
+            val->print(PRINT_ERROR, "\tThread %d: incorrect result\n", i);
+        }
+        else if (stress_ctx[i].status != 0)
+        {
+            val->print(PRINT_ERROR, "\tThread %d: ", i);
+            val->print(PRINT_ERROR, "failed with status %d\n", stress_ctx[i].status);
+        }
+    }
+}
+
+/**
+    @brief    - Runs the stress operation of an algorithm from 1, 2, 4 and so on
+                up to max_threads threads, printing the throughput scaling
+    @param    - alg         : Stressed algorithm
+                max_threads : Largest number of threads
+    @return   - Test status
+**/
+static int32_t stress_scale(const stress_alg_t *alg, uint32_t max_threads)
+{
+    static const char *const ops[] = {
+        "hash_update", "mac_update", "cipher_update", "aead_encrypt", "sign_hash"
+    };
+    val_bench_sample_t  sample;
+    uint32_t            single = VAL_BENCH_UNKNOWN;
+    uint32_t            speedup;
+    uint32_t            threads = 1;
+    uint32_t            i;
+    int32_t             status;
+
+    while (1)
+    {
+        for (i = 0; i < threads; i++)
+        {
+            stress_ctx[i].recorded = 0;
+            stress_ctx[i].mismatch = 0;
+            stress_ctx[i].status = 0;
+        }
+
+        /* Setting up the watchdog timer for each sample */
+        status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+        TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(3));
+
+        memset(&sample, 0, sizeof(sample));
+        sample.op       = ops[alg->kind];
+        sample.alg_name = alg->alg.name;
+        sample.alg      = alg->alg.alg;
+        sample.key_bits = (uint32_t)alg->alg.key_bits;
+        sample.size     = (uint32_t)stress_ctx[0].size;
+
+        status = val->bench_run_threads(&sample, stress_op, stress_arg, threads);
+        if (IS_TEST_SKIP(status))
+        {
+            return status;
+        }
+        if (status != VAL_STATUS_SUCCESS)
+        {
+            stress_report_failures(threads);
+        }
+        TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(4));
+
+        if (threads == 1)
+        {
+            single = sample.mb_per_s_x100;
+        }
+        else if ((single != VAL_BENCH_UNKNOWN) && (single != 0) &&
+                 (sample.mb_per_s_x100 != VAL_BENCH_UNKNOWN))
+        {
+            speedup = (uint32_t)(((uint64_t)sample.mb_per_s_x100 * 100) / single);
+            val->print(PRINT_TEST, "\tSpeedup on %d threads: ", threads);
+            val->print(PRINT_TEST, "%d.", (int32_t)(speedup / 100));
+            val->print(PRINT_TEST, ((speedup % 100) < 10) ? "0%dx\n" : "%dx\n",
+                       (int32_t)(speedup % 100));
+        }
+
+        if (threads == max_threads)
+        {
+            break;
+        }
+        threads = ((threads * 2) < max_threads) ? (threads * 2) : max_threads;
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+int32_t psa_crypto_concurrency_stress(caller_security_t caller __UNUSED)
+{
+    uint32_t  count = sizeof(check1)/sizeof(check1[0]);
+    uint32_t  max_threads = val->bench_get_max_threads();
+    uint32_t  i, j;
+    int32_t   status;
+
+    if (count == 0)
+    {
+        val->print(PRINT_TEST, "No benchmark available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    if (max_threads == 0)
+    {
+        val->print(PRINT_TEST, "No benchmark threads on the platform, see pal_thread_get_max\n",
+                   0);
+        return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+    }
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto->crypto_init();
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    memset(bench_input, 0xA5, sizeof(bench_input));
+
+    for (i = 0; i < count; i++)
+    {
+        val->print(PRINT_TEST, "[Check %d] Stress ", i + 1);
+        val->print(PRINT_TEST, check1[i].alg.name, 0);
+        val->print(PRINT_TEST, " from concurrent threads\n", 0);
+
+        /* Each thread gets its own key, created from the VAL context as the
+         * PAL key tracking is not thread safe
+         */
+        for (j = 0; j < max_threads; j++)
+        {
+            memset(&stress_ctx[j], 0, sizeof(stress_ctx[j]));
+            stress_ctx[j].alg = &check1[i];
+            stress_ctx[j].size = (check1[i].kind == STRESS_SIGN)
+                                 ? PSA_HASH_LENGTH(PSA_ALG_SIGN_GET_HASH(check1[i].alg.alg))
+                                 : BENCH_STRESS_SIZE;
+            stress_arg[j] = &stress_ctx[j];
+
+            status = bench_crypto_create_key(val, &check1[i].alg, PSA_KEY_LIFETIME_VOLATILE,
+                                             &stress_ctx[j].key);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+        }
+
+        status = stress_scale(&check1[i], max_threads);
+        if (status != VAL_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        for (j = 0; j < max_threads; j++)
+        {
+            if (stress_ctx[j].key != 0)
+            {
+                status = val->crypto->destroy_key(stress_ctx[j].key);
+                TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
+            }
+        }
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
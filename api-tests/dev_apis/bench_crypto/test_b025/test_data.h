@@ -0,0 +1,70 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "bench_crypto_common.h"
+
+/* Operation run by the threads of a stress sample */
+typedef enum {
+    STRESS_HASH,    /* psa_hash_setup/update/finish */
+    STRESS_MAC,     /* psa_mac_sign_setup/update/sign_finish */
+    STRESS_CIPHER,  /* psa_cipher_encrypt_setup/set_iv/update/finish */
+    STRESS_AEAD,    /* psa_aead_encrypt then psa_aead_decrypt */
+    STRESS_SIGN,    /* psa_sign_hash then psa_verify_hash */
+} stress_kind_t;
+
+typedef struct {
+    stress_kind_t       kind;
+    bench_crypto_alg_t  alg;
+} stress_alg_t;
+
+static const stress_alg_t check1[] = {
+#ifdef ARCH_TEST_SHA256
+{STRESS_HASH, {"SHA_256", PSA_ALG_SHA_256, PSA_KEY_TYPE_NONE, 0, 0, NULL, 0, 0, 0}},
+#endif
+
+#ifdef ARCH_TEST_HMAC
+#ifdef ARCH_TEST_SHA256
+{STRESS_MAC, {"HMAC(SHA_256)", PSA_ALG_HMAC(PSA_ALG_SHA_256), PSA_KEY_TYPE_HMAC, 256,
+ PSA_KEY_USAGE_SIGN_MESSAGE, NULL, 0, 0, 0}},
+#endif
+#endif
+
+#ifdef ARCH_TEST_CBC_AES_NO_PADDING
+#ifdef ARCH_TEST_AES_128
+{STRESS_CIPHER, {"CBC_NO_PADDING(AES_128)", PSA_ALG_CBC_NO_PADDING, PSA_KEY_TYPE_AES, 128,
+ PSA_KEY_USAGE_ENCRYPT, NULL, 0, 0, 0}},
+#endif
+#endif
+
+#ifdef ARCH_TEST_GCM
+#ifdef ARCH_TEST_AES_128
+{STRESS_AEAD, {"GCM(AES_128)", PSA_ALG_GCM, PSA_KEY_TYPE_AES, 128,
+ PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT, NULL, 0, 0, 0}},
+#endif
+#endif
+
+#ifdef ARCH_TEST_SHA256
+#ifdef ARCH_TEST_ECC_CURVE_SECP256R1
+#ifdef ARCH_TEST_ECDSA
+{STRESS_SIGN, {"ECDSA(P-256, SHA_256)", PSA_ALG_ECDSA(PSA_ALG_SHA_256),
+ PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1), 256,
+ PSA_KEY_USAGE_SIGN_HASH | PSA_KEY_USAGE_VERIFY_HASH,
+ ec_keypair_deterministic, 32, 0, 0}},
+#endif
+#endif
+#endif
+};
@@ -0,0 +1,98 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_b026.h"
+#include "test_c047/test_data.h"
+
+#define LEAKAGE_VECTOR_COUNT (sizeof(check1)/sizeof(check1[0]))
+
+const client_test_t test_b026_crypto_list[] = {
+    NULL,
+    psa_mac_verify_leakage,
+    NULL,
+};
+
+/* Test vectors of test_c047 which are expected to succeed, the param of each
+ * algorithm being the index of its vector
+ */
+static bench_crypto_alg_t leakage_algs[LEAKAGE_VECTOR_COUNT];
+static char               leakage_names[LEAKAGE_VECTOR_COUNT][sizeof(check1[0].test_desc)];
+
+/**
+    @brief    - Sets the input size to the message of the test vector, and
+                alters the first byte of a copy of its MAC
+    @param    - arg : bench_crypto_ctx_t context
+    @return   - PSA status
+**/
+static int32_t mac_prepare(void *arg)
+{
+    bench_crypto_ctx_t *ctx = (bench_crypto_ctx_t *)arg;
+    const test_data    *vector = &check1[ctx->alg->param];
+
+    ctx->size = vector->data_size;
+    memcpy(bench_output, vector->expected_mac, vector->mac_size);
+    bench_output[0] ^= 0x01;
+    return PSA_SUCCESS;
+}
+
+/**
+    @brief    - Measured operation, psa_mac_verify of the valid or the
+                altered MAC
+    @param    - arg         : bench_crypto_ctx_t context
+                input_class : 0 for the valid MAC, 1 for the altered one
+    @return   - 0 if the MAC was accepted or rejected as expected
+**/
+static int32_t mac_verify_op(void *arg, uint32_t input_class)
+{
+    bench_crypto_ctx_t *ctx = (bench_crypto_ctx_t *)arg;
+    const test_data    *vector = &check1[ctx->alg->param];
+    psa_status_t        status;
+
+    status = val->crypto->mac_verify(ctx->key, vector->mac_alg, vector->data, vector->data_size,
+                                     input_class ? bench_output : vector->expected_mac,
+                                     vector->mac_size);
+    return bench_crypto_leakage_status(input_class, status, PSA_ERROR_INVALID_SIGNATURE);
+}
+
+int32_t psa_mac_verify_leakage(caller_security_t caller __UNUSED)
+{
+    uint32_t i, count = 0;
+
+    for (i = 0; i < LEAKAGE_VECTOR_COUNT; i++)
+    {
+        if ((check1[i].expected_status != PSA_SUCCESS) || (check1[i].key_alg != check1[i].mac_alg))
+        {
+            continue;
+        }
+
+        bench_crypto_key_name(check1[i].test_desc, leakage_names[count], sizeof(leakage_names[0]));
+        leakage_algs[count].name       = leakage_names[count];
+        leakage_algs[count].alg        = check1[i].mac_alg;
+        leakage_algs[count].key_type   = check1[i].key_type;
+        leakage_algs[count].key_bits   = check1[i].key_length * 8;
+        leakage_algs[count].usage      = check1[i].usage;
+        leakage_algs[count].key_data   = check1[i].key_data;
+        leakage_algs[count].key_length = check1[i].key_length;
+        leakage_algs[count].param      = i;
+        count++;
+    }
+
+    return bench_crypto_leakage_sweep(val, "mac_verify", "first byte", leakage_algs, count,
+                                      mac_prepare, mac_verify_op);
+}
@@ -0,0 +1,94 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_b027.h"
+#include "test_c007/test_data.h"
+
+#define LEAKAGE_VECTOR_COUNT (sizeof(check1)/sizeof(check1[0]))
+
+const client_test_t test_b027_crypto_list[] = {
+    NULL,
+    psa_hash_compare_leakage,
+    NULL,
+};
+
+/* Test vectors of test_c007 which are expected to succeed, the param of each
+ * algorithm being the index of its vector
+ */
+static bench_crypto_alg_t leakage_algs[LEAKAGE_VECTOR_COUNT];
+static char               leakage_names[LEAKAGE_VECTOR_COUNT][sizeof(check1[0].test_desc)];
+
+/**
+    @brief    - Sets the input size to the message of the test vector, and
+                alters the first byte of a copy of its hash
+    @param    - arg : bench_crypto_ctx_t context
+    @return   - PSA status
+**/
+static int32_t hash_prepare(void *arg)
+{
+    bench_crypto_ctx_t *ctx = (bench_crypto_ctx_t *)arg;
+    const test_data    *vector = &check1[ctx->alg->param];
+
+    ctx->size = vector->input_length;
+    memcpy(bench_output, vector->hash, vector->hash_length);
+    bench_output[0] ^= 0x01;
+    return PSA_SUCCESS;
+}
+
+/**
+    @brief    - Measured operation, psa_hash_compare with the valid or the
+                altered hash
+    @param    - arg         : bench_crypto_ctx_t context
+                input_class : 0 for the valid hash, 1 for the altered one
+    @return   - 0 if the hash was accepted or rejected as expected
+**/
+static int32_t hash_compare_op(void *arg, uint32_t input_class)
+{
+    bench_crypto_ctx_t *ctx = (bench_crypto_ctx_t *)arg;
+    const test_data    *vector = &check1[ctx->alg->param];
+    psa_status_t        status;
+
+    status = val->crypto->hash_compare(vector->alg, vector->input, vector->input_length,
+                                       input_class ? bench_output : vector->hash,
+                                       vector->hash_length);
+    return bench_crypto_leakage_status(input_class, status, PSA_ERROR_INVALID_SIGNATURE);
+}
+
+int32_t psa_hash_compare_leakage(caller_security_t caller __UNUSED)
+{
+    uint32_t i, count = 0;
+
+    for (i = 0; i < LEAKAGE_VECTOR_COUNT; i++)
+    {
+        if (check1[i].expected_status != PSA_SUCCESS)
+        {
+            continue;
+        }
+
+        bench_crypto_key_name(check1[i].test_desc, leakage_names[count], sizeof(leakage_names[0]));
+        leakage_algs[count].name     = leakage_names[count];
+        leakage_algs[count].alg      = check1[i].alg;
+        leakage_algs[count].key_type = PSA_KEY_TYPE_NONE;
+        leakage_algs[count].param    = i;
+        count++;
+    }
+
+    return bench_crypto_leakage_sweep(val, "hash_compare", "first byte", leakage_algs, count,
+                                      hash_prepare, hash_compare_op);
+}
@@ -0,0 +1,102 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_b028.h"
+#include "test_c025/test_data.h"
+
+#define LEAKAGE_VECTOR_COUNT (sizeof(check1)/sizeof(check1[0]))
+
+const client_test_t test_b028_crypto_list[] = {
+    NULL,
+    psa_aead_decrypt_leakage,
+    NULL,
+};
+
+/* Test vectors of test_c025 which are expected to succeed, the param of each
+ * algorithm being the index of its vector
+ */
+static bench_crypto_alg_t leakage_algs[LEAKAGE_VECTOR_COUNT];
+static char               leakage_names[LEAKAGE_VECTOR_COUNT][sizeof(check1[0].test_desc)];
+
+/**
+    @brief    - Sets the input size to the ciphertext of the test vector, and
+                alters the first byte of the tag of a copy of the ciphertext
+    @param    - arg : bench_crypto_ctx_t context
+    @return   - PSA status
+**/
+static int32_t aead_prepare(void *arg)
+{
+    bench_crypto_ctx_t *ctx = (bench_crypto_ctx_t *)arg;
+    const test_data    *vector = &check1[ctx->alg->param];
+
+    ctx->size = vector->ciphertext_length;
+    memcpy(bench_input, vector->ciphertext, vector->ciphertext_length);
+    bench_input[vector->expected_plaintext_length] ^= 0x01;
+    return PSA_SUCCESS;
+}
+
+/**
+    @brief    - Measured operation, psa_aead_decrypt of the valid or the
+                altered ciphertext
+    @param    - arg         : bench_crypto_ctx_t context
+                input_class : 0 for the valid ciphertext, 1 for the altered one
+    @return   - 0 if the ciphertext was accepted or rejected as expected
+**/
+static int32_t aead_decrypt_op(void *arg, uint32_t input_class)
+{
+    bench_crypto_ctx_t *ctx = (bench_crypto_ctx_t *)arg;
+    const test_data    *vector = &check1[ctx->alg->param];
+    psa_status_t        status;
+
+    status = val->crypto->aead_decrypt(ctx->key, vector->aead_alg,
+                                       vector->nonce, vector->nonce_length,
+                                       vector->additional_data, vector->additional_data_length,
+                                       input_class ? bench_input : vector->ciphertext,
+                                       vector->ciphertext_length,
+                                       bench_output, sizeof(bench_output), &ctx->length);
+    return bench_crypto_leakage_status(input_class, status, PSA_ERROR_INVALID_SIGNATURE);
+}
+
+int32_t psa_aead_decrypt_leakage(caller_security_t caller __UNUSED)
+{
+    uint32_t i, count = 0;
+
+    for (i = 0; i < LEAKAGE_VECTOR_COUNT; i++)
+    {
+        if ((check1[i].expected_status[0] != PSA_SUCCESS) ||
+            (check1[i].key_alg != check1[i].aead_alg))
+        {
+            continue;
+        }
+
+        bench_crypto_key_name(check1[i].test_desc, leakage_names[count], sizeof(leakage_names[0]));
+        leakage_algs[count].name       = leakage_names[count];
+        leakage_algs[count].alg        = check1[i].aead_alg;
+        leakage_algs[count].key_type   = check1[i].type;
+        leakage_algs[count].key_bits   = check1[i].data_length * 8;
+        leakage_algs[count].usage      = check1[i].usage_flags;
+        leakage_algs[count].key_data   = check1[i].data;
+        leakage_algs[count].key_length = check1[i].data_length;
+        leakage_algs[count].param      = i;
+        count++;
+    }
+
+    return bench_crypto_leakage_sweep(val, "aead_decrypt", "first tag byte", leakage_algs, count,
+                                      aead_prepare, aead_decrypt_op);
+}
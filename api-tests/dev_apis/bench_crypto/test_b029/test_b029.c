@@ -0,0 +1,113 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_b029.h"
+#include "test_c040/test_data.h"
+
+/* test_c040 has no vectors without these algorithms */
+#if defined(ARCH_TEST_RSA_1024) || defined(ARCH_TEST_RSA_PKCS1V15_CRYPT)
+#define LEAKAGE_VECTORS
+#define LEAKAGE_VECTOR_COUNT (sizeof(check1)/sizeof(check1[0]))
+#endif
+
+const client_test_t test_b029_crypto_list[] = {
+    NULL,
+    psa_asymmetric_decrypt_leakage,
+    NULL,
+};
+
+#ifdef LEAKAGE_VECTORS
+/* Test vectors of test_c040 which are expected to succeed, the param of each
+ * algorithm being the index of its vector
+ */
+static bench_crypto_alg_t leakage_algs[LEAKAGE_VECTOR_COUNT];
+static char               leakage_names[LEAKAGE_VECTOR_COUNT][sizeof(check1[0].test_desc)];
+
+/**
+    @brief    - Sets the input size to the ciphertext of the test vector, and
+                alters the last byte of a copy of the ciphertext, so that it
+                stays below the modulus but decrypts to an invalid padding
+    @param    - arg : bench_crypto_ctx_t context
+    @return   - PSA status
+**/
+static int32_t decrypt_prepare(void *arg)
+{
+    bench_crypto_ctx_t *ctx = (bench_crypto_ctx_t *)arg;
+    const test_data    *vector = &check1[ctx->alg->param];
+
+    ctx->size = vector->input_length;
+    memcpy(bench_input, vector->input, vector->input_length);
+    bench_input[vector->input_length - 1] ^= 0x01;
+    return PSA_SUCCESS;
+}
+
+/**
+    @brief    - Measured operation, psa_asymmetric_decrypt of the valid or
+                the altered ciphertext
+    @param    - arg         : bench_crypto_ctx_t context
+                input_class : 0 for the valid ciphertext, 1 for the altered one
+    @return   - 0 if the ciphertext was accepted or rejected as expected
+**/
+static int32_t asymmetric_decrypt_op(void *arg, uint32_t input_class)
+{
+    bench_crypto_ctx_t *ctx = (bench_crypto_ctx_t *)arg;
+    const test_data    *vector = &check1[ctx->alg->param];
+    psa_status_t        status;
+
+    status = val->crypto->asymmetric_decrypt(ctx->key, vector->alg,
+                                             input_class ? bench_input : vector->input,
+                                             vector->input_length,
+                                             vector->salt, vector->salt_length,
+                                             bench_output, sizeof(bench_output), &ctx->length);
+    return bench_crypto_leakage_status(input_class, status, PSA_ERROR_INVALID_PADDING);
+}
+#endif
+
+int32_t psa_asymmetric_decrypt_leakage(caller_security_t caller __UNUSED)
+{
+#ifdef LEAKAGE_VECTORS
+    uint32_t i, count = 0;
+
+    for (i = 0; i < LEAKAGE_VECTOR_COUNT; i++)
+    {
+        if (check1[i].expected_status != PSA_SUCCESS)
+        {
+            continue;
+        }
+
+        bench_crypto_key_name(check1[i].test_desc, leakage_names[count], sizeof(leakage_names[0]));
+        leakage_algs[count].name       = leakage_names[count];
+        leakage_algs[count].alg        = check1[i].alg;
+        leakage_algs[count].key_type   = check1[i].type;
+        /* The ciphertext is as long as the modulus */
+        leakage_algs[count].key_bits   = check1[i].input_length * 8;
+        leakage_algs[count].usage      = check1[i].usage_flags;
+        leakage_algs[count].key_data   = check1[i].data;
+        leakage_algs[count].key_length = check1[i].data_length;
+        leakage_algs[count].param      = i;
+        count++;
+    }
+
+    return bench_crypto_leakage_sweep(val, "asymmetric_decrypt", "last byte", leakage_algs, count,
+                                      decrypt_prepare, asymmetric_decrypt_op);
+#else
+    return bench_crypto_leakage_sweep(val, "asymmetric_decrypt", "last byte", NULL, 0,
+                                      NULL, NULL);
+#endif
+}
@@ -0,0 +1,46 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "bench_crypto_common.h"
+
+static const bench_crypto_alg_t check1[] = {
+#ifdef ARCH_TEST_AES
+#ifdef ARCH_TEST_CCM
+#ifdef ARCH_TEST_AES_128
+{"CCM(AES_128)", PSA_ALG_CCM, PSA_KEY_TYPE_AES, 128, PSA_KEY_USAGE_ENCRYPT, NULL, 0, 0, 0},
+#endif
+#ifdef ARCH_TEST_AES_192
+{"CCM(AES_192)", PSA_ALG_CCM, PSA_KEY_TYPE_AES, 192, PSA_KEY_USAGE_ENCRYPT, NULL, 0, 0, 0},
+#endif
+#ifdef ARCH_TEST_AES_256
+{"CCM(AES_256)", PSA_ALG_CCM, PSA_KEY_TYPE_AES, 256, PSA_KEY_USAGE_ENCRYPT, NULL, 0, 0, 0},
+#endif
+#endif
+
+#ifdef ARCH_TEST_GCM
+#ifdef ARCH_TEST_AES_128
+{"GCM(AES_128)", PSA_ALG_GCM, PSA_KEY_TYPE_AES, 128, PSA_KEY_USAGE_ENCRYPT, NULL, 0, 0, 0},
+#endif
+#ifdef ARCH_TEST_AES_192
+{"GCM(AES_192)", PSA_ALG_GCM, PSA_KEY_TYPE_AES, 192, PSA_KEY_USAGE_ENCRYPT, NULL, 0, 0, 0},
+#endif
+#ifdef ARCH_TEST_AES_256
+{"GCM(AES_256)", PSA_ALG_GCM, PSA_KEY_TYPE_AES, 256, PSA_KEY_USAGE_ENCRYPT, NULL, 0, 0, 0},
+#endif
+#endif
+#endif
+};
@@ -0,0 +1,488 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_b032.h"
+#include "test_data.h"
+
+const client_test_t test_b032_crypto_list[] = {
+    NULL,
+    psa_stream_bench,
+    NULL,
+};
+
+#ifdef STREAM_HASH
+
+/* Update size of the streamed operations */
+#define STREAM_UPDATE_SIZE  BENCH_CHUNK_PAYLOAD
+
+/* Context of a streamed operation. The message is too large to be kept, the
+ * output of the cipher and AEAD updates is hashed as it is produced.
+ */
+typedef struct {
+    const bench_crypto_alg_t *alg;
+    psa_key_id_t              key;
+    uint64_t                  size;       /* Message length */
+    psa_hash_operation_t      hash;
+    psa_mac_operation_t       mac;
+    psa_cipher_operation_t    cipher;
+    psa_aead_operation_t      aead;
+    psa_hash_operation_t      digest;     /* Digest of the output */
+    size_t                    length;     /* Output length of the last update */
+    uint8_t                   result[PSA_HASH_LENGTH(PSA_ALG_SHA_256)];
+    size_t                    result_length;
+    uint8_t                   tag[BENCH_TAG_SIZE];
+    size_t                    tag_length;
+} stream_ctx_t;
+
+/* Streamed operation, its steps are called with a stream_ctx_t context */
+typedef struct {
+    const char          *op;        /* Measured API, e.g. "hash_update" */
+    bench_crypto_alg_t   alg;
+    stream_ref_index_t   ref;       /* Reference result */
+    val_bench_op_t       setup;     /* Untimed, starts the operation */
+    val_bench_update_t   update;    /* Measured update */
+    val_bench_op_t       teardown;  /* Untimed, after each update, NULL if none */
+    val_bench_op_t       finish;    /* Untimed, writes the result */
+} stream_op_t;
+
+static stream_ctx_t stream_ctx;
+
+#if defined(STREAM_CIPHER) || defined(STREAM_AEAD)
+/**
+    @brief    - Starts hashing the output of the operation
+    @param    - ctx : stream_ctx_t context
+    @return   - PSA status
+**/
+static int32_t stream_digest_setup(stream_ctx_t *ctx)
+{
+    return val->crypto->hash_setup(&ctx->digest, PSA_ALG_SHA_256);
+}
+
+/**
+    @brief    - Hashes the output of the last update, untimed
+    @param    - arg : stream_ctx_t context
+    @return   - PSA status
+**/
+static int32_t stream_digest_output(void *arg)
+{
+    stream_ctx_t *ctx = (stream_ctx_t *)arg;
+
+    return val->crypto->hash_update(&ctx->digest, bench_output, ctx->length);
+}
+
+/**
+    @brief    - Hashes the output of the finish step and writes the digest of
+                the whole output as the result
+    @param    - ctx : stream_ctx_t context
+    @return   - PSA status
+**/
+static int32_t stream_digest_finish(stream_ctx_t *ctx)
+{
+    int32_t status;
+
+    status = stream_digest_output(ctx);
+    if (status == PSA_SUCCESS)
+    {
+        status = val->crypto->hash_finish(&ctx->digest, ctx->result, sizeof(ctx->result),
+                                          &ctx->result_length);
+    }
+    return status;
+}
+#endif
+
+/**
+    @brief    - Starts a SHA-256 hash of the message
+    @param    - arg : stream_ctx_t context
+    @return   - PSA status
+**/
+static int32_t hash_stream_setup(void *arg)
+{
+    stream_ctx_t *ctx = (stream_ctx_t *)arg;
+
+    return val->crypto->hash_setup(&ctx->hash, ctx->alg->alg);
+}
+
+/**
+    @brief    - Measured update, psa_hash_update of the next part of the message
+    @param    - arg    : stream_ctx_t context
+                data   : Next part of the message
+                length : Length of the part
+    @return   - PSA status
+**/
+static int32_t hash_stream_update(void *arg, const uint8_t *data, size_t length)
+{
+    stream_ctx_t *ctx = (stream_ctx_t *)arg;
+
+    return val->crypto->hash_update(&ctx->hash, data, length);
+}
+
+/**
+    @brief    - Writes the hash of the message as the result
+    @param    - arg : stream_ctx_t context
+    @return   - PSA status
+**/
+static int32_t hash_stream_finish(void *arg)
+{
+    stream_ctx_t *ctx = (stream_ctx_t *)arg;
+
+    return val->crypto->hash_finish(&ctx->hash, ctx->result, sizeof(ctx->result),
+                                    &ctx->result_length);
+}
+
+#ifdef STREAM_MAC
+/**
+    @brief    - Starts a MAC of the message
+    @param    - arg : stream_ctx_t context
+    @return   - PSA status
+**/
+static int32_t mac_stream_setup(void *arg)
+{
+    stream_ctx_t *ctx = (stream_ctx_t *)arg;
+
+    return val->crypto->mac_sign_setup(&ctx->mac, ctx->key, ctx->alg->alg);
+}
+
+/**
+    @brief    - Measured update, psa_mac_update of the next part of the message
+    @param    - arg    : stream_ctx_t context
+                data   : Next part of the message
+                length : Length of the part
+    @return   - PSA status
+**/
+static int32_t mac_stream_update(void *arg, const uint8_t *data, size_t length)
+{
+    stream_ctx_t *ctx = (stream_ctx_t *)arg;
+
+    return val->crypto->mac_update(&ctx->mac, data, length);
+}
+
+/**
+    @brief    - Writes the MAC of the message as the result
+    @param    - arg : stream_ctx_t context
+    @return   - PSA status
+**/
+static int32_t mac_stream_finish(void *arg)
+{
+    stream_ctx_t *ctx = (stream_ctx_t *)arg;
+
+    return val->crypto->mac_sign_finish(&ctx->mac, ctx->result, sizeof(ctx->result),
+                                        &ctx->result_length);
+}
+#endif
+
+#ifdef STREAM_CIPHER
+/**
+    @brief    - Starts a cipher encryption of the message with stream_iv
+    @param    - arg : stream_ctx_t context
+    @return   - PSA status
+**/
+static int32_t cipher_stream_setup(void *arg)
+{
+    stream_ctx_t *ctx = (stream_ctx_t *)arg;
+    int32_t       status;
+
+    status = stream_digest_setup(ctx);
+    if (status == PSA_SUCCESS)
+    {
+        status = val->crypto->cipher_encrypt_setup(&ctx->cipher, ctx->key, ctx->alg->alg);
+    }
+
+    if (status == PSA_SUCCESS)
+    {
+        status = val->crypto->cipher_set_iv(&ctx->cipher, stream_iv, sizeof(stream_iv));
+    }
+    return status;
+}
+
+/**
+    @brief    - Measured update, psa_cipher_update of the next part of the
+                message into bench_output
+    @param    - arg    : stream_ctx_t context
+                data   : Next part of the message
+                length : Length of the part
+    @return   - PSA status
+**/
+static int32_t cipher_stream_update(void *arg, const uint8_t *data, size_t length)
+{
+    stream_ctx_t *ctx = (stream_ctx_t *)arg;
+
+    return val->crypto->cipher_update(&ctx->cipher, data, length, bench_output,
+                                      sizeof(bench_output), &ctx->length);
+}
+
+/**
+    @brief    - Writes the digest of the ciphertext as the result
+    @param    - arg : stream_ctx_t context
+    @return   - PSA status
+**/
+static int32_t cipher_stream_finish(void *arg)
+{
+    stream_ctx_t *ctx = (stream_ctx_t *)arg;
+    int32_t       status;
+
+    status = val->crypto->cipher_finish(&ctx->cipher, bench_output, sizeof(bench_output),
+                                        &ctx->length);
+    if (status == PSA_SUCCESS)
+    {
+        status = stream_digest_finish(ctx);
+    }
+    return status;
+}
+#endif
+
+#ifdef STREAM_AEAD
+/**
+    @brief    - Starts an AEAD encryption of the message with bench_nonce and
+                no additional data. The message length is given to the
+                operation when it fits in a size_t.
+    @param    - arg : stream_ctx_t context
+    @return   - PSA status
+**/
+static int32_t aead_stream_setup(void *arg)
+{
+    stream_ctx_t *ctx = (stream_ctx_t *)arg;
+    int32_t       status;
+
+    status = stream_digest_setup(ctx);
+    if (status == PSA_SUCCESS)
+    {
+        status = val->crypto->aead_encrypt_setup(&ctx->aead, ctx->key, ctx->alg->alg);
+    }
+
+    if ((status == PSA_SUCCESS) && ((uint64_t)(size_t)ctx->size == ctx->size))
+    {
+        status = val->crypto->aead_set_lengths(&ctx->aead, 0, (size_t)ctx->size);
+    }
+
+    if (status == PSA_SUCCESS)
+    {
+        status = val->crypto->aead_set_nonce(&ctx->aead, bench_nonce, sizeof(bench_nonce));
+    }
+    return status;
+}
+
+/**
+    @brief    - Measured update, psa_aead_update of the next part of the
+                message into bench_output
+    @param    - arg    : stream_ctx_t context
+                data   : Next part of the message
+                length : Length of the part
+    @return   - PSA status
+**/
+static int32_t aead_stream_update(void *arg, const uint8_t *data, size_t length)
+{
+    stream_ctx_t *ctx = (stream_ctx_t *)arg;
+
+    return val->crypto->aead_update(&ctx->aead, data, length, bench_output,
+                                    sizeof(bench_output), &ctx->length);
+}
+
+/**
+    @brief    - Writes the digest of the ciphertext as the result, and the tag
+    @param    - arg : stream_ctx_t context
+    @return   - PSA status
+**/
+static int32_t aead_stream_finish(void *arg)
+{
+    stream_ctx_t *ctx = (stream_ctx_t *)arg;
+    int32_t       status;
+
+    status = val->crypto->aead_finish(&ctx->aead, bench_output, sizeof(bench_output),
+                                      &ctx->length, ctx->tag, sizeof(ctx->tag),
+                                      &ctx->tag_length);
+    if (status == PSA_SUCCESS)
+    {
+        status = stream_digest_finish(ctx);
+    }
+    return status;
+}
+#endif
+
+static const stream_op_t stream_ops[] = {
+{"hash_update", {"SHA_256", PSA_ALG_SHA_256, PSA_KEY_TYPE_NONE, 0, 0, NULL, 0, 0, 0},
+ STREAM_REF_HASH, hash_stream_setup, hash_stream_update, NULL, hash_stream_finish},
+#ifdef STREAM_MAC
+{"mac_update", {"HMAC(SHA_256)", PSA_ALG_HMAC(PSA_ALG_SHA_256), PSA_KEY_TYPE_HMAC,
+ BYTES_TO_BITS(sizeof(stream_hmac_key)), PSA_KEY_USAGE_SIGN_HASH,
+ stream_hmac_key, sizeof(stream_hmac_key), 0, 0},
+ STREAM_REF_MAC, mac_stream_setup, mac_stream_update, NULL, mac_stream_finish},
+#endif
+#ifdef STREAM_CIPHER
+{"cipher_update", {"CTR(AES_128)", PSA_ALG_CTR, PSA_KEY_TYPE_AES,
+ BYTES_TO_BITS(sizeof(stream_aes_key)), PSA_KEY_USAGE_ENCRYPT,
+ stream_aes_key, sizeof(stream_aes_key), 0, 0},
+ STREAM_REF_CIPHER, cipher_stream_setup, cipher_stream_update, stream_digest_output,
+ cipher_stream_finish},
+#endif
+#ifdef STREAM_AEAD
+{"aead_update", {"GCM(AES_128)", PSA_ALG_GCM, PSA_KEY_TYPE_AES,
+ BYTES_TO_BITS(sizeof(stream_aes_key)), PSA_KEY_USAGE_ENCRYPT,
+ stream_aes_key, sizeof(stream_aes_key), 0, 0},
+ STREAM_REF_AEAD, aead_stream_setup, aead_stream_update, stream_digest_output,
+ aead_stream_finish},
+#endif
+};
+
+/**
+    @brief    - Aborts the operations of the context, a no-op for the
+                operations which are not active
+    @param    - ctx : stream_ctx_t context
+    @return   - None
+**/
+static void stream_abort(stream_ctx_t *ctx)
+{
+    val->crypto->hash_abort(&ctx->hash);
+    val->crypto->mac_abort(&ctx->mac);
+    val->crypto->cipher_abort(&ctx->cipher);
+    val->crypto->aead_abort(&ctx->aead);
+    val->crypto->hash_abort(&ctx->digest);
+}
+
+/**
+    @brief    - Returns the reference results of a message length
+    @param    - size : Message length
+    @return   - Reference results, NULL if the length has none
+**/
+static const stream_ref_t *stream_find_ref(uint64_t size)
+{
+    uint32_t i;
+
+    for (i = 0; i < sizeof(stream_refs)/sizeof(stream_refs[0]); i++)
+    {
+        if (stream_refs[i].size == size)
+        {
+            return &stream_refs[i];
+        }
+    }
+    return NULL;
+}
+
+int32_t psa_stream_bench(caller_security_t caller __UNUSED)
+{
+    const stream_op_t    *op;
+    const stream_ref_t   *ref;
+    val_bench_sample_t    sample;
+    uint64_t              size;
+    int32_t               status;
+    uint32_t              i;
+
+    if (val->bench_get_stream_size(&size) != VAL_STATUS_SUCCESS)
+    {
+        val->print(PRINT_TEST, "No stream size set by the platform\n", 0);
+        return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+    }
+
+    ref = stream_find_ref(size);
+    if (ref == NULL)
+    {
+        val->print(PRINT_WARN, "\tNo reference result for the stream size, results not checked\n",
+                   0);
+    }
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto->crypto_init();
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    for (i = 0; i < sizeof(stream_ops)/sizeof(stream_ops[0]); i++)
+    {
+        op = &stream_ops[i];
+        val->print(PRINT_TEST, "[Check %d] Benchmark ", i + 1);
+        val->print(PRINT_TEST, op->op, 0);
+        val->print(PRINT_TEST, " ", 0);
+        val->print(PRINT_TEST, op->alg.name, 0);
+        val->print(PRINT_TEST, "\n", 0);
+
+        memset(&stream_ctx, 0, sizeof(stream_ctx));
+        stream_ctx.alg    = &op->alg;
+        stream_ctx.size   = size;
+        stream_ctx.hash   = val->crypto->hash_operation_init();
+        stream_ctx.mac    = val->crypto->mac_operation_init();
+        stream_ctx.cipher = val->crypto->cipher_operation_init();
+        stream_ctx.aead   = val->crypto->aead_operation_init();
+        stream_ctx.digest = val->crypto->hash_operation_init();
+
+        status = bench_crypto_create_key(val, &op->alg, PSA_KEY_LIFETIME_VOLATILE,
+                                         &stream_ctx.key);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        status = op->setup(&stream_ctx);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
+
+        memset(&sample, 0, sizeof(sample));
+        sample.op           = op->op;
+        sample.alg_name     = op->alg.name;
+        sample.variant      = "stream";
+        sample.alg          = op->alg.alg;
+        sample.key_bits     = (uint32_t)op->alg.key_bits;
+        sample.size         = STREAM_UPDATE_SIZE;
+        sample.stream_bytes = size;
+        sample.teardown     = op->teardown;
+
+        status = val->bench_stream(&sample, op->update, &stream_ctx, bench_input);
+        if (status != VAL_STATUS_SUCCESS)
+        {
+            stream_abort(&stream_ctx);
+            if (IS_TEST_SKIP(status))
+            {
+                return status;
+            }
+        }
+        TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(4));
+
+        status = op->finish(&stream_ctx);
+        if (status != PSA_SUCCESS)
+        {
+            stream_abort(&stream_ctx);
+        }
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
+
+        if (ref != NULL)
+        {
+            TEST_ASSERT_EQUAL(stream_ctx.result_length, sizeof(ref->digest[op->ref]),
+                              TEST_CHECKPOINT_NUM(6));
+            TEST_ASSERT_MEMCMP(stream_ctx.result, ref->digest[op->ref],
+                               stream_ctx.result_length, TEST_CHECKPOINT_NUM(7));
+            if (op->ref == STREAM_REF_AEAD)
+            {
+                TEST_ASSERT_EQUAL(stream_ctx.tag_length, sizeof(ref->tag),
+                                  TEST_CHECKPOINT_NUM(8));
+                TEST_ASSERT_MEMCMP(stream_ctx.tag, ref->tag, stream_ctx.tag_length,
+                                   TEST_CHECKPOINT_NUM(9));
+            }
+        }
+
+        if (stream_ctx.key != 0)
+        {
+            status = val->crypto->destroy_key(stream_ctx.key);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(10));
+        }
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+#else
+
+int32_t psa_stream_bench(caller_security_t caller __UNUSED)
+{
+    val->print(PRINT_TEST, "No benchmark available for the selected crypto configuration\n", 0);
+    return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+}
+
+#endif /* STREAM_HASH */
@@ -0,0 +1,182 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "bench_crypto_common.h"
+
+/* Streamed operations of the crypto configuration. The outputs of the cipher
+ * and AEAD operations are checked through their SHA-256 digest, all of them
+ * need SHA-256.
+ */
+#ifdef ARCH_TEST_SHA256
+#define STREAM_HASH
+#ifdef ARCH_TEST_HMAC
+#define STREAM_MAC
+#endif
+#if defined(ARCH_TEST_AES) && defined(ARCH_TEST_AES_128)
+#ifdef ARCH_TEST_CTR_AES
+#define STREAM_CIPHER
+#endif
+#ifdef ARCH_TEST_GCM
+#define STREAM_AEAD
+#endif
+#endif
+#endif
+
+#ifdef STREAM_MAC
+/* HMAC key, the bytes 0x00 to 0x1F */
+static const uint8_t stream_hmac_key[] = {
+ 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+ 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F};
+#endif
+
+#if defined(STREAM_CIPHER) || defined(STREAM_AEAD)
+/* AES-128 key and CTR initial counter block of NIST SP 800-38A F.5.1. The GCM
+ * nonce is bench_nonce.
+ */
+static const uint8_t stream_aes_key[] = {
+ 0x2B, 0x7E, 0x15, 0x16, 0x28, 0xAE, 0xD2, 0xA6, 0xAB, 0xF7, 0x15, 0x88, 0x09, 0xCF, 0x4F, 0x3C};
+#endif
+
+#ifdef STREAM_CIPHER
+static const uint8_t stream_iv[] = {
+ 0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF};
+#endif
+
+#ifdef STREAM_HASH
+/* Reference digest of each streamed operation */
+typedef enum {
+    STREAM_REF_HASH   = 0,      /* SHA-256 of the message */
+    STREAM_REF_MAC    = 1,      /* HMAC(SHA_256) of the message */
+    STREAM_REF_CIPHER = 2,      /* SHA-256 of the CTR(AES_128) ciphertext */
+    STREAM_REF_AEAD   = 3,      /* SHA-256 of the GCM(AES_128) ciphertext */
+    STREAM_REF_COUNT  = 4,
+} stream_ref_index_t;
+
+/* Reference results of the streamed operations, for the message sizes most
+ * likely to be run. The message is the seekable pseudo-random stream of
+ * val_bench_stream. The outputs of the cipher and AEAD operations are checked
+ * through their SHA-256 digest.
+ */
+typedef struct {
+    uint64_t size;
+    uint8_t  digest[STREAM_REF_COUNT][PSA_HASH_LENGTH(PSA_ALG_SHA_256)];
+    uint8_t  tag[BENCH_TAG_SIZE];
+} stream_ref_t;
+
+static const stream_ref_t stream_refs[] = {
+/* 1 MiB */
+{0x100000ULL,
+ {{0xe8, 0x16, 0xb7, 0x9f, 0xae, 0x9f, 0xa3, 0xdd,
+   0xc9, 0x15, 0x8a, 0x01, 0xbe, 0xcf, 0xc8, 0xe5,
+   0x6a, 0x47, 0xd2, 0x88, 0x4d, 0x9b, 0x5c, 0x93,
+   0xf0, 0x2e, 0x31, 0x6b, 0x1b, 0xf2, 0x8a, 0x5c},
+  {0xf6, 0x2f, 0x09, 0xc4, 0x99, 0xc1, 0xe2, 0xaf,
+   0xfb, 0x59, 0x25, 0x9c, 0x0a, 0xa5, 0xb9, 0xe1,
+   0x84, 0x65, 0x35, 0xf2, 0x31, 0x00, 0x9a, 0x5b,
+   0x57, 0x06, 0xfe, 0x0d, 0xb7, 0x82, 0x35, 0x5a},
+  {0x73, 0x92, 0x94, 0xb7, 0xbb, 0x44, 0xe5, 0x37,
+   0x5c, 0xa4, 0xd2, 0xf7, 0x44, 0x41, 0xa8, 0x35,
+   0x56, 0x8d, 0x80, 0xad, 0x40, 0x8e, 0x7a, 0x67,
+   0x11, 0x0a, 0x95, 0xf1, 0x69, 0x18, 0x1d, 0x96},
+  {0x48, 0x8e, 0x93, 0xef, 0x5a, 0xf5, 0xdd, 0xef,
+   0xec, 0x15, 0x37, 0x01, 0xa4, 0x15, 0xd6, 0xfb,
+   0xae, 0xea, 0xff, 0xf9, 0xf8, 0xcc, 0x3a, 0x52,
+   0xf9, 0x0a, 0x57, 0xf9, 0xed, 0x62, 0x16, 0x38}},
+ {0xc9, 0xfb, 0xfc, 0x03, 0x9a, 0xb9, 0x71, 0xe4,
+  0x9f, 0x87, 0x50, 0x9d, 0xeb, 0x8a, 0xdc, 0xc0}},
+/* 512 MiB, 2^32 bits */
+{0x20000000ULL,
+ {{0x90, 0xec, 0xd1, 0x7f, 0x31, 0x19, 0x72, 0x5b,
+   0x56, 0x43, 0xaa, 0x1f, 0x73, 0x0d, 0xf7, 0xc4,
+   0xbb, 0x3e, 0x4a, 0x19, 0x06, 0x0c, 0xb5, 0x22,
+   0x4c, 0x64, 0x4c, 0x98, 0x14, 0xd0, 0xe7, 0x9c},
+  {0xff, 0x14, 0x18, 0xd5, 0xcb, 0xac, 0x2b, 0xcd,
+   0x64, 0x84, 0xf5, 0x0d, 0x5f, 0xe3, 0x86, 0x1e,
+   0x24, 0x28, 0xd5, 0x94, 0xf5, 0xb6, 0xfc, 0x7d,
+   0xc2, 0x11, 0xd7, 0x65, 0xc8, 0x03, 0xc4, 0x73},
+  {0x7c, 0x36, 0xb2, 0x67, 0xdf, 0x0b, 0x25, 0x63,
+   0xb0, 0x8f, 0xea, 0x39, 0x13, 0x73, 0x26, 0xc8,
+   0x7c, 0x49, 0x24, 0x23, 0x76, 0x71, 0x52, 0x95,
+   0x39, 0x34, 0xad, 0xb9, 0x82, 0xeb, 0x7d, 0x3e},
+  {0xd8, 0x99, 0x3c, 0x40, 0xcd, 0x4b, 0xdd, 0xde,
+   0xfd, 0x47, 0x6a, 0xf8, 0x46, 0xfb, 0xa1, 0x03,
+   0x9b, 0x11, 0x0d, 0xcc, 0x15, 0x70, 0x90, 0x4e,
+   0xfc, 0x59, 0x5b, 0x6d, 0x06, 0x72, 0x57, 0xfb}},
+ {0x05, 0xf8, 0xd4, 0x59, 0x50, 0xf1, 0x5b, 0x3a,
+  0x0a, 0x35, 0x40, 0xa8, 0x89, 0xa8, 0xd3, 0x42}},
+/* 4 GiB, the first length past 32 bits */
+{0x100000000ULL,
+ {{0x94, 0x74, 0x59, 0x17, 0xce, 0x6d, 0xe6, 0xa0,
+   0x30, 0x5b, 0xd8, 0x0a, 0xb3, 0x2b, 0x58, 0x7c,
+   0x51, 0x61, 0xfa, 0xc4, 0x32, 0x90, 0x4d, 0xd8,
+   0xd5, 0x7b, 0xea, 0x1e, 0xa5, 0x40, 0x5b, 0x46},
+  {0x18, 0xdc, 0xa4, 0x40, 0xb4, 0x71, 0xb7, 0x0a,
+   0x87, 0x84, 0x1d, 0xb9, 0xf7, 0xb2, 0x11, 0x61,
+   0xff, 0xdb, 0x28, 0x12, 0x72, 0x37, 0xd9, 0xec,
+   0xba, 0x9e, 0xbe, 0x86, 0x06, 0xf8, 0xdf, 0xb8},
+  {0x01, 0xe3, 0x06, 0x0c, 0xa2, 0x7d, 0xd3, 0x63,
+   0x5d, 0xa1, 0x86, 0x97, 0x4f, 0x00, 0xc1, 0xce,
+   0xb5, 0x6d, 0xb0, 0xb9, 0xff, 0xf9, 0x42, 0x9e,
+   0xac, 0x6e, 0xef, 0x69, 0x53, 0xa0, 0x7f, 0x3c},
+  {0x77, 0x47, 0x14, 0x09, 0xa6, 0x02, 0xad, 0x47,
+   0x0e, 0x25, 0xac, 0x19, 0xaf, 0x87, 0x3c, 0xa3,
+   0x38, 0xe0, 0x52, 0x9d, 0x14, 0xff, 0x4f, 0xbc,
+   0x8d, 0x61, 0x83, 0xe7, 0x06, 0x7c, 0xe9, 0x05}},
+ {0x7f, 0x17, 0x56, 0xb2, 0xc9, 0x1e, 0x7c, 0xf5,
+  0xcd, 0x45, 0x37, 0x91, 0x54, 0xd0, 0x8f, 0xf1}},
+/* 5 GiB */
+{0x140000000ULL,
+ {{0x92, 0xa0, 0xe2, 0xf4, 0xb3, 0xd8, 0xc1, 0xe8,
+   0x1b, 0xec, 0x78, 0x14, 0x40, 0x62, 0x11, 0xb5,
+   0x8a, 0x1b, 0x16, 0x3d, 0x91, 0xb6, 0xe6, 0xbc,
+   0xaf, 0x36, 0x75, 0x7e, 0xa1, 0x9a, 0xb0, 0x7e},
+  {0x13, 0x82, 0x2e, 0xd2, 0x8b, 0xc5, 0x85, 0x6c,
+   0xf4, 0xdb, 0xbb, 0x50, 0xa4, 0xe9, 0x5c, 0xa7,
+   0x30, 0x9c, 0x2d, 0xa2, 0x3a, 0x25, 0xf9, 0x0f,
+   0xf3, 0x71, 0x4b, 0x74, 0x27, 0x11, 0xc9, 0xeb},
+  {0xef, 0x97, 0xe9, 0x07, 0xd5, 0xc9, 0xcc, 0x2b,
+   0xa7, 0xd0, 0x75, 0xce, 0x57, 0x6c, 0xc0, 0x74,
+   0x79, 0x07, 0xba, 0x56, 0x03, 0x79, 0xe5, 0xe4,
+   0x8b, 0x64, 0x36, 0x52, 0x71, 0xbc, 0xc9, 0x1b},
+  {0xe9, 0xd8, 0xca, 0x33, 0x48, 0xea, 0x73, 0x3d,
+   0xe7, 0x9d, 0x79, 0x0e, 0xf3, 0x76, 0x85, 0x99,
+   0xec, 0x5a, 0x11, 0x17, 0x21, 0xb1, 0xb3, 0x29,
+   0x30, 0x5a, 0xb4, 0xdb, 0x73, 0x9a, 0xe9, 0x48}},
+ {0x76, 0xc4, 0x5b, 0xb8, 0x1e, 0x42, 0x0b, 0x87,
+  0x6e, 0x0a, 0x07, 0x8d, 0x23, 0xf3, 0x0f, 0x49}},
+/* 4 GiB + 1027 bytes, ending in a partial update and block */
+{0x100000403ULL,
+ {{0x80, 0x57, 0xf8, 0x17, 0x8f, 0x73, 0xf5, 0x34,
+   0xfe, 0x35, 0xfb, 0xe6, 0xfc, 0xf2, 0x1f, 0x94,
+   0xff, 0x2e, 0x76, 0x72, 0xed, 0xf6, 0xfb, 0xc7,
+   0x2b, 0xa7, 0x74, 0x9d, 0xca, 0x2d, 0x4a, 0x3b},
+  {0x70, 0x11, 0xbd, 0x15, 0x37, 0xd0, 0xfb, 0xd1,
+   0x2f, 0xb1, 0x8b, 0x84, 0x9c, 0x32, 0xe5, 0x6d,
+   0xa1, 0xb1, 0x7f, 0xad, 0x53, 0x04, 0x26, 0xb0,
+   0x0b, 0x57, 0xe8, 0x4a, 0xa7, 0x53, 0x61, 0xe6},
+  {0xb2, 0x29, 0xe7, 0x9d, 0x3a, 0x27, 0x2e, 0xec,
+   0x5c, 0xca, 0x56, 0xeb, 0xba, 0xfa, 0x76, 0x8f,
+   0x14, 0xbd, 0xb3, 0x15, 0xaa, 0x65, 0xa5, 0xb6,
+   0x3f, 0xd3, 0x59, 0x4a, 0xfb, 0x47, 0x0e, 0x89},
+  {0xc0, 0xd5, 0x54, 0xd8, 0x5f, 0xf4, 0xc2, 0x4c,
+   0x23, 0xbc, 0xc3, 0x26, 0xff, 0x83, 0x07, 0x94,
+   0x2f, 0x6f, 0x46, 0xb2, 0x2d, 0x3e, 0x54, 0x4c,
+   0xec, 0xf8, 0xeb, 0x0d, 0x2a, 0x48, 0xf0, 0x05}},
+ {0xc6, 0x69, 0x60, 0x4a, 0xf2, 0x71, 0xcf, 0x33,
+  0xb3, 0x26, 0xac, 0x3f, 0xc0, 0x93, 0xcd, 0x84}},
+};
+#endif
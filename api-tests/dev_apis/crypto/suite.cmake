@@ -58,4 +58,5 @@ target_include_directories(${PSA_TARGET_TEST_COMBINE_LIB} PRIVATE
 	${PSA_ROOT_DIR}/platform/targets/common/nspe/crypto
 	${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe
 	${PSA_SUITE_DIR}/common/
+	${PSA_SUITE_DIR}/
 )
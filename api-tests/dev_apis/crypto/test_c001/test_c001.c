@@ -35,7 +35,7 @@ int32_t psa_generate_random_without_init_test(caller_security_t caller __UNUSED)
     val->print(PRINT_TEST, "[Check 1] Test calling crypto functions before psa_crypto_init\n", 0);
 
     /* Generate random bytes */
-    status = val->crypto_function(VAL_CRYPTO_GENERATE_RANDOM, output, GENERATE_SIZE);
+    status = val->crypto->generate_random(output, GENERATE_SIZE);
     if (status == PSA_SUCCESS)
         return VAL_STATUS_SUCCESS;
     else
@@ -51,7 +51,7 @@ int32_t psa_crypto_init_test(caller_security_t caller __UNUSED)
     val->print(PRINT_TEST, "[Check 2] Test psa_crypto_init\n", 0);
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     return VAL_STATUS_SUCCESS;
@@ -65,7 +65,7 @@ int32_t multiple_psa_crypto_init_test(caller_security_t caller __UNUSED)
     for (i = 0; i < 5; i++)
     {
         /* Initialize the PSA crypto library*/
-        status = val->crypto_function(VAL_CRYPTO_INIT);
+        status = val->crypto->crypto_init();
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
     }
 
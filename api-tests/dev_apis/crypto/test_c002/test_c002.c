@@ -43,7 +43,7 @@ int32_t psa_import_key_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     /* Set the key data buffer to the input base on algorithm */
@@ -57,12 +57,12 @@ int32_t psa_import_key_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Setup the attributes for the key */
-        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE, &attributes, check1[i].type);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_BITS, &attributes, check1[i].bits);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes, check1[i].usage_flags);
+        val->crypto->set_key_type(&attributes, check1[i].type);
+        val->crypto->set_key_bits(&attributes, check1[i].bits);
+        val->crypto->set_key_usage_flags(&attributes, check1[i].usage_flags);
 
         /* Import the key data into the key slot */
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].data,
+        status = val->crypto->import_key(&attributes, check1[i].data,
                  check1[i].data_length, &key);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(3));
 
@@ -71,23 +71,23 @@ int32_t psa_import_key_test(caller_security_t caller __UNUSED)
             continue;
 
         /* Get the attributes of the imported key and check if it matches the given value */
-        status = val->crypto_function(VAL_CRYPTO_GET_KEY_ATTRIBUTES, key,
+        status = val->crypto->get_key_attributes(key,
                  &get_attributes);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
 
-        val->crypto_function(VAL_CRYPTO_GET_KEY_TYPE, &get_attributes, &get_type);
+        get_type = val->crypto->get_key_type(&get_attributes);
         TEST_ASSERT_EQUAL(get_type, check1[i].type, TEST_CHECKPOINT_NUM(5));
 
-        val->crypto_function(VAL_CRYPTO_GET_KEY_BITS, &get_attributes, &get_bits);
+        get_bits = val->crypto->get_key_bits(&get_attributes);
         TEST_ASSERT_EQUAL(get_bits, check1[i].bits, TEST_CHECKPOINT_NUM(6));
 
         /* Reset the key attributes and check if psa_import_key fails */
-        val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &attributes);
+        val->crypto->reset_key_attributes(&attributes);
 
-        val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+        val->crypto->destroy_key(key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(7));
 
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].data,
+        status = val->crypto->import_key(&attributes, check1[i].data,
                  check1[i].data_length, &key);
         TEST_ASSERT_NOT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
 
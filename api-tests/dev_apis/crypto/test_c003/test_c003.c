@@ -41,7 +41,7 @@ int32_t psa_export_key_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     /* Set the key data buffer to the input base on algorithm */
@@ -57,29 +57,27 @@ int32_t psa_export_key_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Setup the attributes for the key */
-        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE, &attributes, check1[i].type);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_BITS, &attributes, check1[i].bits);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes, check1[i].usage_flags);
+        val->crypto->set_key_type(&attributes, check1[i].type);
+        val->crypto->set_key_bits(&attributes, check1[i].bits);
+        val->crypto->set_key_usage_flags(&attributes, check1[i].usage_flags);
 
         /* Import the key data into the key slot */
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY,
-                                      &attributes, check1[i].data,
-                                      check1[i].data_length,
-                                      &key);
+        status = val->crypto->import_key(&attributes, check1[i].data,
+                                         check1[i].data_length,
+                                         &key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Export a key in binary format */
-        status = val->crypto_function(VAL_CRYPTO_EXPORT_KEY,
-                                      key,
-                                      check1[i].expected_data,
-                                      check1[i].data_size,
-                                      &expected_data_length);
+        status = val->crypto->export_key(key,
+                                         check1[i].expected_data,
+                                         check1[i].data_size,
+                                         &expected_data_length);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(4));
 
         /* If failure is expected, continue with the next data set */
         if (check1[i].expected_status != PSA_SUCCESS)
         {
-            status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+            status = val->crypto->destroy_key(key);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
             continue;
         }
@@ -92,14 +90,13 @@ int32_t psa_export_key_test(caller_security_t caller __UNUSED)
                                                      TEST_CHECKPOINT_NUM(7));
 
         /* Destroy the key handle and check if export key fails */
-        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+        status = val->crypto->destroy_key(key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
 
-        status = val->crypto_function(VAL_CRYPTO_EXPORT_KEY,
-                                      key,
-                                      check1[i].expected_data,
-                                      check1[i].data_size,
-                                      &expected_data_length);
+        status = val->crypto->export_key(key,
+                                         check1[i].expected_data,
+                                         check1[i].data_size,
+                                         &expected_data_length);
         TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_HANDLE, TEST_CHECKPOINT_NUM(9));
     }
 
@@ -49,7 +49,7 @@ int32_t psa_destroy_key_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     /* Set the key data buffer to the input base on algorithm */
@@ -63,51 +63,50 @@ int32_t psa_destroy_key_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Setup the attributes for the key */
-        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE,        &set_attributes, check1[i].type);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_BITS,        &set_attributes, check1[i].bits);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &set_attributes,
+        val->crypto->set_key_type(&set_attributes, check1[i].type);
+        val->crypto->set_key_bits(&set_attributes, check1[i].bits);
+        val->crypto->set_key_usage_flags(&set_attributes,
                                                              check1[i].usage_flags);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_ID, &set_attributes, check1[i].id);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_LIFETIME,    &set_attributes, check1[i].lifetime);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM,   &set_attributes, check1[i].alg);
+        val->crypto->set_key_id(&set_attributes, check1[i].id);
+        val->crypto->set_key_lifetime(&set_attributes, check1[i].lifetime);
+        val->crypto->set_key_algorithm(&set_attributes, check1[i].alg);
 
         /* Import the key data into the key slot */
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY,
-                                      &set_attributes,
-                                      check1[i].data,
-                                      check1[i].data_length,
-                                      &key);
+        status = val->crypto->import_key(&set_attributes,
+                                         check1[i].data,
+                                         check1[i].data_length,
+                                         &key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Destroy the key handle */
-        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+        status = val->crypto->destroy_key(key);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(4));
 
         /* Getting the attributes of the destroyed key should return error */
-        status = val->crypto_function(VAL_CRYPTO_GET_KEY_ATTRIBUTES, key, &attributes);
+        status = val->crypto->get_key_attributes(key, &attributes);
         TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_HANDLE, TEST_CHECKPOINT_NUM(5));
 
         /* Check if all the attributes are erased */
-        val->crypto_function(VAL_CRYPTO_GET_KEY_TYPE, &attributes, &get_type);
+        get_type = val->crypto->get_key_type(&attributes);
         TEST_ASSERT_EQUAL(get_type, 0, TEST_CHECKPOINT_NUM(6));
 
-        val->crypto_function(VAL_CRYPTO_GET_KEY_ID, &attributes, &get_id);
+        get_id = val->crypto->get_key_id(&attributes);
         TEST_ASSERT_EQUAL(get_id, 0, TEST_CHECKPOINT_NUM(7));
 
-        val->crypto_function(VAL_CRYPTO_GET_KEY_LIFETIME, &attributes, &get_lifetime);
+        get_lifetime = val->crypto->get_key_lifetime(&attributes);
         TEST_ASSERT_EQUAL(get_lifetime, 0, TEST_CHECKPOINT_NUM(8));
 
-        val->crypto_function(VAL_CRYPTO_GET_KEY_USAGE_FLAGS, &attributes, &get_usage_flags);
+        get_usage_flags = val->crypto->get_key_usage_flags(&attributes);
         TEST_ASSERT_EQUAL(get_usage_flags, 0, TEST_CHECKPOINT_NUM(9));
 
-        val->crypto_function(VAL_CRYPTO_GET_KEY_ALGORITHM, &attributes, &get_alg);
+        get_alg = val->crypto->get_key_algorithm(&attributes);
         TEST_ASSERT_EQUAL(get_alg, 0, TEST_CHECKPOINT_NUM(10));
 
-        val->crypto_function(VAL_CRYPTO_GET_KEY_BITS, &attributes, &get_bits);
+        get_bits = val->crypto->get_key_bits(&attributes);
         TEST_ASSERT_EQUAL(get_bits,  0, TEST_CHECKPOINT_NUM(11));
 
         /* Destroying an empty key handle should return error */
-        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+        status = val->crypto->destroy_key(key);
         TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_HANDLE, TEST_CHECKPOINT_NUM(12));
 
         if (valid_test_input_index < 0)
@@ -127,7 +126,7 @@ int32_t psa_destroy_key_test_invalid_key_identifier(caller_security_t caller __U
         return RESULT_SKIP(VAL_STATUS_NO_TESTS);
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
@@ -138,45 +137,38 @@ int32_t psa_destroy_key_test_invalid_key_identifier(caller_security_t caller __U
     TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
     /* Setup the attributes for the key */
-    val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE,
-                         &set_attributes,
-                         check1[valid_test_input_index].type);
-    val->crypto_function(VAL_CRYPTO_SET_KEY_BITS,
-                         &set_attributes,
-                         check1[valid_test_input_index].bits);
-    val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS,
-                         &set_attributes,
-                         check1[valid_test_input_index].usage_flags);
-    val->crypto_function(VAL_CRYPTO_SET_KEY_ID,
-                         &set_attributes,
-                         check1[valid_test_input_index].id);
-    val->crypto_function(VAL_CRYPTO_SET_KEY_LIFETIME,
-                         &set_attributes,
-                         check1[valid_test_input_index].lifetime);
-    val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM,
-                         &set_attributes,
-                         check1[valid_test_input_index].alg);
+    val->crypto->set_key_type(&set_attributes,
+                              check1[valid_test_input_index].type);
+    val->crypto->set_key_bits(&set_attributes,
+                              check1[valid_test_input_index].bits);
+    val->crypto->set_key_usage_flags(&set_attributes,
+                                     check1[valid_test_input_index].usage_flags);
+    val->crypto->set_key_id(&set_attributes,
+                            check1[valid_test_input_index].id);
+    val->crypto->set_key_lifetime(&set_attributes,
+                                  check1[valid_test_input_index].lifetime);
+    val->crypto->set_key_algorithm(&set_attributes,
+                                   check1[valid_test_input_index].alg);
 
     /* Import the key data into the key slot */
-    status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY,
-                                  &set_attributes,
-                                  check1[valid_test_input_index].data,
-                                  check1[valid_test_input_index].data_length,
-                                  &key);
+    status = val->crypto->import_key(&set_attributes,
+                                     check1[valid_test_input_index].data,
+                                     check1[valid_test_input_index].data_length,
+                                     &key);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
     /* Destroy the key handle - with PSA_KEY_ID_NULL */
-    status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, PSA_KEY_ID_NULL);
+    status = val->crypto->destroy_key(PSA_KEY_ID_NULL);
     TEST_ASSERT_EQUAL(status, check1[valid_test_input_index].expected_status,
                       TEST_CHECKPOINT_NUM(4));
 
     /* Destroy the key handle */
-    status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+    status = val->crypto->destroy_key(key);
     TEST_ASSERT_EQUAL(status, check1[valid_test_input_index].expected_status,
                       TEST_CHECKPOINT_NUM(5));
 
     /* Destroy the key handle */
-    status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, PSA_KEY_ID_NULL);
+    status = val->crypto->destroy_key(PSA_KEY_ID_NULL);
     TEST_ASSERT_EQUAL(status, check1[valid_test_input_index].expected_status,
                       TEST_CHECKPOINT_NUM(6));
 
@@ -39,7 +39,7 @@ int32_t psa_hash_compute_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     for (i = 0; i < num_checks; i++)
@@ -52,13 +52,12 @@ int32_t psa_hash_compute_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Calculate the hash (digest) of a message */
-        status = val->crypto_function(VAL_CRYPTO_HASH_COMPUTE,
-                                      check1[i].alg,
-                                      check1[i].input,
-                                      check1[i].input_length,
-                                      check1[i].hash,
-                                      check1[i].hash_size,
-                                      &expected_hash_length);
+        status = val->crypto->hash_compute(check1[i].alg,
+                                           check1[i].input,
+                                           check1[i].input_length,
+                                           check1[i].hash,
+                                           check1[i].hash_size,
+                                           &expected_hash_length);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(3));
 
         if (check1[i].expected_status != PSA_SUCCESS)
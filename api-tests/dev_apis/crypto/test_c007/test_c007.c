@@ -38,7 +38,7 @@ int32_t psa_hash_compare_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     for (i = 0; i < num_checks; i++)
@@ -51,12 +51,11 @@ int32_t psa_hash_compare_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Calculate the hash (digest) of a message and compare it with a reference value */
-        status = val->crypto_function(VAL_CRYPTO_HASH_COMPARE,
-                                      check1[i].alg,
-                                      check1[i].input,
-                                      check1[i].input_length,
-                                      check1[i].hash,
-                                      check1[i].hash_length);
+        status = val->crypto->hash_compare(check1[i].alg,
+                                           check1[i].input,
+                                           check1[i].input_length,
+                                           check1[i].hash,
+                                           check1[i].hash_length);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(3));
     }
 
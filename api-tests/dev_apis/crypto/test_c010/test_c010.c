@@ -45,7 +45,7 @@ int32_t psa_key_attributes_set_get_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     /* Set the key data buffer to the input base on algorithm */
@@ -59,71 +59,71 @@ int32_t psa_key_attributes_set_get_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Check if all the attributes are initialized to zero */
-        val->crypto_function(VAL_CRYPTO_GET_KEY_TYPE, &attributes, &get_type);
+        get_type = val->crypto->get_key_type(&attributes);
         TEST_ASSERT_EQUAL(get_type, 0, TEST_CHECKPOINT_NUM(3));
 
-        val->crypto_function(VAL_CRYPTO_GET_KEY_ID, &attributes, &get_id);
+        get_id = val->crypto->get_key_id(&attributes);
         TEST_ASSERT_EQUAL(get_id, 0, TEST_CHECKPOINT_NUM(4));
 
-        val->crypto_function(VAL_CRYPTO_GET_KEY_LIFETIME, &attributes, &get_lifetime);
+        get_lifetime = val->crypto->get_key_lifetime(&attributes);
         TEST_ASSERT_EQUAL(get_lifetime, 0, TEST_CHECKPOINT_NUM(5));
 
-        val->crypto_function(VAL_CRYPTO_GET_KEY_USAGE_FLAGS, &attributes, &get_usage_flags);
+        get_usage_flags = val->crypto->get_key_usage_flags(&attributes);
         TEST_ASSERT_EQUAL(get_usage_flags, 0, TEST_CHECKPOINT_NUM(6));
 
-        val->crypto_function(VAL_CRYPTO_GET_KEY_ALGORITHM, &attributes, &get_alg);
+        get_alg = val->crypto->get_key_algorithm(&attributes);
         TEST_ASSERT_EQUAL(get_alg, 0, TEST_CHECKPOINT_NUM(7));
 
-        val->crypto_function(VAL_CRYPTO_GET_KEY_BITS, &attributes, &get_bits);
+        get_bits = val->crypto->get_key_bits(&attributes);
         TEST_ASSERT_EQUAL(get_bits,  0, TEST_CHECKPOINT_NUM(8));
 
        /* Setup the attributes for the key */
-        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE,        &attributes, check1[i].type);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_BITS,        &attributes, check1[i].bits);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes, check1[i].usage_flags);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_ID,          &attributes, check1[i].id);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_LIFETIME,    &attributes, check1[i].lifetime);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM,   &attributes, check1[i].alg);
+        val->crypto->set_key_type(&attributes, check1[i].type);
+        val->crypto->set_key_bits(&attributes, check1[i].bits);
+        val->crypto->set_key_usage_flags(&attributes, check1[i].usage_flags);
+        val->crypto->set_key_id(&attributes, check1[i].id);
+        val->crypto->set_key_lifetime(&attributes, check1[i].lifetime);
+        val->crypto->set_key_algorithm(&attributes, check1[i].alg);
 
         /* Check if all the attributes are as per the input */
-        val->crypto_function(VAL_CRYPTO_GET_KEY_TYPE, &attributes, &get_type);
+        get_type = val->crypto->get_key_type(&attributes);
         TEST_ASSERT_EQUAL(get_type, check1[i].type, TEST_CHECKPOINT_NUM(9));
 
-        val->crypto_function(VAL_CRYPTO_GET_KEY_ID, &attributes, &get_id);
+        get_id = val->crypto->get_key_id(&attributes);
         TEST_ASSERT_EQUAL(get_id, check1[i].id, TEST_CHECKPOINT_NUM(10));
 
-        val->crypto_function(VAL_CRYPTO_GET_KEY_LIFETIME, &attributes, &get_lifetime);
+        get_lifetime = val->crypto->get_key_lifetime(&attributes);
         TEST_ASSERT_EQUAL(get_lifetime, check1[i].lifetime, TEST_CHECKPOINT_NUM(11));
 
-        val->crypto_function(VAL_CRYPTO_GET_KEY_USAGE_FLAGS, &attributes, &get_usage_flags);
+        get_usage_flags = val->crypto->get_key_usage_flags(&attributes);
         TEST_ASSERT_EQUAL(get_usage_flags, check1[i].usage_flags, TEST_CHECKPOINT_NUM(12));
 
-        val->crypto_function(VAL_CRYPTO_GET_KEY_ALGORITHM, &attributes, &get_alg);
+        get_alg = val->crypto->get_key_algorithm(&attributes);
         TEST_ASSERT_EQUAL(get_alg, check1[i].alg, TEST_CHECKPOINT_NUM(13));
 
-        val->crypto_function(VAL_CRYPTO_GET_KEY_BITS, &attributes, &get_bits);
+        get_bits = val->crypto->get_key_bits(&attributes);
         TEST_ASSERT_EQUAL(get_bits,  check1[i].bits, TEST_CHECKPOINT_NUM(14));
 
         /* Reset the attributes */
-        val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &attributes);
+        val->crypto->reset_key_attributes(&attributes);
 
         /* Check if all the attributes are erased */
-        val->crypto_function(VAL_CRYPTO_GET_KEY_TYPE, &attributes, &get_type);
+        get_type = val->crypto->get_key_type(&attributes);
         TEST_ASSERT_EQUAL(get_type, 0, TEST_CHECKPOINT_NUM(15));
 
-        val->crypto_function(VAL_CRYPTO_GET_KEY_ID, &attributes, &get_id);
+        get_id = val->crypto->get_key_id(&attributes);
         TEST_ASSERT_EQUAL(get_id, 0, TEST_CHECKPOINT_NUM(16));
 
-        val->crypto_function(VAL_CRYPTO_GET_KEY_LIFETIME, &attributes, &get_lifetime);
+        get_lifetime = val->crypto->get_key_lifetime(&attributes);
         TEST_ASSERT_EQUAL(get_lifetime, 0, TEST_CHECKPOINT_NUM(17));
 
-        val->crypto_function(VAL_CRYPTO_GET_KEY_USAGE_FLAGS, &attributes, &get_usage_flags);
+        get_usage_flags = val->crypto->get_key_usage_flags(&attributes);
         TEST_ASSERT_EQUAL(get_usage_flags, 0, TEST_CHECKPOINT_NUM(18));
 
-        val->crypto_function(VAL_CRYPTO_GET_KEY_ALGORITHM, &attributes, &get_alg);
+        get_alg = val->crypto->get_key_algorithm(&attributes);
         TEST_ASSERT_EQUAL(get_alg, 0, TEST_CHECKPOINT_NUM(19));
 
-        val->crypto_function(VAL_CRYPTO_GET_KEY_BITS, &attributes, &get_bits);
+        get_bits = val->crypto->get_key_bits(&attributes);
         TEST_ASSERT_EQUAL(get_bits,  0, TEST_CHECKPOINT_NUM(20));
     }
 
@@ -39,7 +39,7 @@ int32_t psa_hash_setup_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     for (i = 0; i < num_checks; i++)
@@ -53,22 +53,19 @@ int32_t psa_hash_setup_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Start a multipart hash operation */
-        status = val->crypto_function(VAL_CRYPTO_HASH_SETUP,
-                                      &operation,
-                                      check1[i].alg);
+        status = val->crypto->hash_setup(&operation,
+                                         check1[i].alg);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(3));
 
         if (check1[i].expected_status == PSA_SUCCESS)
         {
             /* Start a multipart hash operation */
-            status = val->crypto_function(VAL_CRYPTO_HASH_SETUP,
-                                          &operation,
-                                          check1[i].alg);
+            status = val->crypto->hash_setup(&operation,
+                                             check1[i].alg);
             TEST_ASSERT_EQUAL(status, PSA_ERROR_BAD_STATE, TEST_CHECKPOINT_NUM(4));
 
             /*Abort the hash operation */
-            status = val->crypto_function(VAL_CRYPTO_HASH_ABORT,
-                                          &operation);
+            status = val->crypto->hash_abort(&operation);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
         }
     }
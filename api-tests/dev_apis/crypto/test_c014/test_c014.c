@@ -45,7 +45,7 @@ int32_t psa_hash_finish_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     for (i = 0; i < num_checks; i++)
@@ -59,17 +59,17 @@ int32_t psa_hash_finish_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Start a multipart hash operation */
-        status = val->crypto_function(VAL_CRYPTO_HASH_SETUP, &operation, check1[i].alg);
+        status = val->crypto->hash_setup(&operation, check1[i].alg);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Add a message fragment to a multipart hash operation */
-        status = val->crypto_function(VAL_CRYPTO_HASH_UPDATE, &operation,
-                                      check1[i].input, check1[i].input_length);
+        status = val->crypto->hash_update(&operation,
+                                          check1[i].input, check1[i].input_length);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
 
         /* Finish the calculation of the hash of a message */
-        status = val->crypto_function(VAL_CRYPTO_HASH_FINISH, &operation, check1[i].expected_hash,
-                                      check1[i].hash_size, &expected_hash_length);
+        status = val->crypto->hash_finish(&operation, check1[i].expected_hash,
+                                          check1[i].hash_size, &expected_hash_length);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(5));
 
         if (check1[i].expected_status == PSA_SUCCESS)
@@ -79,7 +79,7 @@ int32_t psa_hash_finish_test(caller_security_t caller __UNUSED)
                                expected_hash_length, TEST_CHECKPOINT_NUM(7));
         } else {
             /*Abort the hash operation */
-            status = val->crypto_function(VAL_CRYPTO_HASH_ABORT, &operation);
+            status = val->crypto->hash_abort(&operation);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
         }
 
@@ -100,7 +100,7 @@ int32_t psa_hash_finish_inactive_operation_handle(caller_security_t caller __UNU
         return RESULT_SKIP(VAL_STATUS_NO_TESTS);
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
@@ -111,35 +111,32 @@ int32_t psa_hash_finish_inactive_operation_handle(caller_security_t caller __UNU
     TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
     /* Start a multipart hash operation */
-    status = val->crypto_function(VAL_CRYPTO_HASH_SETUP, &operation,
-                                  check1[valid_test_input_index].alg);
+    status = val->crypto->hash_setup(&operation,
+                                     check1[valid_test_input_index].alg);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
     /* Add a message fragment to a multipart hash operation */
-    status = val->crypto_function(VAL_CRYPTO_HASH_UPDATE,
-                                  &operation,
-                                  check1[valid_test_input_index].input,
-                                  check1[valid_test_input_index].input_length);
+    status = val->crypto->hash_update(&operation,
+                                      check1[valid_test_input_index].input,
+                                      check1[valid_test_input_index].input_length);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
 
     /* Finish the calculation of the hash of a message */
-    status = val->crypto_function(VAL_CRYPTO_HASH_FINISH,
-                                  &operation,
-                                  check1[valid_test_input_index].expected_hash,
-                                  check1[valid_test_input_index].hash_size,
-                                  &expected_hash_length);
+    status = val->crypto->hash_finish(&operation,
+                                      check1[valid_test_input_index].expected_hash,
+                                      check1[valid_test_input_index].hash_size,
+                                      &expected_hash_length);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
     /* Retry the operation with completed operation handle */
-    status = val->crypto_function(VAL_CRYPTO_HASH_FINISH,
-                                  &operation,
-                                  check1[valid_test_input_index].expected_hash,
-                                  check1[valid_test_input_index].hash_size,
-                                  &expected_hash_length);
+    status = val->crypto->hash_finish(&operation,
+                                      check1[valid_test_input_index].expected_hash,
+                                      check1[valid_test_input_index].hash_size,
+                                      &expected_hash_length);
     TEST_ASSERT_EQUAL(status, PSA_ERROR_BAD_STATE, TEST_CHECKPOINT_NUM(6));
 
     /*Abort the hash operation */
-    status = val->crypto_function(VAL_CRYPTO_HASH_ABORT, &operation);
+    status = val->crypto->hash_abort(&operation);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(7));
 
     return VAL_STATUS_SUCCESS;
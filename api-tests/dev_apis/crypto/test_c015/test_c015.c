@@ -44,7 +44,7 @@ int32_t psa_hash_abort_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     for (i = 0; i < num_checks; i++)
@@ -58,15 +58,15 @@ int32_t psa_hash_abort_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Start a multipart hash operation */
-        status = val->crypto_function(VAL_CRYPTO_HASH_SETUP, &operation, check1[i].alg);
+        status = val->crypto->hash_setup(&operation, check1[i].alg);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Abort a hash operation */
-        status = val->crypto_function(VAL_CRYPTO_HASH_ABORT, &operation);
+        status = val->crypto->hash_abort(&operation);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(4));
 
         /* Multiple hash abort should succeed */
-        status = val->crypto_function(VAL_CRYPTO_HASH_ABORT, &operation);
+        status = val->crypto->hash_abort(&operation);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(5));
 
         if (valid_test_input_index < 0)
@@ -87,7 +87,7 @@ int32_t psa_hash_abort_before_operation_finish(caller_security_t caller __UNUSED
         return RESULT_SKIP(VAL_STATUS_NO_TESTS);
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
@@ -99,27 +99,25 @@ int32_t psa_hash_abort_before_operation_finish(caller_security_t caller __UNUSED
     TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
     /* Start a multipart hash operation */
-    status = val->crypto_function(VAL_CRYPTO_HASH_SETUP, &operation,
-                                  check1[valid_test_input_index].alg);
+    status = val->crypto->hash_setup(&operation,
+                                     check1[valid_test_input_index].alg);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
     /* Add a message fragment to a multipart hash operation */
-    status = val->crypto_function(VAL_CRYPTO_HASH_UPDATE,
-                                  &operation,
-                                  check1[valid_test_input_index].input,
-                                  check1[valid_test_input_index].input_length);
+    status = val->crypto->hash_update(&operation,
+                                      check1[valid_test_input_index].input,
+                                      check1[valid_test_input_index].input_length);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
 
     /* Abort a hash operation */
-    status = val->crypto_function(VAL_CRYPTO_HASH_ABORT, &operation);
+    status = val->crypto->hash_abort(&operation);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
     /* Finish the calculation of the hash of a message */
-    status = val->crypto_function(VAL_CRYPTO_HASH_FINISH,
-                                  &operation,
-                                  check1[valid_test_input_index].hash,
-                                  check1[valid_test_input_index].hash_size,
-                                  &expected_hash_length);
+    status = val->crypto->hash_finish(&operation,
+                                      check1[valid_test_input_index].hash,
+                                      check1[valid_test_input_index].hash_size,
+                                      &expected_hash_length);
     TEST_ASSERT_EQUAL(status, PSA_ERROR_BAD_STATE, TEST_CHECKPOINT_NUM(6));
 
     return VAL_STATUS_SUCCESS;
@@ -50,6 +50,6 @@ void test_entry(val_api_t *val_api, psa_api_t *psa_api)
 
 test_exit:
     crypto_common_exit_action();
-    val->crypto_function(VAL_CRYPTO_FREE);
+    val->crypto->free_keys();
     val->test_exit();
 }
@@ -42,7 +42,7 @@ int32_t psa_generate_random_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     for (i = 0; i < num_checks; i++)
@@ -66,8 +66,8 @@ int32_t psa_generate_random_test(caller_security_t caller __UNUSED)
             memset(check1[i].output, 0, check1[i].output_size);
 
             /* Generate random bytes */
-            status = val->crypto_function(VAL_CRYPTO_GENERATE_RANDOM, check1[i].output,
-                                          check1[i].output_size);
+            status = val->crypto->generate_random(check1[i].output,
+                                                  check1[i].output_size);
             TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(3));
 
             /* Check that no more than bytes have been overwritten */
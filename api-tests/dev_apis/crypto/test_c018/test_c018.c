@@ -47,7 +47,7 @@ int32_t psa_key_derivation_input_key_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     /* Set the key data buffer to the input base on algorithm */
@@ -61,13 +61,13 @@ int32_t psa_key_derivation_input_key_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Setup the attributes for the key */
-        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE,        &attributes, check1[i].type);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_BITS,        &attributes, check1[i].bits);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes, check1[i].usage_flags);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM,   &attributes, check1[i].alg);
+        val->crypto->set_key_type(&attributes, check1[i].type);
+        val->crypto->set_key_bits(&attributes, check1[i].bits);
+        val->crypto->set_key_usage_flags(&attributes, check1[i].usage_flags);
+        val->crypto->set_key_algorithm(&attributes, check1[i].alg);
 
         /* Import the key data into the key slot */
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].data,
+        status = val->crypto->import_key(&attributes, check1[i].data,
                  check1[i].data_length, &key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
@@ -76,13 +76,13 @@ int32_t psa_key_derivation_input_key_test(caller_security_t caller __UNUSED)
             /* Provide an input for key derivation or key agreement without setup should be
              * failure.
              */
-            status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_INPUT_KEY, &operation,
+            status = val->crypto->key_derivation_input_key(&operation,
                      check1[i].step, key);
             TEST_ASSERT_EQUAL(status, PSA_ERROR_BAD_STATE, TEST_CHECKPOINT_NUM(4));
         }
 
         /* Set up a key derivation operation */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_SETUP, &operation,
+        status = val->crypto->key_derivation_setup(&operation,
                  check1[i].setup_alg);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
@@ -90,47 +90,47 @@ int32_t psa_key_derivation_input_key_test(caller_security_t caller __UNUSED)
             (check1[i].step == PSA_KEY_DERIVATION_INPUT_PASSWORD))
         {
             /* Provide Cost as an input step prior to the Password for PBKDF2 algorithms. */
-            status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_INPUT_INTEGER, &operation,
+            status = val->crypto->key_derivation_input_integer(&operation,
                      PSA_KEY_DERIVATION_INPUT_COST, integer_input);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(6));
 
             /* Provide Salt as an input step prior to the Password for PBKDF2 algorithms. */
-            status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_INPUT_BYTES, &operation,
+            status = val->crypto->key_derivation_input_bytes(&operation,
                      PSA_KEY_DERIVATION_INPUT_SALT, check1[i].data, check1[i].data_length);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(7));
         }
 
         /* Provide an input for key derivation or key agreement */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_INPUT_KEY, &operation,
+        status = val->crypto->key_derivation_input_key(&operation,
                  check1[i].step, key);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(8));
 
         if (check1[i].expected_status != PSA_SUCCESS)
         {
             /* Abort the key derivation operation */
-            status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_ABORT, &operation);
+            status = val->crypto->key_derivation_abort(&operation);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(9));
 
-            status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+            status = val->crypto->destroy_key(key);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(10));
             continue;
         }
 
-        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+        status = val->crypto->destroy_key(key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(11));
 
         /* Provide an input for key derivation or key agreement */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_INPUT_KEY, &operation,
+        status = val->crypto->key_derivation_input_key(&operation,
                  check1[i].step, key);
         TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_HANDLE, TEST_CHECKPOINT_NUM(12));
 
         /* Abort the key derivation operation */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_ABORT, &operation);
+        status = val->crypto->key_derivation_abort(&operation);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(13));
 
         /* Reset the key attributes and check if psa_import_key fails */
-        val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &attributes);
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].data,
+        val->crypto->reset_key_attributes(&attributes);
+        status = val->crypto->import_key(&attributes, check1[i].data,
                  check1[i].data_length, &key);
         TEST_ASSERT_EQUAL(status, PSA_ERROR_NOT_SUPPORTED, TEST_CHECKPOINT_NUM(14));
 
@@ -151,7 +151,7 @@ int32_t psa_key_derivation_input_key_negative_test(caller_security_t caller __UN
         return RESULT_SKIP(VAL_STATUS_NO_TESTS);
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     /* Setting up the watchdog timer for each check */
@@ -164,17 +164,17 @@ int32_t psa_key_derivation_input_key_negative_test(caller_security_t caller __UN
     operation = psa_key_derivation_operation_init();
 
     /* Set up a key derivation operation */
-    status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_SETUP, &operation,
+    status = val->crypto->key_derivation_setup(&operation,
              check1[valid_test_input_index].setup_alg);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
     /* Provide an input for key derivation or key agreement */
-    status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_INPUT_KEY, &operation,
+    status = val->crypto->key_derivation_input_key(&operation,
              check1[valid_test_input_index].step, key);
     TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_HANDLE, TEST_CHECKPOINT_NUM(4));
 
     /* Abort the key derivation operation */
-    status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_ABORT, &operation);
+    status = val->crypto->key_derivation_abort(&operation);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
     val->print(PRINT_TEST, "[Check %d] Test psa_cipher_decrypt_setup - Zero as key handle\n",
@@ -183,17 +183,17 @@ int32_t psa_key_derivation_input_key_negative_test(caller_security_t caller __UN
     operation = psa_key_derivation_operation_init();
 
     /* Set up a key derivation operation */
-    status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_SETUP, &operation,
+    status = val->crypto->key_derivation_setup(&operation,
              check1[valid_test_input_index].setup_alg);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(6));
 
     /* Provide an input for key derivation or key agreement */
-    status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_INPUT_KEY, &operation,
+    status = val->crypto->key_derivation_input_key(&operation,
              check1[valid_test_input_index].step, 0);
     TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_HANDLE, TEST_CHECKPOINT_NUM(7));
 
     /* Abort the key derivation operation */
-    status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_ABORT, &operation);
+    status = val->crypto->key_derivation_abort(&operation);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
 
     return VAL_STATUS_SUCCESS;
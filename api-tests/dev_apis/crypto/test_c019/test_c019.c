@@ -46,7 +46,7 @@ int32_t psa_key_derivation_key_agreement_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     for (i = 0; i < num_checks; i++)
@@ -59,45 +59,44 @@ int32_t psa_key_derivation_key_agreement_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Setup the attributes for the key */
-        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE,        &attributes, check1[i].type);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM,   &attributes, check1[i].alg);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes, check1[i].usage_flags);
+        val->crypto->set_key_type(&attributes, check1[i].type);
+        val->crypto->set_key_algorithm(&attributes, check1[i].alg);
+        val->crypto->set_key_usage_flags(&attributes, check1[i].usage_flags);
 
         /* Import the key data into the key slot */
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].data,
+        status = val->crypto->import_key(&attributes, check1[i].data,
                  check1[i].data_length, &key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Set up a key agreement operation */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_SETUP, &operation, check1[i].alg);
+        status = val->crypto->key_derivation_setup(&operation, check1[i].alg);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
 
         /* Perform a key agreement */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_KEY_AGREEMENT,
-                                      &operation,
-                                      check1[i].step,
-                                      key,
-                                      check1[i].peer_key,
-                                      check1[i].peer_key_length);
+        status = val->crypto->key_derivation_key_agreement(&operation,
+                                                           check1[i].step,
+                                                           key,
+                                                           check1[i].peer_key,
+                                                           check1[i].peer_key_length);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(5));
 
         /* Abort the key derivation operation */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_ABORT, &operation);
+        status = val->crypto->key_derivation_abort(&operation);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(6));
 
         /* Reset the key attributes and check if psa_import_key fails */
-        val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &attributes);
+        val->crypto->reset_key_attributes(&attributes);
 
         if (check1[i].expected_status != PSA_SUCCESS)
         {
             /* Destroy a key and restore the slot to its default state */
-            status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+            status = val->crypto->destroy_key(key);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(7));
             continue;
         }
 
         /* Destroy a key and restore the slot to its default state */
-        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+        status = val->crypto->destroy_key(key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
 
         if (valid_test_input_index < 0)
@@ -117,43 +116,41 @@ int32_t psa_key_derivation_key_agreement_negative_test(caller_security_t caller
         return RESULT_SKIP(VAL_STATUS_NO_TESTS);
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     /* Setting up the watchdog timer for each check */
     status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
     TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
-    status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_SETUP, &operation,
-                                  check1[valid_test_input_index].alg);
+    status = val->crypto->key_derivation_setup(&operation,
+                                               check1[valid_test_input_index].alg);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
     val->print(PRINT_TEST, "[Check %d] Test psa_key_derivation_key_agreement "
                            "- Invalid handle\n", g_test_count++);
 
     /* Set up a key agreement operation */
-    status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_KEY_AGREEMENT,
-                                  &operation,
-                                  check1[valid_test_input_index].step,
-                                  key,
-                                  check1[valid_test_input_index].peer_key,
-                                  check1[valid_test_input_index].peer_key_length);
+    status = val->crypto->key_derivation_key_agreement(&operation,
+                                                       check1[valid_test_input_index].step,
+                                                       key,
+                                                       check1[valid_test_input_index].peer_key,
+                                                       check1[valid_test_input_index].peer_key_length);
     TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_HANDLE, TEST_CHECKPOINT_NUM(4));
 
     val->print(PRINT_TEST, "[Check %d] Test psa_key_derivation_key_agreement"
                            " - Zero as handle\n", g_test_count++);
 
     /* Set up a key agreement operation */
-    status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_KEY_AGREEMENT,
-                                  &operation,
-                                  check1[valid_test_input_index].step,
-                                  0,
-                                  check1[valid_test_input_index].peer_key,
-                                  check1[valid_test_input_index].peer_key_length);
+    status = val->crypto->key_derivation_key_agreement(&operation,
+                                                       check1[valid_test_input_index].step,
+                                                       0,
+                                                       check1[valid_test_input_index].peer_key,
+                                                       check1[valid_test_input_index].peer_key_length);
     TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_HANDLE, TEST_CHECKPOINT_NUM(5));
 
     /* Abort the key derivation operation */
-    status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_ABORT, &operation);
+    status = val->crypto->key_derivation_abort(&operation);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(6));
 
     return VAL_STATUS_SUCCESS;
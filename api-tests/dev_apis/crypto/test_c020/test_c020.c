@@ -42,7 +42,7 @@ int32_t psa_key_derivation_output_bytes_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     for (i = 0; i < num_checks; i++)
@@ -56,22 +56,22 @@ int32_t psa_key_derivation_output_bytes_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Setup the attributes for the key */
-        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE,        &attributes, check1[i].type);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM,   &attributes, check1[i].alg);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes, check1[i].usage_flags);
+        val->crypto->set_key_type(&attributes, check1[i].type);
+        val->crypto->set_key_algorithm(&attributes, check1[i].alg);
+        val->crypto->set_key_usage_flags(&attributes, check1[i].usage_flags);
 
         /* Import the key data into the key slot */
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].data,
-                                      check1[i].data_length, &key);
+        status = val->crypto->import_key(&attributes, check1[i].data,
+                                         check1[i].data_length, &key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Start the key derivation operation */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_SETUP, &operation, check1[i].alg);
+        status = val->crypto->key_derivation_setup(&operation, check1[i].alg);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
 
         /* Set the capacity for the generator */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_SET_CAPACITY, &operation,
-                                      check1[i].capacity);
+        status = val->crypto->key_derivation_set_capacity(&operation,
+                                                          check1[i].capacity);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
         /* Loop through the available steps */
@@ -85,36 +85,36 @@ int32_t psa_key_derivation_output_bytes_test(caller_security_t caller __UNUSED)
 
             if (check1[i].derv_inputs[inIdx].step == PSA_KEY_DERIVATION_INPUT_SECRET)
             {
-                status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_INPUT_KEY, &operation,
-                                              check1[i].derv_inputs[inIdx].step, key);
+                status = val->crypto->key_derivation_input_key(&operation,
+                                                               check1[i].derv_inputs[inIdx].step, key);
                 TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(6));
             } else {
-                status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_INPUT_BYTES, &operation,
-                                              check1[i].derv_inputs[inIdx].step,
-                                              check1[i].derv_inputs[inIdx].data,
-                                              check1[i].derv_inputs[inIdx].data_length);
+                status = val->crypto->key_derivation_input_bytes(&operation,
+                                                                 check1[i].derv_inputs[inIdx].step,
+                                                                 check1[i].derv_inputs[inIdx].data,
+                                                                 check1[i].derv_inputs[inIdx].data_length);
                 TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(7));
             }
         }
 
         /* Read some data from a key derivation operation */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_OUTPUT_BYTES, &operation,
-                                      check1[i].output, check1[i].output_length);
+        status = val->crypto->key_derivation_output_bytes(&operation,
+                                                          check1[i].output, check1[i].output_length);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(8));
 
-        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+        status = val->crypto->destroy_key(key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(9));
 
         /* Reset the key attributes */
-        val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &attributes);
+        val->crypto->reset_key_attributes(&attributes);
 
         /* Abort the derivation operation */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_ABORT, &operation);
+        status = val->crypto->key_derivation_abort(&operation);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(10));
 
         /* Expect bad state when derivation is called on an aborted operation */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_OUTPUT_BYTES, &operation,
-                                      check1[i].output, check1[i].output_length);
+        status = val->crypto->key_derivation_output_bytes(&operation,
+                                                          check1[i].output, check1[i].output_length);
         TEST_ASSERT_EQUAL(status, PSA_ERROR_BAD_STATE, TEST_CHECKPOINT_NUM(11));
     }
 
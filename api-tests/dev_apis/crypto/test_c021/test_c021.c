@@ -52,7 +52,7 @@ int32_t psa_key_derivation_output_key_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     for (i = 0; i < num_checks; i++)
@@ -65,25 +65,25 @@ int32_t psa_key_derivation_output_key_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Setup the attributes for the key */
-        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE, &attributes, check1[i].key_type);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM, &attributes, check1[i].key_alg);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes, check1[i].usage);
+        val->crypto->set_key_type(&attributes, check1[i].key_type);
+        val->crypto->set_key_algorithm(&attributes, check1[i].key_alg);
+        val->crypto->set_key_usage_flags(&attributes, check1[i].usage);
 
         /* Import the key if the derivation input is key */
         {
             /* Import the key data into the key slot */
-            status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].key_data,
+            status = val->crypto->import_key(&attributes, check1[i].key_data,
                      check1[i].key_length, &key);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
         }
 
         /* Start the key derivation operation */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_SETUP, &operation,
+        status = val->crypto->key_derivation_setup(&operation,
                  check1[i].key_alg);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
 
         /* Set the capacity for the generator */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_SET_CAPACITY, &operation,
+        status = val->crypto->key_derivation_set_capacity(&operation,
                  check1[i].capacity);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
@@ -91,102 +91,101 @@ int32_t psa_key_derivation_output_key_test(caller_security_t caller __UNUSED)
         if (check1[i].step == PSA_KEY_DERIVATION_INPUT_SECRET)
         {
             /* Provide an input for key derivation or key agreement */
-            status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_INPUT_KEY, &operation,
+            status = val->crypto->key_derivation_input_key(&operation,
                      check1[i].step, key);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(6));
-            status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_INPUT_BYTES, &operation,
-                                          PSA_KEY_DERIVATION_INPUT_INFO,
-                                          input_info,
-                                          INPUT_INFO_LEN);
+            status = val->crypto->key_derivation_input_bytes(&operation,
+                                                             PSA_KEY_DERIVATION_INPUT_INFO,
+                                                             input_info,
+                                                             INPUT_INFO_LEN);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(7));
         }
         else
         {
            if (check1[i].step != PSA_KEY_DERIVATION_INPUT_SALT)
            {
-                status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_INPUT_KEY, &operation,
-                                              check1[0].step, key);
+                status = val->crypto->key_derivation_input_key(&operation,
+                                                               check1[0].step, key);
 				TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
 
-                status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_INPUT_BYTES, &operation,
-                                              check1[i].step,
-                                              check1[i].data,
-                                              check1[i].data_length);
+                status = val->crypto->key_derivation_input_bytes(&operation,
+                                                                 check1[i].step,
+                                                                 check1[i].data,
+                                                                 check1[i].data_length);
 				TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(9));
 				if (check1[i].step != PSA_KEY_DERIVATION_INPUT_INFO)
 				{
-                   status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_INPUT_BYTES,
-                                                  &operation,
+                   status = val->crypto->key_derivation_input_bytes(&operation,
                                                   PSA_KEY_DERIVATION_INPUT_INFO,
                                                   input_info,
                                                   INPUT_INFO_LEN);
                    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(10));
 				}
             } else {
-                status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_INPUT_BYTES, &operation,
-                                              check1[i].step, check1[i].data,
-                                              check1[i].data_length);
+                status = val->crypto->key_derivation_input_bytes(&operation,
+                                                                 check1[i].step, check1[i].data,
+                                                                 check1[i].data_length);
                 TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(11));
-                status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_INPUT_KEY, &operation,
-						 check1[0].step, key);
+                status = val->crypto->key_derivation_input_key(&operation,
+                         check1[0].step, key);
 				TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(12));
-                status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_INPUT_BYTES, &operation,
-                                              PSA_KEY_DERIVATION_INPUT_INFO,
-                                              input_info,
-                                              INPUT_INFO_LEN);
+                status = val->crypto->key_derivation_input_bytes(&operation,
+                                                                 PSA_KEY_DERIVATION_INPUT_INFO,
+                                                                 input_info,
+                                                                 INPUT_INFO_LEN);
 				TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(13));
             }
         }
 
         /* Setup the attributes for the key */
-        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE, &derv_attributes,
-		                     check1[i].derive_key_type);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_BITS, &derv_attributes,
-                             check1[i].derive_key_bits);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM, &derv_attributes,
-                             check1[i].derive_key_alg);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &derv_attributes,
-                             check1[i].derive_usage);
+        val->crypto->set_key_type(&derv_attributes,
+                                  check1[i].derive_key_type);
+        val->crypto->set_key_bits(&derv_attributes,
+                                  check1[i].derive_key_bits);
+        val->crypto->set_key_algorithm(&derv_attributes,
+                                       check1[i].derive_key_alg);
+        val->crypto->set_key_usage_flags(&derv_attributes,
+                                         check1[i].derive_usage);
 
         /*  Derive a key from an ongoing key derivation operation */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_OUTPUT_KEY, &derv_attributes,
-                                      &operation, &keys[SLOT_1]);
+        status = val->crypto->key_derivation_output_key(&derv_attributes,
+                                                        &operation, &keys[SLOT_1]);
         TEST_ASSERT_DUAL(status, check1[i].expected_status[0], check1[i].expected_status[1],\
                          TEST_CHECKPOINT_NUM(14));
 
         if ((check1[i].expected_status[0] == PSA_SUCCESS) &&
             (check1[i].expected_status[1] == PSA_SUCCESS))
             {
-                status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, keys[SLOT_1]);
+                status = val->crypto->destroy_key(keys[SLOT_1]);
                 TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(15));
 
             }
         {
-            status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+            status = val->crypto->destroy_key(key);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(16));
         }
 
         if ((check1[i].expected_status[0] != PSA_SUCCESS) &&
             (check1[i].expected_status[1] != PSA_SUCCESS))
         {
-            status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_ABORT, &operation);
+            status = val->crypto->key_derivation_abort(&operation);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(17));
 
             continue;
         }
 
         /* Read some key from a key derivation operation with no data in the operation */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_OUTPUT_KEY, &derv_attributes,
-                                      &operation, &keys[SLOT_2]);
+        status = val->crypto->key_derivation_output_key(&derv_attributes,
+                                                        &operation, &keys[SLOT_2]);
         TEST_ASSERT_EQUAL(status, PSA_ERROR_INSUFFICIENT_DATA, TEST_CHECKPOINT_NUM(18));
 
         /* Abort the derivation operation */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_ABORT, &operation);
+        status = val->crypto->key_derivation_abort(&operation);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(19));
 
         /* Expect bad state when derivation is called on an aborted operation */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_OUTPUT_KEY, &derv_attributes,
-                                      &operation, &keys[SLOT_2]);
+        status = val->crypto->key_derivation_output_key(&derv_attributes,
+                                                        &operation, &keys[SLOT_2]);
         TEST_ASSERT_EQUAL(status, PSA_ERROR_BAD_STATE, TEST_CHECKPOINT_NUM(20));
 
     }
@@ -36,7 +36,7 @@ int32_t psa_key_derivation_abort_test(caller_security_t caller __UNUSED)
     memset(&zero, 0, sizeof(zero));
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     /* Setting up the watchdog timer for each check */
@@ -47,17 +47,17 @@ int32_t psa_key_derivation_abort_test(caller_security_t caller __UNUSED)
     val->print(PRINT_TEST, "[Check %d] ", i++);
     val->print(PRINT_TEST, "Test psa_key_derivation_abort\n", 0);
 
-    status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_ABORT, &func);
+    status = val->crypto->key_derivation_abort(&func);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
-    status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_ABORT, &init);
+    status = val->crypto->key_derivation_abort(&init);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
 
-    status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_ABORT, &zero);
+    status = val->crypto->key_derivation_abort(&zero);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
     /* Read some data from a key derivation operation with no data in the operation */
-    status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_OUTPUT_BYTES, &func, expected_output,
+    status = val->crypto->key_derivation_output_bytes(&func, expected_output,
              BUFFER_SIZE);
     TEST_ASSERT_EQUAL(status, PSA_ERROR_BAD_STATE, TEST_CHECKPOINT_NUM(6));
 
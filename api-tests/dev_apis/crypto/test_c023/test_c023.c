@@ -40,7 +40,7 @@ int32_t psa_key_derivation_set_get_capacity_test(caller_security_t caller __UNUS
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     for (i = 0; i < num_checks; i++)
@@ -54,42 +54,42 @@ int32_t psa_key_derivation_set_get_capacity_test(caller_security_t caller __UNUS
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Start the key derivation operation */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_SETUP, &operation,
-                                      check1[i].alg);
+        status = val->crypto->key_derivation_setup(&operation,
+                                                   check1[i].alg);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Set the capacity for the generator */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_SET_CAPACITY, &operation,
-                                      check1[i].capacity);
+        status = val->crypto->key_derivation_set_capacity(&operation,
+                                                          check1[i].capacity);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(4));
 
         if (check1[i].expected_status != PSA_SUCCESS)
         {
-            status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_ABORT, &operation);
+            status = val->crypto->key_derivation_abort(&operation);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
             continue;
         }
 
         /* Get the capacity for the generator */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_GET_CAPACITY, &operation,
-                                      &get_capacity);
+        status = val->crypto->key_derivation_get_capacity(&operation,
+                                                          &get_capacity);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(6));
 
         /* Check if the capacity as per the expected value */
         TEST_ASSERT_EQUAL(get_capacity, check1[i].capacity, TEST_CHECKPOINT_NUM(7));
 
         /* Abort the operation */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_ABORT, &operation);
+        status = val->crypto->key_derivation_abort(&operation);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
 
         /* Setting the capacity on an aborted operation should be an error */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_SET_CAPACITY, &operation,
-                                      check1[i].capacity);
+        status = val->crypto->key_derivation_set_capacity(&operation,
+                                                          check1[i].capacity);
         TEST_ASSERT_EQUAL(status, PSA_ERROR_BAD_STATE, TEST_CHECKPOINT_NUM(9));
 
         /* Getting the capacity on an aborted operation should be an error */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_GET_CAPACITY, &operation,
-                                      &get_capacity);
+        status = val->crypto->key_derivation_get_capacity(&operation,
+                                                          &get_capacity);
         TEST_ASSERT_EQUAL(status, PSA_ERROR_BAD_STATE, TEST_CHECKPOINT_NUM(10));
 
     }
@@ -101,29 +101,29 @@ int32_t psa_key_derivation_set_get_capacity_test(caller_security_t caller __UNUS
     val->print(PRINT_TEST, "[Check %d] ", i+1);
     val->print(PRINT_TEST, "Test psa_key_derivation_set_get_capacity - unchanged capacity\n", 0);
     /* Start the key derivation operation */
-    status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_SETUP, &operation, check1[0].alg);
+    status = val->crypto->key_derivation_setup(&operation, check1[0].alg);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(11));
 
     /* Set the capacity for the generator */
-    status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_SET_CAPACITY, &operation,
-                                  check1[0].capacity);
+    status = val->crypto->key_derivation_set_capacity(&operation,
+                                                      check1[0].capacity);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(12));
 
     /* Try to set capacity larger than the operation's capacity */
-    status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_SET_CAPACITY, &operation,
-                                  check1[2].capacity);
+    status = val->crypto->key_derivation_set_capacity(&operation,
+                                                      check1[2].capacity);
     TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_ARGUMENT, TEST_CHECKPOINT_NUM(13));
 
     /* Get the capacity for the generator */
-    status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_GET_CAPACITY, &operation,
-                                  &get_capacity);
+    status = val->crypto->key_derivation_get_capacity(&operation,
+                                                      &get_capacity);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(14));
 
     /* Check if the previous capacity remains unchanged */
     TEST_ASSERT_EQUAL(get_capacity, check1[0].capacity, TEST_CHECKPOINT_NUM(15));
 
     /* Abort the operation */
-    status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_ABORT, &operation);
+    status = val->crypto->key_derivation_abort(&operation);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(16));
 
     return VAL_STATUS_SUCCESS;
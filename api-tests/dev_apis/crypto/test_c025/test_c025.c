@@ -41,7 +41,7 @@ int32_t psa_aead_decrypt_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     for (i = 0; i < num_checks; i++)
@@ -54,22 +54,22 @@ int32_t psa_aead_decrypt_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Setup the attributes for the key */
-        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE,        &attributes, check1[i].type);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes, check1[i].usage_flags);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM,   &attributes, check1[i].key_alg);
+        val->crypto->set_key_type(&attributes, check1[i].type);
+        val->crypto->set_key_usage_flags(&attributes, check1[i].usage_flags);
+        val->crypto->set_key_algorithm(&attributes, check1[i].key_alg);
 
         /* Import the key data into the key slot */
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].data,
-                                      check1[i].data_length, &key);
+        status = val->crypto->import_key(&attributes, check1[i].data,
+                                         check1[i].data_length, &key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Process an authenticated decryption operation */
-        status = val->crypto_function(VAL_CRYPTO_AEAD_DECRYPT, key, check1[i].aead_alg,
-                                      check1[i].nonce, check1[i].nonce_length,
-                                      check1[i].additional_data, check1[i].additional_data_length,
-                                      check1[i].ciphertext, check1[i].ciphertext_length,
-                                      check1[i].plaintext, check1[i].plaintext_size,
-                                      &expected_plaintext_length);
+        status = val->crypto->aead_decrypt(key, check1[i].aead_alg,
+                                           check1[i].nonce, check1[i].nonce_length,
+                                           check1[i].additional_data, check1[i].additional_data_length,
+                                           check1[i].ciphertext, check1[i].ciphertext_length,
+                                           check1[i].plaintext, check1[i].plaintext_size,
+                                           &expected_plaintext_length);
         TEST_ASSERT_DUAL(status,
                          check1[i].expected_status[0],
                          check1[i].expected_status[1],
@@ -79,7 +79,7 @@ int32_t psa_aead_decrypt_test(caller_security_t caller __UNUSED)
             (check1[i].expected_status[1] != PSA_SUCCESS))
         {
             /* Destroy the key */
-            status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+            status = val->crypto->destroy_key(key);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
             continue;
@@ -94,22 +94,22 @@ int32_t psa_aead_decrypt_test(caller_security_t caller __UNUSED)
                            expected_plaintext_length, TEST_CHECKPOINT_NUM(7));
 
         /* Destroy the key */
-        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+        status = val->crypto->destroy_key(key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
 
         /* Reset the key attributes and check if psa_import_key fails */
-        val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &attributes);
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].data,
-                                      check1[i].data_length, &key);
+        val->crypto->reset_key_attributes(&attributes);
+        status = val->crypto->import_key(&attributes, check1[i].data,
+                                         check1[i].data_length, &key);
         TEST_ASSERT_EQUAL(status, PSA_ERROR_NOT_SUPPORTED, TEST_CHECKPOINT_NUM(9));
 
         /* Process an authenticated decryption operation on a destroyed key handle */
-        status = val->crypto_function(VAL_CRYPTO_AEAD_DECRYPT, key, check1[i].aead_alg,
-                                      check1[i].nonce, check1[i].nonce_length,
-                                      check1[i].additional_data, check1[i].additional_data_length,
-                                      check1[i].ciphertext, check1[i].ciphertext_length,
-                                      check1[i].plaintext, check1[i].plaintext_size,
-                                      &expected_plaintext_length);
+        status = val->crypto->aead_decrypt(key, check1[i].aead_alg,
+                                           check1[i].nonce, check1[i].nonce_length,
+                                           check1[i].additional_data, check1[i].additional_data_length,
+                                           check1[i].ciphertext, check1[i].ciphertext_length,
+                                           check1[i].plaintext, check1[i].plaintext_size,
+                                           &expected_plaintext_length);
         TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_HANDLE, TEST_CHECKPOINT_NUM(10));
     }
 
@@ -47,7 +47,7 @@ int32_t psa_mac_sign_setup_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     for (i = 0; i < num_checks; i++)
@@ -55,44 +55,37 @@ int32_t psa_mac_sign_setup_test(caller_security_t caller __UNUSED)
         val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
         val->print(PRINT_TEST, check1[i].test_desc, 0);
 
-        val->crypto_function(VAL_CRYPTO_MAC_OPERATION_INIT,
-                             &operation);
+        operation = val->crypto->mac_operation_init();
 
         /* Setting up the watchdog timer for each check */
         status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Setup the attributes for the key */
-        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE,
-                             &attributes,
-                             check1[i].type);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS,
-                             &attributes,
-                             check1[i].usage_flags);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM,
-                             &attributes,
-                             check1[i].alg);
+        val->crypto->set_key_type(&attributes,
+                                  check1[i].type);
+        val->crypto->set_key_usage_flags(&attributes,
+                                         check1[i].usage_flags);
+        val->crypto->set_key_algorithm(&attributes,
+                                       check1[i].alg);
 
         /* Import the key data into the key slot */
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY,
-                                      &attributes,
-                                      check1[i].data,
-                                      check1[i].data_length,
-                                      &key);
+        status = val->crypto->import_key(&attributes,
+                                         check1[i].data,
+                                         check1[i].data_length,
+                                         &key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Start a multipart MAC calculation operation */
-        status = val->crypto_function(VAL_CRYPTO_MAC_SIGN_SETUP,
-                                      &operation,
-                                      key,
-                                      check1[i].alg);
+        status = val->crypto->mac_sign_setup(&operation,
+                                             key,
+                                             check1[i].alg);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(4));
 
         /* Whether setup succeeded or failed, abort must succeed.
            Abort a MAC operation
          */
-        status = val->crypto_function(VAL_CRYPTO_MAC_ABORT,
-                                      &operation);
+        status = val->crypto->mac_abort(&operation);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
         /* If setup failed, reproduce the failure, so that the caller can
@@ -100,21 +93,18 @@ int32_t psa_mac_sign_setup_test(caller_security_t caller __UNUSED)
          */
         if (check1[i].expected_status != PSA_SUCCESS)
         {
-            status = val->crypto_function(VAL_CRYPTO_MAC_SIGN_SETUP,
-                                          &operation,
-                                          key,
-                                          check1[i].alg);
+            status = val->crypto->mac_sign_setup(&operation,
+                                                 key,
+                                                 check1[i].alg);
             TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(6));
         }
 
         /* Destroy the key */
-        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY,
-                                      key);
+        status = val->crypto->destroy_key(key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(7));
 
         /* Reset the key attributes */
-        val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES,
-                             &attributes);
+        val->crypto->reset_key_attributes(&attributes);
 
         if (valid_test_input_index < 0)
             valid_test_input_index = i;
@@ -139,7 +129,7 @@ int32_t psa_mac_sign_setup_negative_test(caller_security_t caller __UNUSED)
         return RESULT_SKIP(VAL_STATUS_NO_TESTS);
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     /* Setting up the watchdog timer for each check */
@@ -149,27 +139,23 @@ int32_t psa_mac_sign_setup_negative_test(caller_security_t caller __UNUSED)
     val->print(PRINT_TEST, "[Check %d] Test psa_mac_sign_setup invalid key handle\n",
                                                                              g_test_count++);
 
-    val->crypto_function(VAL_CRYPTO_MAC_OPERATION_INIT,
-                         &operation);
+    operation = val->crypto->mac_operation_init();
 
     /* Start a multipart MAC verification operation */
-    status = val->crypto_function(VAL_CRYPTO_MAC_SIGN_SETUP,
-                                  &operation,
-                                  key,
-                                  check1[valid_test_input_index].alg);
+    status = val->crypto->mac_sign_setup(&operation,
+                                         key,
+                                         check1[valid_test_input_index].alg);
     TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_HANDLE, TEST_CHECKPOINT_NUM(3));
 
     val->print(PRINT_TEST, "[Check %d] Test psa_mac_sign_setup zero as key handle\n",
                                                                              g_test_count++);
 
-    val->crypto_function(VAL_CRYPTO_MAC_OPERATION_INIT,
-                         &operation);
+    operation = val->crypto->mac_operation_init();
 
     /* Start a multipart MAC verification operation */
-    status = val->crypto_function(VAL_CRYPTO_MAC_SIGN_SETUP,
-                                  &operation,
-                                  0,
-                                  check1[valid_test_input_index].alg);
+    status = val->crypto->mac_sign_setup(&operation,
+                                         0,
+                                         check1[valid_test_input_index].alg);
     TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_HANDLE, TEST_CHECKPOINT_NUM(4));
 
     return VAL_STATUS_SUCCESS;
@@ -45,7 +45,7 @@ int32_t psa_mac_verify_finish_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     for (i = 0; i < num_checks; i++)
@@ -53,69 +53,58 @@ int32_t psa_mac_verify_finish_test(caller_security_t caller __UNUSED)
         val->print(PRINT_TEST, "[Check %d] ", i+1);
         val->print(PRINT_TEST, check1[i].test_desc, 0);
 
-        val->crypto_function(VAL_CRYPTO_KEY_ATTRIBUTES_INIT,
-                             &attributes);
-        val->crypto_function(VAL_CRYPTO_MAC_OPERATION_INIT,
-                             &operation);
+        attributes = val->crypto->key_attributes_init();
+        operation = val->crypto->mac_operation_init();
 
         /* Setting up the watchdog timer for each check */
         status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Setup the attributes for the key */
-        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE,
-                             &attributes,
-                             check1[i].type);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS,
-                             &attributes,
-                             check1[i].usage_flags);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM,
-                             &attributes,
-                             check1[i].alg);
+        val->crypto->set_key_type(&attributes,
+                                  check1[i].type);
+        val->crypto->set_key_usage_flags(&attributes,
+                                         check1[i].usage_flags);
+        val->crypto->set_key_algorithm(&attributes,
+                                       check1[i].alg);
 
         /* Import the key data into the key slot */
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY,
-                                      &attributes,
-                                      check1[i].data,
-                                      check1[i].data_length,
-                                      &key);
+        status = val->crypto->import_key(&attributes,
+                                         check1[i].data,
+                                         check1[i].data_length,
+                                         &key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         if (check1[i].operation_state) {
             /* Start a multipart MAC calculation operation */
-            status = val->crypto_function(VAL_CRYPTO_MAC_VERIFY_SETUP,
-                                          &operation,
-                                          key,
-                                          check1[i].alg);
+            status = val->crypto->mac_verify_setup(&operation,
+                                                   key,
+                                                   check1[i].alg);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
 
             /* Add a message fragment to a multipart MAC operation */
-            status = val->crypto_function(VAL_CRYPTO_MAC_UPDATE,
-                                          &operation,
-                                          check1[i].input,
-                                          check1[i].input_length);
+            status = val->crypto->mac_update(&operation,
+                                             check1[i].input,
+                                             check1[i].input_length);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
         }
 
         /* Finish the calculation of the MAC of a message and compare it with
          * an expected value
          */
-        status = val->crypto_function(VAL_CRYPTO_MAC_VERIFY_FINISH,
-                                      &operation,
-                                      check1[i].mac,
-                                      check1[i].mac_length);
+        status = val->crypto->mac_verify_finish(&operation,
+                                                check1[i].mac,
+                                                check1[i].mac_length);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(6));
 
         if (check1[i].expected_status != PSA_SUCCESS)
         {
             /* Abort a MAC operation */
-            status = val->crypto_function(VAL_CRYPTO_MAC_ABORT,
-                                          &operation);
+            status = val->crypto->mac_abort(&operation);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(7));
 
             /* Destroy the key */
-            status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY,
-                                          key);
+            status = val->crypto->destroy_key(key);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
             continue;
         }
@@ -124,20 +113,17 @@ int32_t psa_mac_verify_finish_test(caller_security_t caller __UNUSED)
          * Finish the calculation of the MAC of a message using same operation
          * should return error
          */
-        status = val->crypto_function(VAL_CRYPTO_MAC_VERIFY_FINISH,
-                                      &operation,
-                                      check1[i].mac,
-                                      check1[i].mac_length);
+        status = val->crypto->mac_verify_finish(&operation,
+                                                check1[i].mac,
+                                                check1[i].mac_length);
         TEST_ASSERT_EQUAL(status, PSA_ERROR_BAD_STATE, TEST_CHECKPOINT_NUM(9));
 
         /* Abort a MAC operation */
-        status = val->crypto_function(VAL_CRYPTO_MAC_ABORT,
-                                      &operation);
+        status = val->crypto->mac_abort(&operation);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(10));
 
         /* Destroy the key */
-        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY,
-                                      key);
+        status = val->crypto->destroy_key(key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(11));
     }
 
@@ -46,7 +46,7 @@ int32_t psa_mac_abort_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     for (i = 0; i < num_checks; i++)
@@ -54,54 +54,44 @@ int32_t psa_mac_abort_test(caller_security_t caller __UNUSED)
         val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
         val->print(PRINT_TEST, check1[i].test_desc, 0);
 
-        val->crypto_function(VAL_CRYPTO_KEY_ATTRIBUTES_INIT,
-                             &attributes);
-        val->crypto_function(VAL_CRYPTO_MAC_OPERATION_INIT,
-                             &operation);
+        attributes = val->crypto->key_attributes_init();
+        operation = val->crypto->mac_operation_init();
 
         /* Setting up the watchdog timer for each check */
         status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Setup the attributes for the key */
-        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE,
-                             &attributes,
-                             check1[i].type);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS,
-                             &attributes,
-                             check1[i].usage_flags);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM,
-                             &attributes,
-                             check1[i].alg);
+        val->crypto->set_key_type(&attributes,
+                                  check1[i].type);
+        val->crypto->set_key_usage_flags(&attributes,
+                                         check1[i].usage_flags);
+        val->crypto->set_key_algorithm(&attributes,
+                                       check1[i].alg);
 
         /* Import the key data into the key slot */
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY,
-                                      &attributes,
-                                      check1[i].data,
-                                      check1[i].data_length,
-                                      &key);
+        status = val->crypto->import_key(&attributes,
+                                         check1[i].data,
+                                         check1[i].data_length,
+                                         &key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Start a multipart MAC calculation operation */
-        status = val->crypto_function(VAL_CRYPTO_MAC_SIGN_SETUP,
-                                      &operation,
-                                      key,
-                                      check1[i].alg);
+        status = val->crypto->mac_sign_setup(&operation,
+                                             key,
+                                             check1[i].alg);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
 
         /* Abort a MAC operation */
-        status = val->crypto_function(VAL_CRYPTO_MAC_ABORT,
-                                      &operation);
+        status = val->crypto->mac_abort(&operation);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
         /* Multiple Abort a MAC operation should succeed */
-        status = val->crypto_function(VAL_CRYPTO_MAC_ABORT,
-                                      &operation);
+        status = val->crypto->mac_abort(&operation);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(6));
 
         /* Destroy the key */
-        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY,
-                                      key);
+        status = val->crypto->destroy_key(key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(7));
 
         if (valid_test_input_index < 0)
@@ -122,14 +112,13 @@ int32_t psa_mac_abort_before_finish_test(caller_security_t caller __UNUSED)
     if (valid_test_input_index < 0)
         return RESULT_SKIP(VAL_STATUS_NO_TESTS);
 
-    val->crypto_function(VAL_CRYPTO_MAC_OPERATION_INIT,
-                         &operation);
+    operation = val->crypto->mac_operation_init();
 
     val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
     val->print(PRINT_TEST, "Test psa_mac_sign_finish after calling psa_mac_abort\n", 0);
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     /* Setting up the watchdog timer for each check */
@@ -137,54 +126,45 @@ int32_t psa_mac_abort_before_finish_test(caller_security_t caller __UNUSED)
     TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
     /* Setup the attributes for the key */
-    val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE,
-                         &attributes,
-                         check1[valid_test_input_index].type);
-    val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS,
-                         &attributes,
-                         check1[valid_test_input_index].usage_flags);
-    val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM,
-                         &attributes,
-                         check1[valid_test_input_index].alg);
+    val->crypto->set_key_type(&attributes,
+                              check1[valid_test_input_index].type);
+    val->crypto->set_key_usage_flags(&attributes,
+                                     check1[valid_test_input_index].usage_flags);
+    val->crypto->set_key_algorithm(&attributes,
+                                   check1[valid_test_input_index].alg);
 
     /* Import the key data into the key slot */
-    status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY,
-                                  &attributes,
-                                  check1[valid_test_input_index].data,
-                                  check1[valid_test_input_index].data_length,
-                                  &key);
+    status = val->crypto->import_key(&attributes,
+                                     check1[valid_test_input_index].data,
+                                     check1[valid_test_input_index].data_length,
+                                     &key);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
     /* Start a multipart MAC calculation operation */
-    status = val->crypto_function(VAL_CRYPTO_MAC_SIGN_SETUP,
-                                  &operation,
-                                  key,
-                                  check1[valid_test_input_index].alg);
+    status = val->crypto->mac_sign_setup(&operation,
+                                         key,
+                                         check1[valid_test_input_index].alg);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
 
     /* Add a message fragment to a multipart MAC operation */
-    status = val->crypto_function(VAL_CRYPTO_MAC_UPDATE,
-                                  &operation,
-                                  input_bytes_data,
-                                  16);
+    status = val->crypto->mac_update(&operation,
+                                     input_bytes_data,
+                                     16);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
     /* Abort a MAC operation */
-    status = val->crypto_function(VAL_CRYPTO_MAC_ABORT,
-                                  &operation);
+    status = val->crypto->mac_abort(&operation);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(6));
 
     /* Finish the calculation of the MAC of a message */
-    status = val->crypto_function(VAL_CRYPTO_MAC_SIGN_FINISH,
-                                  &operation,
-                                  expected_output,
-                                  BUFFER_SIZE,
-                                  &mac_length);
+    status = val->crypto->mac_sign_finish(&operation,
+                                          expected_output,
+                                          BUFFER_SIZE,
+                                          &mac_length);
     TEST_ASSERT_EQUAL(status, PSA_ERROR_BAD_STATE, TEST_CHECKPOINT_NUM(7));
 
     /* Destroy the key */
-    status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY,
-                                  key);
+    status = val->crypto->destroy_key(key);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
 
     return VAL_STATUS_SUCCESS;
@@ -46,7 +46,7 @@ int32_t psa_cipher_decrypt_setup_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     /* Set the key data buffer to the input base on algorithm */
@@ -54,25 +54,25 @@ int32_t psa_cipher_decrypt_setup_test(caller_security_t caller __UNUSED)
     {
         val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
         val->print(PRINT_TEST, check1[i].test_desc, 0);
-        val->crypto_function(VAL_CRYPTO_CIPHER_OPERATION_INIT, &operation);
+        operation = val->crypto->cipher_operation_init();
 
         /* Setting up the watchdog timer for each check */
         status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Setup the attributes for the key */
-        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE,        &attributes, check1[i].type);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM,   &attributes, check1[i].alg);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes, check1[i].usage_flags);
+        val->crypto->set_key_type(&attributes, check1[i].type);
+        val->crypto->set_key_algorithm(&attributes, check1[i].alg);
+        val->crypto->set_key_usage_flags(&attributes, check1[i].usage_flags);
 
         /* Import the key data into the key slot */
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].data,
-                                      check1[i].data_length, &key);
+        status = val->crypto->import_key(&attributes, check1[i].data,
+                                         check1[i].data_length, &key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Set the key for a multipart symmetric decryption operation */
-        status = val->crypto_function(VAL_CRYPTO_CIPHER_DECRYPT_SETUP, &operation, key,
-                                      check1[i].alg);
+        status = val->crypto->cipher_decrypt_setup(&operation, key,
+                                                   check1[i].alg);
 	    /* TBD Note:- these changes are done because of the spec bug : https://github.com/ARMmbed/mbedtls/pull/4582
 		 *        revisit the 1.0.x spec is out
 		 */
@@ -89,13 +89,13 @@ int32_t psa_cipher_decrypt_setup_test(caller_security_t caller __UNUSED)
         /* Whether setup succeeded or failed, abort must succeed.
          * Abort a cipher operation
          */
-        status = val->crypto_function(VAL_CRYPTO_CIPHER_ABORT, &operation);
+        status = val->crypto->cipher_abort(&operation);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
         if (check1[i].expected_status != PSA_SUCCESS)
         {
-            status = val->crypto_function(VAL_CRYPTO_CIPHER_DECRYPT_SETUP, &operation, key,
-                                          check1[i].alg);
+            status = val->crypto->cipher_decrypt_setup(&operation, key,
+                                                       check1[i].alg);
 	       /* TBD Note:- these changes are done because of the spec bug : https://github.com/ARMmbed/mbedtls/pull/4582
 		    *        revisit the 1.0.x spec is out
 		    */
@@ -110,18 +110,18 @@ int32_t psa_cipher_decrypt_setup_test(caller_security_t caller __UNUSED)
 			}
 
             /* Abort a cipher operation */
-            status = val->crypto_function(VAL_CRYPTO_CIPHER_ABORT, &operation);
+            status = val->crypto->cipher_abort(&operation);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(7));
         }
 
         /* Destroy the key */
-        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+        status = val->crypto->destroy_key(key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
 
          /* Reset the key attributes and check if psa_import_key fails */
-        val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &attributes);
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].data,
-                                      check1[i].data_length, &key);
+        val->crypto->reset_key_attributes(&attributes);
+        status = val->crypto->import_key(&attributes, check1[i].data,
+                                         check1[i].data_length, &key);
 	    /* TBD Note:- these changes are done because of the spec bug : https://github.com/ARMmbed/mbedtls/pull/4582
 		 *        revisit the 1.0.x spec is out
 		 */
@@ -145,7 +145,7 @@ int32_t psa_cipher_decrypt_setup_negative_test(caller_security_t caller __UNUSED
         return RESULT_SKIP(VAL_STATUS_NO_TESTS);
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     memset(&operation, 0, sizeof(operation));
@@ -157,8 +157,8 @@ int32_t psa_cipher_decrypt_setup_negative_test(caller_security_t caller __UNUSED
     val->print(PRINT_TEST, "[Check %d] Test psa_cipher_decrypt_setup - Invalid key handle\n",
                                                                                g_test_count++);
     /* Set the key for a multipart symmetric decryption operation */
-    status = val->crypto_function(VAL_CRYPTO_CIPHER_DECRYPT_SETUP, &operation, key,
-                                  check1[valid_test_input_index].alg);
+    status = val->crypto->cipher_decrypt_setup(&operation, key,
+                                               check1[valid_test_input_index].alg);
     TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_HANDLE, TEST_CHECKPOINT_NUM(3));
 
     val->print(PRINT_TEST, "[Check %d] Test psa_cipher_decrypt_setup - Zero as key handle\n",
@@ -167,11 +167,11 @@ int32_t psa_cipher_decrypt_setup_negative_test(caller_security_t caller __UNUSED
     memset(&operation, 0, sizeof(operation));
 
     /* Set the key for a multipart symmetric decryption operation */
-    status = val->crypto_function(VAL_CRYPTO_CIPHER_DECRYPT_SETUP, &operation, 0,
-                                  check1[valid_test_input_index].alg);
+    status = val->crypto->cipher_decrypt_setup(&operation, 0,
+                                               check1[valid_test_input_index].alg);
     TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_HANDLE, TEST_CHECKPOINT_NUM(4));
 
-    status = val->crypto_function(VAL_CRYPTO_CIPHER_ABORT, &operation);
+    status = val->crypto->cipher_abort(&operation);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
     return VAL_STATUS_SUCCESS;
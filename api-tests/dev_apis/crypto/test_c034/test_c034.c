@@ -47,47 +47,47 @@ int32_t psa_cipher_generate_iv_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     for (i = 0; i < num_checks; i++)
     {
         val->print(PRINT_TEST, "[Check %d] ", i+1);
         val->print(PRINT_TEST, check1[i].test_desc, 0);
-        val->crypto_function(VAL_CRYPTO_CIPHER_OPERATION_INIT, &operation);
+        operation = val->crypto->cipher_operation_init();
 
         /* Setting up the watchdog timer for each check */
         status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Setup the attributes for the key */
-        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE,        &attributes, check1[i].type);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM,   &attributes, check1[i].alg);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes, check1[i].usage_flags);
+        val->crypto->set_key_type(&attributes, check1[i].type);
+        val->crypto->set_key_algorithm(&attributes, check1[i].alg);
+        val->crypto->set_key_usage_flags(&attributes, check1[i].usage_flags);
 
         /* Import the key data into the key slot */
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].data,
-                                      check1[i].data_length, &key);
+        status = val->crypto->import_key(&attributes, check1[i].data,
+                                         check1[i].data_length, &key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Set the key for a multipart symmetric encryption operation */
-        status = val->crypto_function(VAL_CRYPTO_CIPHER_ENCRYPT_SETUP, &operation, key,
-                                      check1[i].alg);
+        status = val->crypto->cipher_encrypt_setup(&operation, key,
+                                                   check1[i].alg);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
 
         /* Generate an IV for a symmetric encryption operation */
-        status = val->crypto_function(VAL_CRYPTO_CIPHER_GENERATE_IV, &operation, check1[i].iv,
-                                      check1[i].iv_size, &expected_iv_length);
+        status = val->crypto->cipher_generate_iv(&operation, check1[i].iv,
+                                                 check1[i].iv_size, &expected_iv_length);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(5));
 
         if (check1[i].expected_status != PSA_SUCCESS)
         {
             /* Abort a cipher operation */
-            status = val->crypto_function(VAL_CRYPTO_CIPHER_ABORT, &operation);
+            status = val->crypto->cipher_abort(&operation);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(6));
 
             /* Destroy the key */
-            status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+            status = val->crypto->destroy_key(key);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(7));
 
             continue;
@@ -106,22 +106,22 @@ int32_t psa_cipher_generate_iv_test(caller_security_t caller __UNUSED)
         /* Generating an IV for a symmetric encryption operation using the same operator
          * should fail
          */
-        status = val->crypto_function(VAL_CRYPTO_CIPHER_GENERATE_IV, &operation, check1[i].iv,
-                                      check1[i].iv_size, &expected_iv_length);
+        status = val->crypto->cipher_generate_iv(&operation, check1[i].iv,
+                                                 check1[i].iv_size, &expected_iv_length);
         TEST_ASSERT_EQUAL(status, PSA_ERROR_BAD_STATE, TEST_CHECKPOINT_NUM(10));
 
         /* Abort a cipher operation */
-        status = val->crypto_function(VAL_CRYPTO_CIPHER_ABORT, &operation);
+        status = val->crypto->cipher_abort(&operation);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(11));
 
         /* Destroy the key */
-        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+        status = val->crypto->destroy_key(key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(12));
 
         /* Reset the key attributes and check if psa_import_key fails */
-        val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &attributes);
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].data,
-                                      check1[i].data_length, &key);
+        val->crypto->reset_key_attributes(&attributes);
+        status = val->crypto->import_key(&attributes, check1[i].data,
+                                         check1[i].data_length, &key);
         TEST_ASSERT_EQUAL(status, PSA_ERROR_NOT_SUPPORTED, TEST_CHECKPOINT_NUM(13));
     }
 
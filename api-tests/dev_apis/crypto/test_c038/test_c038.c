@@ -50,7 +50,7 @@ int32_t psa_cipher_abort_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     for (i = 0; i < num_checks; i++)
@@ -64,43 +64,43 @@ int32_t psa_cipher_abort_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Setup the attributes for the key */
-        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE,        &attributes, check1[i].type);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM,   &attributes, check1[i].alg);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes, check1[i].usage_flags);
+        val->crypto->set_key_type(&attributes, check1[i].type);
+        val->crypto->set_key_algorithm(&attributes, check1[i].alg);
+        val->crypto->set_key_usage_flags(&attributes, check1[i].usage_flags);
 
         /* Import the key data into the key slot */
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].data,
-                                      check1[i].data_length, &key);
+        status = val->crypto->import_key(&attributes, check1[i].data,
+                                         check1[i].data_length, &key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         if (check1[i].usage_flags == PSA_KEY_USAGE_ENCRYPT)
         {
             /* Set the key for a multipart symmetric encryption operation */
-            status = val->crypto_function(VAL_CRYPTO_CIPHER_ENCRYPT_SETUP, &operation, key,
-                                          check1[i].alg);
+            status = val->crypto->cipher_encrypt_setup(&operation, key,
+                                                       check1[i].alg);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
         } else if (check1[i].usage_flags == PSA_KEY_USAGE_DECRYPT)
         {
             /* Set the key for a multipart symmetric decryption operation */
-            status = val->crypto_function(VAL_CRYPTO_CIPHER_DECRYPT_SETUP, &operation, key,
-                                          check1[i].alg);
+            status = val->crypto->cipher_decrypt_setup(&operation, key,
+                                                       check1[i].alg);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
         }
 
         /* Abort a cipher operation */
-        status = val->crypto_function(VAL_CRYPTO_CIPHER_ABORT, &operation);
+        status = val->crypto->cipher_abort(&operation);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(6));
 
         /* Multiple abort cipher operation should return success*/
-        status = val->crypto_function(VAL_CRYPTO_CIPHER_ABORT, &operation);
+        status = val->crypto->cipher_abort(&operation);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(7));
 
         /* Destroy the key */
-        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+        status = val->crypto->destroy_key(key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
 
         /* Reset the key attributes and check if psa_import_key fails */
-        val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &attributes);
+        val->crypto->reset_key_attributes(&attributes);
 
         if (valid_test_input_index < 0)
             valid_test_input_index = i;
@@ -129,7 +129,7 @@ int32_t psa_cipher_abort_before_update_test(caller_security_t caller __UNUSED)
         return RESULT_SKIP(VAL_STATUS_NO_TESTS);
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
@@ -141,43 +141,39 @@ int32_t psa_cipher_abort_before_update_test(caller_security_t caller __UNUSED)
     TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
     /* Setup the attributes for the key */
-    val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE,
-                         &attributes, check1[valid_test_input_index].type);
-    val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM,
-                         &attributes, check1[valid_test_input_index].alg);
-    val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS,
-                         &attributes, check1[valid_test_input_index].usage_flags);
+    val->crypto->set_key_type(&attributes, check1[valid_test_input_index].type);
+    val->crypto->set_key_algorithm(&attributes, check1[valid_test_input_index].alg);
+    val->crypto->set_key_usage_flags(&attributes, check1[valid_test_input_index].usage_flags);
 
     /* Import the key data into the key slot */
-    status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY,
-                                  &attributes, check1[valid_test_input_index].data,
-                                  check1[valid_test_input_index].data_length, &key);
+    status = val->crypto->import_key(&attributes, check1[valid_test_input_index].data,
+                                     check1[valid_test_input_index].data_length, &key);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
     /* Set the key for a multipart symmetric encryption operation */
-    status = val->crypto_function(VAL_CRYPTO_CIPHER_ENCRYPT_SETUP, &operation, key,
-                                  check1[valid_test_input_index].alg);
+    status = val->crypto->cipher_encrypt_setup(&operation, key,
+                                               check1[valid_test_input_index].alg);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
 
     /* Set an IV for a symmetric encryption operation */
-    status = val->crypto_function(VAL_CRYPTO_CIPHER_SET_IV, &operation, iv, 16);
+    status = val->crypto->cipher_set_iv(&operation, iv, 16);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
     /* Abort a cipher operation */
-    status = val->crypto_function(VAL_CRYPTO_CIPHER_ABORT, &operation);
+    status = val->crypto->cipher_abort(&operation);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(6));
 
     /* Encrypt or decrypt a message fragment in an active cipher operation */
-    status = val->crypto_function(VAL_CRYPTO_CIPHER_UPDATE, &operation, plaintext, 16,
-                                  expected_output, BUFFER_SIZE, &get_output_length);
+    status = val->crypto->cipher_update(&operation, plaintext, 16,
+                                        expected_output, BUFFER_SIZE, &get_output_length);
     TEST_ASSERT_EQUAL(status, PSA_ERROR_BAD_STATE, TEST_CHECKPOINT_NUM(7));
 
     /* Destroy the key */
-    status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+    status = val->crypto->destroy_key(key);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
 
     /* Reset the key attributes and check if psa_import_key fails */
-    val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &attributes);
+    val->crypto->reset_key_attributes(&attributes);
 
     return VAL_STATUS_SUCCESS;
 #else
@@ -48,7 +48,7 @@ int32_t psa_asymmetric_encrypt_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     for (i = 0; i < num_checks; i++)
@@ -61,36 +61,35 @@ int32_t psa_asymmetric_encrypt_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Setup the attributes for the key */
-        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE,        &attributes, check1[i].type);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM,   &attributes, check1[i].alg);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes, check1[i].usage_flags);
+        val->crypto->set_key_type(&attributes, check1[i].type);
+        val->crypto->set_key_algorithm(&attributes, check1[i].alg);
+        val->crypto->set_key_usage_flags(&attributes, check1[i].usage_flags);
 
         /* Import the key data into the key slot */
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].data,
-                                      check1[i].data_length, &key);
+        status = val->crypto->import_key(&attributes, check1[i].data,
+                                         check1[i].data_length, &key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Encrypt a short message with a public key */
-        status = val->crypto_function(VAL_CRYPTO_ASYMMETRIC_ENCRYPT,
-                                      key,
-                                      check1[i].alg,
-                                      check1[i].input,
-                                      check1[i].input_length,
-                                      check1[i].salt,
-                                      check1[i].salt_length,
-                                      check1[i].output,
-                                      check1[i].output_size,
-                                      &get_output_length);
+        status = val->crypto->asymmetric_encrypt(key,
+                                                 check1[i].alg,
+                                                 check1[i].input,
+                                                 check1[i].input_length,
+                                                 check1[i].salt,
+                                                 check1[i].salt_length,
+                                                 check1[i].output,
+                                                 check1[i].output_size,
+                                                 &get_output_length);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(4));
 
         if (check1[i].expected_status != PSA_SUCCESS)
         {
             /* Destroy the key */
-            status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+            status = val->crypto->destroy_key(key);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
             /* Reset the key attributes and check if psa_import_key fails */
-            val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &attributes);
+            val->crypto->reset_key_attributes(&attributes);
             continue;
         }
 
@@ -103,16 +102,15 @@ int32_t psa_asymmetric_encrypt_test(caller_security_t caller __UNUSED)
          * part of encryption process which prevents using fixed vectors. */
         if ((check1[i].usage_flags & PSA_KEY_USAGE_DECRYPT) == PSA_KEY_USAGE_DECRYPT)
         {
-            status = val->crypto_function(VAL_CRYPTO_ASYMMETRIC_DECRYPT,
-                                          key,
-                                          check1[i].alg,
-                                          check1[i].output,
-                                          get_output_length,
-                                          check1[i].salt,
-                                          check1[i].salt_length,
-                                          check1[i].output + get_output_length,
-                                          check1[i].output_size - get_output_length,
-                                          &get_output_length);
+            status = val->crypto->asymmetric_decrypt(key,
+                                                     check1[i].alg,
+                                                     check1[i].output,
+                                                     get_output_length,
+                                                     check1[i].salt,
+                                                     check1[i].salt_length,
+                                                     check1[i].output + get_output_length,
+                                                     check1[i].output_size - get_output_length,
+                                                     &get_output_length);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(7));
 
             /* Check if the output length matches with the input length */
@@ -125,13 +123,13 @@ int32_t psa_asymmetric_encrypt_test(caller_security_t caller __UNUSED)
         }
 
         /* Destroy the key */
-        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+        status = val->crypto->destroy_key(key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(10));
 
         /* Reset the key attributes and check if psa_import_key fails */
-        val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &attributes);
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].data,
-                                      check1[i].data_length, &key);
+        val->crypto->reset_key_attributes(&attributes);
+        status = val->crypto->import_key(&attributes, check1[i].data,
+                                         check1[i].data_length, &key);
         TEST_ASSERT_EQUAL(status, PSA_ERROR_NOT_SUPPORTED, TEST_CHECKPOINT_NUM(11));
 
         if (valid_test_input_index < 0)
@@ -160,7 +158,7 @@ int32_t psa_asymmetric_encrypt_negative_test(caller_security_t caller __UNUSED)
         return RESULT_SKIP(VAL_STATUS_NO_TESTS);
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     /* Setting up the watchdog timer for each check */
@@ -170,31 +168,29 @@ int32_t psa_asymmetric_encrypt_negative_test(caller_security_t caller __UNUSED)
     val->print(PRINT_TEST, "[Check %d] Test psa_asymmetric_encrypt - Invalid key handle\n",
                                                                              g_test_count++);
     /* Encrypt a short message with a public key */
-    status = val->crypto_function(VAL_CRYPTO_ASYMMETRIC_ENCRYPT,
-                                  key,
-                                  check1[valid_test_input_index].alg,
-                                  check1[valid_test_input_index].input,
-                                  check1[valid_test_input_index].input_length,
-                                  check1[valid_test_input_index].salt,
-                                  check1[valid_test_input_index].salt_length,
-                                  check1[valid_test_input_index].output,
-                                  check1[valid_test_input_index].output_size,
-                                  &get_output_length);
+    status = val->crypto->asymmetric_encrypt(key,
+                                             check1[valid_test_input_index].alg,
+                                             check1[valid_test_input_index].input,
+                                             check1[valid_test_input_index].input_length,
+                                             check1[valid_test_input_index].salt,
+                                             check1[valid_test_input_index].salt_length,
+                                             check1[valid_test_input_index].output,
+                                             check1[valid_test_input_index].output_size,
+                                             &get_output_length);
     TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_HANDLE, TEST_CHECKPOINT_NUM(3));
 
     val->print(PRINT_TEST, "[Check %d] Test psa_asymmetric_encrypt - Zero as key handle\n",
                                                                              g_test_count++);
     /* Encrypt a short message with a public key */
-    status = val->crypto_function(VAL_CRYPTO_ASYMMETRIC_ENCRYPT,
-                                  0,
-                                  check1[valid_test_input_index].alg,
-                                  check1[valid_test_input_index].input,
-                                  check1[valid_test_input_index].input_length,
-                                  check1[valid_test_input_index].salt,
-                                  check1[valid_test_input_index].salt_length,
-                                  check1[valid_test_input_index].output,
-                                  check1[valid_test_input_index].output_size,
-                                  &get_output_length);
+    status = val->crypto->asymmetric_encrypt(0,
+                                             check1[valid_test_input_index].alg,
+                                             check1[valid_test_input_index].input,
+                                             check1[valid_test_input_index].input_length,
+                                             check1[valid_test_input_index].salt,
+                                             check1[valid_test_input_index].salt_length,
+                                             check1[valid_test_input_index].output,
+                                             check1[valid_test_input_index].output_size,
+                                             &get_output_length);
     TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_HANDLE, TEST_CHECKPOINT_NUM(4));
 
     return VAL_STATUS_SUCCESS;
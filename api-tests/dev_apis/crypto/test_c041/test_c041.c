@@ -46,7 +46,7 @@ int32_t psa_sign_hash_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     for (i = 0; i < num_checks; i++)
@@ -59,30 +59,29 @@ int32_t psa_sign_hash_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Setup the attributes for the key */
-        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE,        &attributes, check1[i].type);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM,   &attributes, check1[i].alg);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes, check1[i].usage_flags);
+        val->crypto->set_key_type(&attributes, check1[i].type);
+        val->crypto->set_key_algorithm(&attributes, check1[i].alg);
+        val->crypto->set_key_usage_flags(&attributes, check1[i].usage_flags);
 
         /* Import the key data into the key slot */
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].data,
-                                      check1[i].data_length, &key);
+        status = val->crypto->import_key(&attributes, check1[i].data,
+                                         check1[i].data_length, &key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Sign a hash or short message with a private key */
-        status = val->crypto_function(VAL_CRYPTO_SIGN_HASH,
-                                      key,
-                                      check1[i].alg,
-                                      check1[i].hash,
-                                      check1[i].hash_length,
-                                      check1[i].signature,
-                                      check1[i].signature_size,
-                                      &get_signature_length);
+        status = val->crypto->sign_hash(key,
+                                        check1[i].alg,
+                                        check1[i].hash,
+                                        check1[i].hash_length,
+                                        check1[i].signature,
+                                        check1[i].signature_size,
+                                        &get_signature_length);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(4));
 
         if (check1[i].expected_status != PSA_SUCCESS)
         {
             /* Destroy the key */
-            status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+            status = val->crypto->destroy_key(key);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
             continue;
@@ -94,22 +93,21 @@ int32_t psa_sign_hash_test(caller_security_t caller __UNUSED)
 
 
         /* Destroy a key and restore the slot to its default state */
-        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+        status = val->crypto->destroy_key(key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(7));
 
        /* verify the expected signature for the hash */
        memset(&attributes, 0, sizeof(psa_key_attributes_t));
-       val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE,        &attributes, check1[i].type);
-       val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM,   &attributes, check1[i].alg);
-       val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes, PSA_KEY_USAGE_VERIFY_HASH);
+       val->crypto->set_key_type(&attributes, check1[i].type);
+       val->crypto->set_key_algorithm(&attributes, check1[i].alg);
+       val->crypto->set_key_usage_flags(&attributes, PSA_KEY_USAGE_VERIFY_HASH);
        /* Import the key data into the key slot */
-       status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].data,
+       status = val->crypto->import_key(&attributes, check1[i].data,
                                       check1[i].data_length, &key);
        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
 
 	  /* Verify the signature a hash or short message using a public key */
-       status = val->crypto_function(VAL_CRYPTO_VERIFY_HASH,
-                                 key,
+       status = val->crypto->verify_hash(key,
                                  check1[i].alg,
                                  check1[i].hash,
                                  check1[i].hash_length,
@@ -117,7 +115,7 @@ int32_t psa_sign_hash_test(caller_security_t caller __UNUSED)
                                  check1[i].expected_signature_length);
        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(9));
        /* Destroy the key */
-       status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+       status = val->crypto->destroy_key(key);
        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(10));
 
        if (valid_test_input_index < 0)
@@ -137,7 +135,7 @@ int32_t psa_sign_hash_negative_test(caller_security_t caller __UNUSED)
         return RESULT_SKIP(VAL_STATUS_NO_TESTS);
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     /* Setting up the watchdog timer for each check */
@@ -147,27 +145,25 @@ int32_t psa_sign_hash_negative_test(caller_security_t caller __UNUSED)
     val->print(PRINT_TEST, "[Check %d] Test psa_sign_hash - Invalid key handle\n",
                                                                             g_test_count++);
     /* Sign a hash or short message with a private key */
-    status = val->crypto_function(VAL_CRYPTO_SIGN_HASH,
-                                  key,
-                                  check1[valid_test_input_index].alg,
-                                  check1[valid_test_input_index].hash,
-                                  check1[valid_test_input_index].hash_length,
-                                  check1[valid_test_input_index].signature,
-                                  check1[valid_test_input_index].signature_size,
-                                  &get_signature_length);
+    status = val->crypto->sign_hash(key,
+                                    check1[valid_test_input_index].alg,
+                                    check1[valid_test_input_index].hash,
+                                    check1[valid_test_input_index].hash_length,
+                                    check1[valid_test_input_index].signature,
+                                    check1[valid_test_input_index].signature_size,
+                                    &get_signature_length);
     TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_HANDLE, TEST_CHECKPOINT_NUM(3));
 
     val->print(PRINT_TEST, "[Check %d] Test psa_sign_hash - Zero as key handle\n",
                                                                             g_test_count++);
     /* Sign a hash or short message with a private key */
-    status = val->crypto_function(VAL_CRYPTO_SIGN_HASH,
-                                  0,
-                                  check1[valid_test_input_index].alg,
-                                  check1[valid_test_input_index].hash,
-                                  check1[valid_test_input_index].hash_length,
-                                  check1[valid_test_input_index].signature,
-                                  check1[valid_test_input_index].signature_size,
-                                  &get_signature_length);
+    status = val->crypto->sign_hash(0,
+                                    check1[valid_test_input_index].alg,
+                                    check1[valid_test_input_index].hash,
+                                    check1[valid_test_input_index].hash_length,
+                                    check1[valid_test_input_index].signature,
+                                    check1[valid_test_input_index].signature_size,
+                                    &get_signature_length);
     TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_HANDLE, TEST_CHECKPOINT_NUM(4));
 
     return VAL_STATUS_SUCCESS;
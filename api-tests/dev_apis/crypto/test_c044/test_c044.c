@@ -47,7 +47,7 @@ int32_t psa_copy_key_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     /* Set the key data buffer to the input base on algorithm */
@@ -61,69 +61,68 @@ int32_t psa_copy_key_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Setup the attributes for the key */
-        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE,        &source_attributes, check1[i].type);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM,   &source_attributes, check1[i].alg);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &source_attributes,
-                             check1[i].usage_flags);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_LIFETIME,    &source_attributes,
-                             check1[i].lifetime);
+        val->crypto->set_key_type(&source_attributes, check1[i].type);
+        val->crypto->set_key_algorithm(&source_attributes, check1[i].alg);
+        val->crypto->set_key_usage_flags(&source_attributes,
+                                         check1[i].usage_flags);
+        val->crypto->set_key_lifetime(&source_attributes,
+                                      check1[i].lifetime);
 
         /* Import the key data into the key slot */
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &source_attributes, check1[i].data,
-                                      check1[i].data_length, &key);
+        status = val->crypto->import_key(&source_attributes, check1[i].data,
+                                         check1[i].data_length, &key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Setup the attributes for the target key */
-        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE,        &target_attributes,
-                             check1[i].target_type);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM,   &target_attributes,
-                             check1[i].target_alg);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &target_attributes,
-                             check1[i].target_usage_flags);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_LIFETIME,    &target_attributes,
-                             check1[i].target_lifetime);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_BITS,        &target_attributes,
-                             check1[i].target_bits);
+        val->crypto->set_key_type(&target_attributes,
+                                  check1[i].target_type);
+        val->crypto->set_key_algorithm(&target_attributes,
+                                       check1[i].target_alg);
+        val->crypto->set_key_usage_flags(&target_attributes,
+                                         check1[i].target_usage_flags);
+        val->crypto->set_key_lifetime(&target_attributes,
+                                      check1[i].target_lifetime);
+        val->crypto->set_key_bits(&target_attributes,
+                                  check1[i].target_bits);
 
         /* Make a copy of a key */
-        status = val->crypto_function(VAL_CRYPTO_COPY_KEY, key, &target_attributes,
-                                      &target_key);
+        status = val->crypto->copy_key(key, &target_attributes,
+                                       &target_key);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(4));
 
         /* Destroy the source key */
-        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+        status = val->crypto->destroy_key(key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
         if (check1[i].expected_status != PSA_SUCCESS)
         {
-            val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &source_attributes);
-            val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &target_attributes);
+            val->crypto->reset_key_attributes(&source_attributes);
+            val->crypto->reset_key_attributes(&target_attributes);
 
             continue;
         }
 
         /* Check if the target key attributes is as expected */
-        status = val->crypto_function(VAL_CRYPTO_GET_KEY_ATTRIBUTES, target_key,
-                                      &target_attributes);
+        status = val->crypto->get_key_attributes(target_key,
+                                                 &target_attributes);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(6));
 
-        val->crypto_function(VAL_CRYPTO_GET_KEY_TYPE, &target_attributes, &get_type);
+        get_type = val->crypto->get_key_type(&target_attributes);
         TEST_ASSERT_EQUAL(get_type, check1[i].target_type, TEST_CHECKPOINT_NUM(7));
 
-        val->crypto_function(VAL_CRYPTO_GET_KEY_USAGE_FLAGS, &target_attributes,
-                             &get_usage_flags);
+        get_usage_flags = val->crypto->get_key_usage_flags(&target_attributes);
         TEST_ASSERT_EQUAL(get_usage_flags, check1[i].expected_usage_flags, TEST_CHECKPOINT_NUM(8));
 
-        val->crypto_function(VAL_CRYPTO_GET_KEY_ALGORITHM, &target_attributes, &get_alg);
+        get_alg = val->crypto->get_key_algorithm(&target_attributes);
         TEST_ASSERT_EQUAL(get_alg, check1[i].target_alg, TEST_CHECKPOINT_NUM(9));
 
-        val->crypto_function(VAL_CRYPTO_GET_KEY_BITS, &target_attributes, &get_bits);
+        get_bits = val->crypto->get_key_bits(&target_attributes);
         TEST_ASSERT_EQUAL(get_bits, check1[i].target_bits, TEST_CHECKPOINT_NUM(10));
 
         /* Export a key in binary format */
-        export_status = val->crypto_function(VAL_CRYPTO_EXPORT_KEY, target_key,
-                                             check1[i].expected_data, check1[i].expected_data_size,
-                                             &get_data_length);
+        export_status = val->crypto->export_key(target_key,
+                                                check1[i].expected_data, check1[i].expected_data_size,
+                                                &get_data_length);
 
         if (check1[i].expected_usage_flags & PSA_KEY_USAGE_EXPORT)
         {
@@ -138,16 +137,16 @@ int32_t psa_copy_key_test(caller_security_t caller __UNUSED)
         }
 
         /* Destroy the target key */
-        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, target_key);
+        status = val->crypto->destroy_key(target_key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(14));
 
         /* Copy on a destroyed source should be an error */
-        status = val->crypto_function(VAL_CRYPTO_COPY_KEY, key, &target_attributes,
-                                      &target_key);
+        status = val->crypto->copy_key(key, &target_attributes,
+                                       &target_key);
         TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_HANDLE, TEST_CHECKPOINT_NUM(14));
 
-        val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &source_attributes);
-        val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &target_attributes);
+        val->crypto->reset_key_attributes(&source_attributes);
+        val->crypto->reset_key_attributes(&target_attributes);
     }
 
     return VAL_STATUS_SUCCESS;
@@ -48,7 +48,7 @@ int32_t psa_hash_clone_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     for (i = 0; i < num_checks; i++)
@@ -65,41 +65,37 @@ int32_t psa_hash_clone_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Start a multipart hash operation */
-        status = val->crypto_function(VAL_CRYPTO_HASH_SETUP, &source_operation, check1[i].alg);
+        status = val->crypto->hash_setup(&source_operation, check1[i].alg);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Clone a hash operation */
-        status = val->crypto_function(VAL_CRYPTO_HASH_CLONE, &source_operation, &target_operation);
+        status = val->crypto->hash_clone(&source_operation, &target_operation);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(4));
 
         /* Add a message fragment to a multipart for source_operation */
-        status = val->crypto_function(VAL_CRYPTO_HASH_UPDATE,
-                                      &source_operation,
-                                      check1[i].input,
-                                      check1[i].input_length);
+        status = val->crypto->hash_update(&source_operation,
+                                          check1[i].input,
+                                          check1[i].input_length);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
         /* Add a message fragment to a multipart for target_operation */
-        status = val->crypto_function(VAL_CRYPTO_HASH_UPDATE,
-                                      &target_operation,
-                                      check1[i].input,
-                                      check1[i].input_length);
+        status = val->crypto->hash_update(&target_operation,
+                                          check1[i].input,
+                                          check1[i].input_length);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(6));
 
         /* Finish the calculation of the hash of a message for source operation */
-        status = val->crypto_function(VAL_CRYPTO_HASH_FINISH,
-                                      &source_operation,
-                                      check1[i].source_hash,
-                                      check1[i].source_hash_size,
-                                      &get_source_hash_length);
+        status = val->crypto->hash_finish(&source_operation,
+                                          check1[i].source_hash,
+                                          check1[i].source_hash_size,
+                                          &get_source_hash_length);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(7));
 
         /* Finish the calculation of the hash of a message for target operation */
-        status = val->crypto_function(VAL_CRYPTO_HASH_FINISH,
-                                      &target_operation,
-                                      check1[i].target_hash,
-                                      check1[i].target_hash_size,
-                                      &get_target_hash_length);
+        status = val->crypto->hash_finish(&target_operation,
+                                          check1[i].target_hash,
+                                          check1[i].target_hash_size,
+                                          &get_target_hash_length);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
 
         /* Check for expected hash length for source and target operation */
@@ -117,10 +113,10 @@ int32_t psa_hash_clone_test(caller_security_t caller __UNUSED)
             valid_test_input_index = i;
 
         /* Abort the hash operation */
-        status = val->crypto_function(VAL_CRYPTO_HASH_ABORT, &source_operation);
+        status = val->crypto->hash_abort(&source_operation);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(11));
 
-        status = val->crypto_function(VAL_CRYPTO_HASH_ABORT, &target_operation);
+        status = val->crypto->hash_abort(&target_operation);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(12));
     }
 
@@ -138,7 +134,7 @@ int32_t psa_hash_clone_with_inactive_source_operation(caller_security_t caller _
         return RESULT_SKIP(VAL_STATUS_NO_TESTS);
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     val->print(PRINT_TEST, "[Check %d] Test psa_hash_clone - from an inactive source operation\n",
@@ -152,23 +148,21 @@ int32_t psa_hash_clone_with_inactive_source_operation(caller_security_t caller _
     TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
     /* Start a multipart hash operation */
-    status = val->crypto_function(VAL_CRYPTO_HASH_SETUP, &source_operation,
-                                  check1[valid_test_input_index].alg);
+    status = val->crypto->hash_setup(&source_operation,
+                                     check1[valid_test_input_index].alg);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
     /* Add a message fragment to a multipart for source_operation */
-    status = val->crypto_function(VAL_CRYPTO_HASH_UPDATE,
-                                  &source_operation,
-                                  check1[valid_test_input_index].input,
-                                  check1[valid_test_input_index].input_length);
+    status = val->crypto->hash_update(&source_operation,
+                                      check1[valid_test_input_index].input,
+                                      check1[valid_test_input_index].input_length);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
 
     /* Finish the calculation of the hash of a message for source operation */
-    status = val->crypto_function(VAL_CRYPTO_HASH_FINISH,
-                                  &source_operation,
-                                  check1[valid_test_input_index].source_hash,
-                                  check1[valid_test_input_index].source_hash_size,
-                                  &get_source_hash_length);
+    status = val->crypto->hash_finish(&source_operation,
+                                      check1[valid_test_input_index].source_hash,
+                                      check1[valid_test_input_index].source_hash_size,
+                                      &get_source_hash_length);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
     /* Check for expected hash length for source operation */
@@ -180,11 +174,11 @@ int32_t psa_hash_clone_with_inactive_source_operation(caller_security_t caller _
                        TEST_CHECKPOINT_NUM(7));
 
     /* Clone from an inactive source operation */
-    status = val->crypto_function(VAL_CRYPTO_HASH_CLONE, &source_operation, &target_operation);
+    status = val->crypto->hash_clone(&source_operation, &target_operation);
     TEST_ASSERT_EQUAL(status, PSA_ERROR_BAD_STATE, TEST_CHECKPOINT_NUM(8));
 
     /* Abort the hash operation */
-    status = val->crypto_function(VAL_CRYPTO_HASH_ABORT, &source_operation);
+    status = val->crypto->hash_abort(&source_operation);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(9));
 
     return VAL_STATUS_SUCCESS;
@@ -200,7 +194,7 @@ int32_t psa_hash_clone_with_active_target_operation(caller_security_t caller __U
         return RESULT_SKIP(VAL_STATUS_NO_TESTS);
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     val->print(PRINT_TEST, "[Check %d] Test psa_hash_clone - on an active target operation\n",
@@ -214,23 +208,23 @@ int32_t psa_hash_clone_with_active_target_operation(caller_security_t caller __U
     TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
     /* Start a multipart hash operation */
-    status = val->crypto_function(VAL_CRYPTO_HASH_SETUP, &source_operation,
-                                  check1[valid_test_input_index].alg);
+    status = val->crypto->hash_setup(&source_operation,
+                                     check1[valid_test_input_index].alg);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
     /* Clone from an active source operation */
-    status = val->crypto_function(VAL_CRYPTO_HASH_CLONE, &source_operation, &target_operation);
+    status = val->crypto->hash_clone(&source_operation, &target_operation);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
 
     /* Try clonig to an active hash operation and expect an error */
-    status = val->crypto_function(VAL_CRYPTO_HASH_CLONE, &source_operation, &target_operation);
+    status = val->crypto->hash_clone(&source_operation, &target_operation);
     TEST_ASSERT_EQUAL(status, PSA_ERROR_BAD_STATE, TEST_CHECKPOINT_NUM(5));
 
     /* Abort the hash operation */
-    status = val->crypto_function(VAL_CRYPTO_HASH_ABORT, &source_operation);
+    status = val->crypto->hash_abort(&source_operation);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(6));
 
-    status = val->crypto_function(VAL_CRYPTO_HASH_ABORT, &target_operation);
+    status = val->crypto->hash_abort(&target_operation);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(7));
 
     return VAL_STATUS_SUCCESS;
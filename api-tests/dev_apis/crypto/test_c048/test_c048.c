@@ -45,7 +45,7 @@ int32_t psa_mac_sign_multipart_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     for (i = 0; i < num_checks; i++)
@@ -59,28 +59,28 @@ int32_t psa_mac_sign_multipart_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Setup the attributes for the key */
-        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE, &attributes, check1[i].key_type);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes, check1[i].usage);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM, &attributes, check1[i].key_alg);
+        val->crypto->set_key_type(&attributes, check1[i].key_type);
+        val->crypto->set_key_usage_flags(&attributes, check1[i].usage);
+        val->crypto->set_key_algorithm(&attributes, check1[i].key_alg);
 
         /* Import the key data into the key slot */
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].key_data,
+        status = val->crypto->import_key(&attributes, check1[i].key_data,
                  check1[i].key_length, &key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Setting up multi-part MAC calculation operation */
-        status = val->crypto_function(VAL_CRYPTO_MAC_SIGN_SETUP, &operation, key,
+        status = val->crypto->mac_sign_setup(&operation, key,
                  check1[i].mac_alg);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
 
         /* Add message fragment to the multi-part MAC operation */
-        status = val->crypto_function(VAL_CRYPTO_MAC_UPDATE, &operation,
-                 &check1[i].data, check1[i].data_size);
+        status = val->crypto->mac_update(&operation,
+                 check1[i].data, check1[i].data_size);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
         /* Finish the calculation of MAC of the message */
-        status = val->crypto_function(VAL_CRYPTO_MAC_SIGN_FINISH, &operation,
-                 &data, check1[i].mac_size, &length);
+        status = val->crypto->mac_sign_finish(&operation,
+                 data, check1[i].mac_size, &length);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(6));
 
         /* Check if the MAC data matches with the expected data */
@@ -89,15 +89,15 @@ int32_t psa_mac_sign_multipart_test(caller_security_t caller __UNUSED)
         memset(data, 0, sizeof(data));
 
         /* Abort the MAC operation */
-        status = val->crypto_function(VAL_CRYPTO_MAC_ABORT, &operation);
+        status = val->crypto->mac_abort(&operation);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
 
         /* Destroy the key */
-        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+        status = val->crypto->destroy_key(key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(9));
 
         /* Reset the key attributes and check if psa_import_key fails */
-        val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &attributes);
+        val->crypto->reset_key_attributes(&attributes);
 
     }
     return VAL_STATUS_SUCCESS;
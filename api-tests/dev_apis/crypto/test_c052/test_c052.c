@@ -49,7 +49,7 @@ int32_t psa_sign_message_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     for (i = 0; i < num_checks; i++)
@@ -62,40 +62,34 @@ int32_t psa_sign_message_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Setup the attributes for the key */
-        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE,
-                             &attributes,
-                             check1[i].type);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM,
-                             &attributes,
-                             check1[i].alg);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS,
-                             &attributes,
-                             check1[i].usage_flags);
+        val->crypto->set_key_type(&attributes,
+                                  check1[i].type);
+        val->crypto->set_key_algorithm(&attributes,
+                                       check1[i].alg);
+        val->crypto->set_key_usage_flags(&attributes,
+                                         check1[i].usage_flags);
 
         /* Import the key data into the key slot */
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY,
-                                      &attributes,
-                                      check1[i].data,
-                                      check1[i].data_length,
-                                      &key);
+        status = val->crypto->import_key(&attributes,
+                                         check1[i].data,
+                                         check1[i].data_length,
+                                         &key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Sign a message with a private key */
-        status = val->crypto_function(VAL_CRYPTO_SIGN_MESSAGE,
-                                      key,
-                                      check1[i].sign_alg,
-                                      check1[i].input,
-                                      check1[i].input_length,
-                                      check1[i].signature,
-                                      check1[i].signature_size,
-                                      &get_signature_length);
+        status = val->crypto->sign_message(key,
+                                           check1[i].sign_alg,
+                                           check1[i].input,
+                                           check1[i].input_length,
+                                           check1[i].signature,
+                                           check1[i].signature_size,
+                                           &get_signature_length);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(4));
 
         if (check1[i].expected_status != PSA_SUCCESS)
         {
             /* Destroy the key */
-            status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY,
-                                          key);
+            status = val->crypto->destroy_key(key);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
             continue;
@@ -110,8 +104,7 @@ int32_t psa_sign_message_test(caller_security_t caller __UNUSED)
                            TEST_CHECKPOINT_NUM(7));
 
         /* Destroy the key */
-        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY,
-                                      key);
+        status = val->crypto->destroy_key(key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
 
         if (valid_test_input_index < 0)
@@ -138,7 +131,7 @@ int32_t psa_sign_message_negative_test(caller_security_t caller __UNUSED)
         return RESULT_SKIP(VAL_STATUS_NO_TESTS);
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     /* Setting up the watchdog timer for each check */
@@ -148,27 +141,25 @@ int32_t psa_sign_message_negative_test(caller_security_t caller __UNUSED)
     val->print(PRINT_TEST, "[Check %d] Test psa_sign_message - Invalid key handle\n",
                                                                             g_test_count++);
     /* Sign a message with a private key */
-    status = val->crypto_function(VAL_CRYPTO_SIGN_MESSAGE,
-                                  key,
-                                  check1[valid_test_input_index].sign_alg,
-                                  check1[valid_test_input_index].input,
-                                  check1[valid_test_input_index].input_length,
-                                  check1[valid_test_input_index].signature,
-                                  check1[valid_test_input_index].signature_size,
-                                  &get_signature_length);
+    status = val->crypto->sign_message(key,
+                                       check1[valid_test_input_index].sign_alg,
+                                       check1[valid_test_input_index].input,
+                                       check1[valid_test_input_index].input_length,
+                                       check1[valid_test_input_index].signature,
+                                       check1[valid_test_input_index].signature_size,
+                                       &get_signature_length);
     TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_HANDLE, TEST_CHECKPOINT_NUM(3));
 
     val->print(PRINT_TEST, "[Check %d] Test psa_sign_message - Zero as key handle\n",
                                                                             g_test_count++);
     /* Sign message with a private key */
-    status = val->crypto_function(VAL_CRYPTO_SIGN_MESSAGE,
-                                  0,
-                                  check1[valid_test_input_index].sign_alg,
-                                  check1[valid_test_input_index].input,
-                                  check1[valid_test_input_index].input_length,
-                                  check1[valid_test_input_index].signature,
-                                  check1[valid_test_input_index].signature_size,
-                                  &get_signature_length);
+    status = val->crypto->sign_message(0,
+                                       check1[valid_test_input_index].sign_alg,
+                                       check1[valid_test_input_index].input,
+                                       check1[valid_test_input_index].input_length,
+                                       check1[valid_test_input_index].signature,
+                                       check1[valid_test_input_index].signature_size,
+                                       &get_signature_length);
     TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_HANDLE, TEST_CHECKPOINT_NUM(4));
 
     return VAL_STATUS_SUCCESS;
@@ -48,7 +48,7 @@ int32_t psa_verify_message_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     for (i = 0; i < num_checks; i++)
@@ -61,37 +61,31 @@ int32_t psa_verify_message_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Setup the attributes for the key */
-        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE,
-                             &attributes,
-                             check1[i].type);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM,
-                             &attributes,
-                             check1[i].alg);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS,
-                             &attributes,
-                             check1[i].usage_flags);
+        val->crypto->set_key_type(&attributes,
+                                  check1[i].type);
+        val->crypto->set_key_algorithm(&attributes,
+                                       check1[i].alg);
+        val->crypto->set_key_usage_flags(&attributes,
+                                         check1[i].usage_flags);
 
         /* Import the key data into the key slot */
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY,
-                                      &attributes,
-                                      check1[i].data,
-                                      check1[i].data_length,
-                                      &key);
+        status = val->crypto->import_key(&attributes,
+                                         check1[i].data,
+                                         check1[i].data_length,
+                                         &key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Verify the signature a hash or short message using a public key */
-        status = val->crypto_function(VAL_CRYPTO_VERIFY_MESSAGE,
-                                      key,
-                                      check1[i].alg,
-                                      check1[i].input,
-                                      check1[i].input_length,
-                                      check1[i].signature,
-                                      check1[i].signature_length);
+        status = val->crypto->verify_message(key,
+                                             check1[i].alg,
+                                             check1[i].input,
+                                             check1[i].input_length,
+                                             check1[i].signature,
+                                             check1[i].signature_length);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(4));
 
         /* Destroy a key and restore the slot to its default state */
-        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY,
-                                      key);
+        status = val->crypto->destroy_key(key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
 
@@ -119,7 +113,7 @@ int32_t psa_verify_message_negative_test(caller_security_t caller __UNUSED)
         return RESULT_SKIP(VAL_STATUS_NO_TESTS);
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     val->print(PRINT_TEST, "[Check %d] Test psa_verify_message - Invalid key handle\n",
@@ -130,25 +124,23 @@ int32_t psa_verify_message_negative_test(caller_security_t caller __UNUSED)
     TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
     /* Verify the signature a hash or short message using a public key */
-    status = val->crypto_function(VAL_CRYPTO_VERIFY_HASH,
-                                  key,
-                                  check1[valid_test_input_index].alg,
-                                  check1[valid_test_input_index].input,
-                                  check1[valid_test_input_index].input_length,
-                                  check1[valid_test_input_index].signature,
-                                  check1[valid_test_input_index].signature_length);
+    status = val->crypto->verify_hash(key,
+                                      check1[valid_test_input_index].alg,
+                                      check1[valid_test_input_index].input,
+                                      check1[valid_test_input_index].input_length,
+                                      check1[valid_test_input_index].signature,
+                                      check1[valid_test_input_index].signature_length);
     TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_HANDLE, TEST_CHECKPOINT_NUM(3));
 
     val->print(PRINT_TEST, "[Check %d] Test psa_verify_message - Zero as key handle\n",
                                                                              g_test_count++);
     /* Verify the signature a hash or short message using a public key */
-    status = val->crypto_function(VAL_CRYPTO_VERIFY_HASH,
-                                  0,
-                                  check1[valid_test_input_index].alg,
-                                  check1[valid_test_input_index].input,
-                                  check1[valid_test_input_index].input_length,
-                                  check1[valid_test_input_index].signature,
-                                  check1[valid_test_input_index].signature_length);
+    status = val->crypto->verify_hash(0,
+                                      check1[valid_test_input_index].alg,
+                                      check1[valid_test_input_index].input,
+                                      check1[valid_test_input_index].input_length,
+                                      check1[valid_test_input_index].signature,
+                                      check1[valid_test_input_index].signature_length);
     TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_HANDLE, TEST_CHECKPOINT_NUM(4));
 
     return VAL_STATUS_SUCCESS;
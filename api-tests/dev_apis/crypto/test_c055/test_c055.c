@@ -46,7 +46,7 @@ defined(ARCH_TEST_CIPER_MODE_CFB)))
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     for (i = 0; i < num_checks; i++)
@@ -54,66 +54,55 @@ defined(ARCH_TEST_CIPER_MODE_CFB)))
         val->print(PRINT_TEST, "[Check %d] ", i + 1);
         val->print(PRINT_TEST, check1[i].test_desc, 0);
 
-        val->crypto_function(VAL_CRYPTO_AEAD_OPERATION_INIT,
-                             &operation);
+        operation = val->crypto->aead_operation_init();
 
         /* Setting up the watchdog timer for each check */
         status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Setup the attributes for the key */
-        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE,
-                             &attributes,
-                             check1[i].type);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS,
-                             &attributes,
-                             check1[i].usage_flags);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM,
-                             &attributes,
-                             check1[i].alg);
+        val->crypto->set_key_type(&attributes,
+                                  check1[i].type);
+        val->crypto->set_key_usage_flags(&attributes,
+                                         check1[i].usage_flags);
+        val->crypto->set_key_algorithm(&attributes,
+                                       check1[i].alg);
 
         /* Import the key data into the key slot */
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY,
-                                      &attributes,
-                                      check1[i].data,
-                                      check1[i].data_length,
-                                      &key);
+        status = val->crypto->import_key(&attributes,
+                                         check1[i].data,
+                                         check1[i].data_length,
+                                         &key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Set the key for a multipart authenticated decryption operation */
-        status = val->crypto_function(VAL_CRYPTO_AEAD_DECRYPT_SETUP,
-                                      &operation,
-                                      key,
-                                      check1[i].setup_alg);
+        status = val->crypto->aead_decrypt_setup(&operation,
+                                                 key,
+                                                 check1[i].setup_alg);
         TEST_ASSERT_DUAL(status,
                          check1[i].expected_status[0],
                          check1[i].expected_status[1],
                          TEST_CHECKPOINT_NUM(4));
 
         /* Abort the AEAD operation */
-        status = val->crypto_function(VAL_CRYPTO_AEAD_ABORT,
-                                      &operation);
+        status = val->crypto->aead_abort(&operation);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
         /* Destroy the key */
-        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY,
-                                      key);
+        status = val->crypto->destroy_key(key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(6));
 
         /* Setting up aead on destroyed key handle should return an error */
-        status = val->crypto_function(VAL_CRYPTO_AEAD_DECRYPT_SETUP,
-                                      &operation,
-                                      key,
-                                      check1[i].setup_alg);
+        status = val->crypto->aead_decrypt_setup(&operation,
+                                                 key,
+                                                 check1[i].setup_alg);
         TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_HANDLE, TEST_CHECKPOINT_NUM(7));
 
         /* Reset the key attributes */
-        val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES,
-                             &attributes);
+        val->crypto->reset_key_attributes(&attributes);
 
         /* Abort the AEAD operation */
-        status = val->crypto_function(VAL_CRYPTO_AEAD_ABORT,
-                                      &operation);
+        status = val->crypto->aead_abort(&operation);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
     }
 
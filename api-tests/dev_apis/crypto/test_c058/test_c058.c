@@ -44,7 +44,7 @@ int32_t psa_aead_set_lengths_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     for (i = 0; i < num_checks; i++)
@@ -52,79 +52,67 @@ int32_t psa_aead_set_lengths_test(caller_security_t caller __UNUSED)
         val->print(PRINT_TEST, "[Check %d] ", i+1);
         val->print(PRINT_TEST, check1[i].test_desc, 0);
 
-        val->crypto_function(VAL_CRYPTO_AEAD_OPERATION_INIT,
-                            &operation);
+        operation = val->crypto->aead_operation_init();
 
         /* Setting up the watchdog timer for each check */
         status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Setup the attributes for the key */
-        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE,
-                             &attributes,
-                             check1[i].type);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS,
-                             &attributes,
-                             check1[i].usage_flags);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM,
-                             &attributes,
-                             check1[i].alg);
+        val->crypto->set_key_type(&attributes,
+                                  check1[i].type);
+        val->crypto->set_key_usage_flags(&attributes,
+                                         check1[i].usage_flags);
+        val->crypto->set_key_algorithm(&attributes,
+                                       check1[i].alg);
 
         /* Import the key data into the key slot */
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY,
-                                      &attributes,
-                                      check1[i].data,
-                                      check1[i].data_length,
-                                      &key);
+        status = val->crypto->import_key(&attributes,
+                                         check1[i].data,
+                                         check1[i].data_length,
+                                         &key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         if (check1[i].operation_state) {
             if (check1[i].usage_flags == PSA_KEY_USAGE_ENCRYPT) {
                 /* Set the key for a multipart authenticated encryption operation */
-                status = val->crypto_function(VAL_CRYPTO_AEAD_ENCRYPT_SETUP,
-                                              &operation,
-                                              key,
-                                              check1[i].setup_alg);
+                status = val->crypto->aead_encrypt_setup(&operation,
+                                                         key,
+                                                         check1[i].setup_alg);
             } else {
                 /* Set the key for a multipart authenticated decryption operation */
-                status = val->crypto_function(VAL_CRYPTO_AEAD_DECRYPT_SETUP,
-                                              &operation,
-                                              key,
-                                              check1[i].setup_alg);
+                status = val->crypto->aead_decrypt_setup(&operation,
+                                                         key,
+                                                         check1[i].setup_alg);
             }
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
         }
 
         /* Declare the lengths of the message and additional data for AEAD */
-        status = val->crypto_function(VAL_CRYPTO_AEAD_SET_LENGTHS,
-                                      &operation,
-                                      check1[i].ad_length,
-                                      check1[i].plaintext_length);
+        status = val->crypto->aead_set_lengths(&operation,
+                                               check1[i].ad_length,
+                                               check1[i].plaintext_length);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(5));
 
         if (check1[i].expected_status != PSA_SUCCESS)
         {
             /* Declare the lengths of failed operation should be an error */
-            status = val->crypto_function(VAL_CRYPTO_AEAD_SET_LENGTHS,
-                                          &operation,
-                                          check1[i].ad_length,
-                                          check1[i].plaintext_length);
+            status = val->crypto->aead_set_lengths(&operation,
+                                                   check1[i].ad_length,
+                                                   check1[i].plaintext_length);
             TEST_ASSERT_EQUAL(status, PSA_ERROR_BAD_STATE, TEST_CHECKPOINT_NUM(6));
         }
 
         /* Abort the AEAD operation */
-        status = val->crypto_function(VAL_CRYPTO_AEAD_ABORT,
-                                      &operation);
+        status = val->crypto->aead_abort(&operation);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(7));
 
         /* Destroy the key */
-        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY,
-                                      key);
+        status = val->crypto->destroy_key(key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
 
         /* Reset the key attributes */
-        val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES,
-                             &attributes);
+        val->crypto->reset_key_attributes(&attributes);
     }
 
     return VAL_STATUS_SUCCESS;
@@ -47,7 +47,7 @@ int32_t psa_aead_finish_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     for (i = 0; i < num_checks; i++)
@@ -60,63 +60,63 @@ int32_t psa_aead_finish_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Setup the attributes for the key */
-        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE, &attributes, check1[i].key_type);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes, check1[i].usage);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM, &attributes, check1[i].key_alg);
+        val->crypto->set_key_type(&attributes, check1[i].key_type);
+        val->crypto->set_key_usage_flags(&attributes, check1[i].usage);
+        val->crypto->set_key_algorithm(&attributes, check1[i].key_alg);
 
         /* Import the key data into the key slot */
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].key_data,
+        status = val->crypto->import_key(&attributes, check1[i].key_data,
                  check1[i].key_length, &key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Set the key for a multipart authenticated encryption operation */
-        status = val->crypto_function(VAL_CRYPTO_AEAD_ENCRYPT_SETUP, &operation,
+        status = val->crypto->aead_encrypt_setup(&operation,
                  key, check1[i].alg);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
 
         /* Declare the lengths of the message and additional data for AEAD */
-        status = val->crypto_function(VAL_CRYPTO_AEAD_SET_LENGTHS, &operation, check1[i].ad_length,
+        status = val->crypto->aead_set_lengths(&operation, check1[i].ad_length,
                  check1[i].input_length);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
         /* Set the nonce for an authenticated encryption operation */
-        status = val->crypto_function(VAL_CRYPTO_AEAD_SET_NONCE, &operation, check1[i].nonce,
+        status = val->crypto->aead_set_nonce(&operation, check1[i].nonce,
                  check1[i].nonce_size);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(6));
 
         /* Pass additional data to an active AEAD operation */
-        status = val->crypto_function(VAL_CRYPTO_AEAD_UPDATE_AD, &operation,
+        status = val->crypto->aead_update_ad(&operation,
                  check1[i].additional_data, check1[i].ad_length);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(7));
 
         /* Encrypt or decrypt a message fragment in an active AEAD operation */
-        status = val->crypto_function(VAL_CRYPTO_AEAD_UPDATE, &operation,
+        status = val->crypto->aead_update(&operation,
                  check1[i].plaintext, check1[i].plaintext_length, output,
                  BUFFER_SIZE, &length);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
 
         /* Finish encrypting a message in an AEAD operation */
-        status = val->crypto_function(VAL_CRYPTO_AEAD_FINISH, &operation, output + length,
+        status = val->crypto->aead_finish(&operation, output + length,
                  check1[i].output_size, &finish_length, tag, check1[i].tag_size, &tag_length);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(9));
 
         if (check1[i].expected_status != PSA_SUCCESS)
         {
             /* Finish encrypting a message with an inactive operator should fail */
-            status = val->crypto_function(VAL_CRYPTO_AEAD_FINISH, &operation, output,
+            status = val->crypto->aead_finish(&operation, output,
                  check1[i].output_size, &length, tag, check1[i].tag_size, &tag_length);
             TEST_ASSERT_EQUAL(status, PSA_ERROR_BAD_STATE, TEST_CHECKPOINT_NUM(10));
 
             /* Abort the AEAD operation */
-            status = val->crypto_function(VAL_CRYPTO_AEAD_ABORT, &operation);
+            status = val->crypto->aead_abort(&operation);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(11));
 
             /* Destroy the key */
-            status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+            status = val->crypto->destroy_key(key);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(12));
 
             /* Reset the key attributes */
-            val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &attributes);
+            val->crypto->reset_key_attributes(&attributes);
             continue;
         }
 
@@ -128,18 +128,18 @@ int32_t psa_aead_finish_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_MEMCMP(tag, check1[i].expected_tag, tag_length, TEST_CHECKPOINT_NUM(16));
 
         /* Abort the AEAD operation */
-        status = val->crypto_function(VAL_CRYPTO_AEAD_ABORT, &operation);
+        status = val->crypto->aead_abort(&operation);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(17));
 
         /* Destroy the key */
-        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+        status = val->crypto->destroy_key(key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(18));
 
         /* Reset the key attributes */
-        val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &attributes);
+        val->crypto->reset_key_attributes(&attributes);
 
         /* Finish encrypting a message with an inactive operator should fail */
-        status = val->crypto_function(VAL_CRYPTO_AEAD_FINISH, &operation, output,
+        status = val->crypto->aead_finish(&operation, output,
                  check1[i].output_size, &length, tag, check1[i].tag_size, &tag_length);
         TEST_ASSERT_EQUAL(status, PSA_ERROR_BAD_STATE, TEST_CHECKPOINT_NUM(19));
 
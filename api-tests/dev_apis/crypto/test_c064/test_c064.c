@@ -48,7 +48,7 @@ defined(ARCH_TEST_SHA512))
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     for (i = 0; i < num_checks; i++)
@@ -56,8 +56,7 @@ defined(ARCH_TEST_SHA512))
         val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
         val->print(PRINT_TEST, check1[i].test_desc, 0);
 
-        val->crypto_function(VAL_CRYPTO_HASH_OPERATION_INIT,
-                             &operation);
+        operation = val->crypto->hash_operation_init();
 
         /* Setting up the watchdog timer for each check */
         status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
@@ -65,32 +64,28 @@ defined(ARCH_TEST_SHA512))
 
         if (check1[i].operation_state) {
             /* Start a multipart hash operation */
-            status = val->crypto_function(VAL_CRYPTO_HASH_SETUP,
-                                          &operation,
-                                          check1[i].alg);
+            status = val->crypto->hash_setup(&operation,
+                                             check1[i].alg);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
             /* Add a message fragment to a multipart hash operation */
-            status = val->crypto_function(VAL_CRYPTO_HASH_UPDATE,
-                                          &operation,
-                                          check1[i].input,
-                                          check1[i].input_length);
+            status = val->crypto->hash_update(&operation,
+                                              check1[i].input,
+                                              check1[i].input_length);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
         }
 
         /* Suspend hash operation and verify against the known hash */
-        status = val->crypto_function(VAL_CRYPTO_HASH_SUSPEND,
-                                      &operation,
-                                      check1[i].hash_state,
-                                      check1[i].hash_state_size,
-                                      &expected_hash_state_length);
+        status = val->crypto->hash_suspend(&operation,
+                                           check1[i].hash_state,
+                                           check1[i].hash_state_size,
+                                           &expected_hash_state_length);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(5));
 
         if (check1[i].expected_status != PSA_SUCCESS)
         {
             /*Abort the hash operation */
-            status = val->crypto_function(VAL_CRYPTO_HASH_ABORT,
-                                          &operation);
+            status = val->crypto->hash_abort(&operation);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(6));
             continue;
         }
@@ -99,8 +94,7 @@ defined(ARCH_TEST_SHA512))
                           TEST_CHECKPOINT_NUM(7));
 
         /*Abort the hash operation */
-        status = val->crypto_function(VAL_CRYPTO_HASH_ABORT,
-                                      &operation);
+        status = val->crypto->hash_abort(&operation);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
 
         if (valid_test_input_index < 0)
@@ -128,7 +122,7 @@ int32_t psa_hash_suspend_repeated_call(caller_security_t caller __UNUSED)
         return RESULT_SKIP(VAL_STATUS_NO_TESTS);
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
@@ -139,34 +133,30 @@ int32_t psa_hash_suspend_repeated_call(caller_security_t caller __UNUSED)
     TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
     /* Start a multipart hash operation */
-    status = val->crypto_function(VAL_CRYPTO_HASH_SETUP,
-                                  &operation,
-                                  check1[valid_test_input_index].alg);
+    status = val->crypto->hash_setup(&operation,
+                                     check1[valid_test_input_index].alg);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
     /* Add a message fragment to a multipart hash operation */
-    status = val->crypto_function(VAL_CRYPTO_HASH_UPDATE,
-                                  &operation,
-                                  check1[valid_test_input_index].input,
-                                  check1[valid_test_input_index].input_length);
+    status = val->crypto->hash_update(&operation,
+                                      check1[valid_test_input_index].input,
+                                      check1[valid_test_input_index].input_length);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
 
     /* Finish the calculation of the hash of a message */
-    status = val->crypto_function(VAL_CRYPTO_HASH_SUSPEND,
-                                  &operation,
-                                  check1[valid_test_input_index].hash_state,
-                                  check1[valid_test_input_index].hash_state_size,
-                                  &expected_hash_state_length1);
+    status = val->crypto->hash_suspend(&operation,
+                                       check1[valid_test_input_index].hash_state,
+                                       check1[valid_test_input_index].hash_state_size,
+                                       &expected_hash_state_length1);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
     /* Retry the hash suspend to see operation with completed operation handle */
-    status = val->crypto_function(VAL_CRYPTO_HASH_SUSPEND,
-                                  &operation,
-                                  check1[valid_test_input_index].hash_state +
+    status = val->crypto->hash_suspend(&operation,
+                                       check1[valid_test_input_index].hash_state +
                                   expected_hash_state_length1,
-                                  check1[valid_test_input_index].hash_state_size -
+                                       check1[valid_test_input_index].hash_state_size -
                                   expected_hash_state_length1,
-                                  &expected_hash_state_length2);
+                                       &expected_hash_state_length2);
     TEST_ASSERT_EQUAL(status, PSA_ERROR_BAD_STATE, TEST_CHECKPOINT_NUM(6));
 
     TEST_ASSERT_EQUAL(expected_hash_state_length1,
@@ -178,8 +168,7 @@ int32_t psa_hash_suspend_repeated_call(caller_security_t caller __UNUSED)
                       TEST_CHECKPOINT_NUM(8));
 
     /*Abort the hash operation */
-    status = val->crypto_function(VAL_CRYPTO_HASH_ABORT,
-                                  &operation);
+    status = val->crypto->hash_abort(&operation);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(9));
 
     return VAL_STATUS_SUCCESS;
@@ -47,7 +47,7 @@ defined(ARCH_TEST_SHA384) || defined(ARCH_TEST_SHA512))
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     for (i = 0; i < num_checks; i++)
@@ -55,8 +55,7 @@ defined(ARCH_TEST_SHA384) || defined(ARCH_TEST_SHA512))
         val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
         val->print(PRINT_TEST, check1[i].test_desc, 0);
 
-        val->crypto_function(VAL_CRYPTO_HASH_OPERATION_INIT,
-                             &operation);
+        operation = val->crypto->hash_operation_init();
 
         /* Setting up the watchdog timer for each check */
         status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
@@ -64,49 +63,43 @@ defined(ARCH_TEST_SHA384) || defined(ARCH_TEST_SHA512))
 
         if (check1[i].operation_state) {
             /* Start a multipart hash operation */
-            status = val->crypto_function(VAL_CRYPTO_HASH_SETUP,
-                                          &operation,
-                                          check1[i].alg);
+            status = val->crypto->hash_setup(&operation,
+                                             check1[i].alg);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
             /* Add a message fragment to a multipart hash operation */
-            status = val->crypto_function(VAL_CRYPTO_HASH_UPDATE,
-                                          &operation,
-                                          check1[i].input,
-                                          check1[i].input_length);
+            status = val->crypto->hash_update(&operation,
+                                              check1[i].input,
+                                              check1[i].input_length);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
 
             /* Suspend hash operation */
-            status = val->crypto_function(VAL_CRYPTO_HASH_SUSPEND,
-                                          &operation,
-                                          check1[i].suspend_hash_state,
-                                          check1[i].hash_state_size,
-                                          &hash_state_length);
+            status = val->crypto->hash_suspend(&operation,
+                                               check1[i].suspend_hash_state,
+                                               check1[i].hash_state_size,
+                                               &hash_state_length);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
         }
 
         /* Resume hash operation */
-        status = val->crypto_function(VAL_CRYPTO_HASH_RESUME,
-                                      &operation,
-                                      check1[i].resume_hash_state,
-                                      check1[i].hash_state_length);
+        status = val->crypto->hash_resume(&operation,
+                                          check1[i].resume_hash_state,
+                                          check1[i].hash_state_length);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(6));
 
         if (check1[i].expected_status != PSA_SUCCESS)
         {
             /*Abort the hash operation */
-            status = val->crypto_function(VAL_CRYPTO_HASH_ABORT,
-                                          &operation);
+            status = val->crypto->hash_abort(&operation);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(6));
             continue;
         }
 
         /* Finish the calculation of the hash of a message */
-        status = val->crypto_function(VAL_CRYPTO_HASH_FINISH,
-                                      &operation,
-                                      check1[i].hash,
-                                      check1[i].hash_size,
-                                      &hash_length);
+        status = val->crypto->hash_finish(&operation,
+                                          check1[i].hash,
+                                          check1[i].hash_size,
+                                          &hash_length);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(7));
 
         TEST_ASSERT_EQUAL(check1[i].hash_length, hash_length, TEST_CHECKPOINT_NUM(8));
@@ -114,8 +107,7 @@ defined(ARCH_TEST_SHA384) || defined(ARCH_TEST_SHA512))
                            hash_length, TEST_CHECKPOINT_NUM(9));
 
         /*Abort the hash operation */
-        status = val->crypto_function(VAL_CRYPTO_HASH_ABORT,
-                                      &operation);
+        status = val->crypto->hash_abort(&operation);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(9));
 
         if (valid_test_input_index < 0)
@@ -39,7 +39,7 @@ int32_t psa_key_derivation_input_integer_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     for (i = 0; i < num_checks; i++)
@@ -52,23 +52,23 @@ int32_t psa_key_derivation_input_integer_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Set up a key derivation operation */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_SETUP, &operation, check1[i].alg);
+        status = val->crypto->key_derivation_setup(&operation, check1[i].alg);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Provide an integer input for key derivation */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_INPUT_INTEGER, &operation,
+        status = val->crypto->key_derivation_input_integer(&operation,
                  check1[i].step, check1[i].int_data);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(4));
 
         /* Abort the key derivation operation */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_ABORT, &operation);
+        status = val->crypto->key_derivation_abort(&operation);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
         if (check1[i].expected_status != PSA_SUCCESS)
             continue;
 
         /* Key derivation on an aborted operation should fail */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_INPUT_INTEGER, &operation,
+        status = val->crypto->key_derivation_input_integer(&operation,
                  check1[i].step, check1[i].int_data);
         TEST_ASSERT_EQUAL(status, PSA_ERROR_BAD_STATE, TEST_CHECKPOINT_NUM(6));
 
@@ -43,7 +43,7 @@ int32_t psa_key_derivation_verify_key_test(caller_security_t caller __UNUSED)
     }
 
     /* Initialize the PSA crypto library*/
-    status = val->crypto_function(VAL_CRYPTO_INIT);
+    status = val->crypto->crypto_init();
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
     for (i = 0; i < num_checks; i++)
@@ -56,27 +56,27 @@ int32_t psa_key_derivation_verify_key_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Start the key derivation operation */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_SETUP, &operation,
+        status = val->crypto->key_derivation_setup(&operation,
                  check1[i].key_alg);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Set the capacity for the generator */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_SET_CAPACITY, &operation,
+        status = val->crypto->key_derivation_set_capacity(&operation,
                  check1[i].capacity);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
 
         /* Setup the attributes for the key */
-        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE, &attributes,
-		                     check1[i].key_type);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_BITS, &attributes,
-                             check1[i].key_bits);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM, &attributes,
-                             check1[i].key_alg);
-        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes,
-                             check1[i].usage);
+        val->crypto->set_key_type(&attributes,
+                                  check1[i].key_type);
+        val->crypto->set_key_bits(&attributes,
+                                  check1[i].key_bits);
+        val->crypto->set_key_algorithm(&attributes,
+                                       check1[i].key_alg);
+        val->crypto->set_key_usage_flags(&attributes,
+                                         check1[i].usage);
 
         /* Provide number of rounds(cost) as first input for PBKDF2 algorithms */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_INPUT_INTEGER, &operation,
+        status = val->crypto->key_derivation_input_integer(&operation,
                      PSA_KEY_DERIVATION_INPUT_COST, input_rounds);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
@@ -84,46 +84,46 @@ int32_t psa_key_derivation_verify_key_test(caller_security_t caller __UNUSED)
         if (check1[i].step == PSA_KEY_DERIVATION_INPUT_SALT ||
             check1[i].step == PSA_KEY_DERIVATION_INPUT_PASSWORD)
         {
-            status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_INPUT_BYTES, &operation,
+            status = val->crypto->key_derivation_input_bytes(&operation,
                      PSA_KEY_DERIVATION_INPUT_SALT, check1[i].salt_data, check1[i].salt_length);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(6));
 
             if (check1[i].step == PSA_KEY_DERIVATION_INPUT_PASSWORD) {
-                status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_INPUT_BYTES, &operation,
+                status = val->crypto->key_derivation_input_bytes(&operation,
                          check1[i].step, check1[i].data, check1[i].data_length);
                 TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(7));
             }
         }
 
         /* Import the verification data into its key slot */
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes,
-                        &check1[i].expected_hash, check1[i].expected_hash_len, &expected);
+        status = val->crypto->import_key(&attributes,
+                        check1[i].expected_hash, check1[i].expected_hash_len, &expected);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
 
         /*  Verify the key from an ongoing key derivation operation */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_VERIFY_KEY, &operation,
-                                      expected);
+        status = val->crypto->key_derivation_verify_key(&operation,
+                                                        expected);
         TEST_ASSERT_DUAL(status, check1[i].expected_status[0], check1[i].expected_status[1],\
                         TEST_CHECKPOINT_NUM(9));
 
         /* Verifying set zero capacity for provided invalid operation's capacity */
         if (check1[i].capacity < check1[i].expected_hash_len) {
-            val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_GET_CAPACITY, &operation,
-                                 &capacity);
+            val->crypto->key_derivation_get_capacity(&operation,
+                                                     &capacity);
             TEST_ASSERT_EQUAL(capacity, 0, TEST_CHECKPOINT_NUM(10));
         }
 
         /* Destroy the created key */
-        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, expected);
+        status = val->crypto->destroy_key(expected);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(11));
 
         /* Abort the derivation operation */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_ABORT, &operation);
+        status = val->crypto->key_derivation_abort(&operation);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(12));
 
         /* Expect bad state when verification is called on an aborted operation */
-        status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_VERIFY_KEY, &operation,
-                                      expected);
+        status = val->crypto->key_derivation_verify_key(&operation,
+                                                        expected);
         TEST_ASSERT_EQUAL(status, PSA_ERROR_BAD_STATE, TEST_CHECKPOINT_NUM(13));
     }
     return VAL_STATUS_SUCCESS;
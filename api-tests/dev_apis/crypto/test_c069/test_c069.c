@@ -0,0 +1,444 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_c069.h"
+
+const client_test_t test_c069_crypto_list[] = {
+    NULL,
+    psa_external_vectors_test,
+    NULL,
+};
+
+/* Largest output of a vector, larger vectors are skipped */
+#ifndef ARCH_TEST_VECTORS_MAX_OUTPUT
+#define ARCH_TEST_VECTORS_MAX_OUTPUT    4096
+#endif
+
+/* Number of vectors run between two watchdog reprogrammings */
+#define VECTORS_PER_WD_TIMEOUT          256
+
+/* Number of failed vectors printed, the following ones are only counted */
+#define VECTORS_MAX_REPORTED            16
+
+/* Outcome of a vector */
+typedef enum {
+    VECTOR_PASS = 0,
+    VECTOR_FAIL = 1,
+    VECTOR_SKIP = 2,
+} vector_result_t;
+
+#define VECTOR_KINDS                    (VAL_VECTOR_VERIFY + 1)
+
+static const char *const vector_kind_names[VECTOR_KINDS] = {
+    "Unknown", "Hash", "MAC", "Cipher", "AEAD", "Sign", "Verify"
+};
+
+static uint8_t  vector_output[ARCH_TEST_VECTORS_MAX_OUTPUT];
+static uint8_t  vector_check[ARCH_TEST_VECTORS_MAX_OUTPUT];
+static uint32_t vector_counts[VECTOR_KINDS][VECTOR_SKIP + 1];
+
+/**
+    @brief    - Tells if a buffer holds the expected data
+    @param    - field  : Expected data
+                data   : Buffer
+                length : Buffer length
+    @return   - TRUE/FALSE
+**/
+static bool_t vector_equal(const val_vector_field_t *field, const uint8_t *data, size_t length)
+{
+    return ((field->size == length) && (memcmp(field->data, data, length) == 0)) ? 1 : 0;
+}
+
+/**
+    @brief    - Gives the outcome of a vector from the status of the checked
+                operation
+    @param    - vector : Vector
+                status : Status of the operation, PSA_SUCCESS if its result
+                         was also correct, PSA_ERROR_INVALID_SIGNATURE if not
+    @return   - vector_result_t
+**/
+static vector_result_t vector_result(const val_vector_t *vector, psa_status_t status)
+{
+    if (status == PSA_ERROR_NOT_SUPPORTED)
+    {
+        return VECTOR_SKIP;
+    }
+
+    if (vector->flags & VAL_VECTOR_INVALID)
+    {
+        return (status != PSA_SUCCESS) ? VECTOR_PASS : VECTOR_FAIL;
+    }
+    return (status == PSA_SUCCESS) ? VECTOR_PASS : VECTOR_FAIL;
+}
+
+/**
+    @brief    - Imports the key of a vector
+    @param    - vector : Vector
+                usage  : Key usage
+                key    : Imported key
+    @return   - PSA status
+**/
+static psa_status_t vector_import_key(const val_vector_t *vector, psa_key_usage_t usage,
+                                      psa_key_id_t *key)
+{
+    psa_key_attributes_t  attributes = PSA_KEY_ATTRIBUTES_INIT;
+    psa_status_t          status;
+
+    val->crypto->set_key_type(&attributes, vector->key_type);
+    val->crypto->set_key_usage_flags(&attributes, usage);
+    val->crypto->set_key_algorithm(&attributes, vector->alg);
+    status = val->crypto->import_key(&attributes, vector->key.data, vector->key.size, key);
+    val->crypto->reset_key_attributes(&attributes);
+    return status;
+}
+
+/**
+    @brief    - Encrypts or decrypts with a multipart cipher operation, for the
+                IV of the vector to be set
+    @param    - vector  : Vector
+                key     : Key
+                encrypt : TRUE to encrypt, FALSE to decrypt
+                input   : Input data
+                output  : Output buffer of ARCH_TEST_VECTORS_MAX_OUTPUT bytes
+                length  : Output length
+    @return   - PSA status
+**/
+static psa_status_t vector_cipher_run(const val_vector_t *vector, psa_key_id_t key,
+                                      bool_t encrypt, const val_vector_field_t *input,
+                                      uint8_t *output, size_t *length)
+{
+    psa_cipher_operation_t  operation = PSA_CIPHER_OPERATION_INIT;
+    size_t                  finish_length = 0;
+    psa_status_t            status;
+
+    *length = 0;
+    if (encrypt)
+    {
+        status = val->crypto->cipher_encrypt_setup(&operation, key, vector->alg);
+    }
+    else
+    {
+        status = val->crypto->cipher_decrypt_setup(&operation, key, vector->alg);
+    }
+
+    if ((status == PSA_SUCCESS) && (vector->iv.size != 0))
+    {
+        status = val->crypto->cipher_set_iv(&operation, vector->iv.data, vector->iv.size);
+    }
+    if (status == PSA_SUCCESS)
+    {
+        status = val->crypto->cipher_update(&operation, input->data, input->size,
+                                            output, ARCH_TEST_VECTORS_MAX_OUTPUT, length);
+    }
+    if (status == PSA_SUCCESS)
+    {
+        status = val->crypto->cipher_finish(&operation, output + *length,
+                                            ARCH_TEST_VECTORS_MAX_OUTPUT - *length,
+                                            &finish_length);
+        *length += finish_length;
+    }
+
+    if (status != PSA_SUCCESS)
+    {
+        val->crypto->cipher_abort(&operation);
+    }
+    return status;
+}
+
+/**
+    @brief    - Checks a hash vector
+    @param    - vector : Vector
+    @return   - PSA status, PSA_ERROR_INVALID_SIGNATURE for an incorrect hash
+**/
+static psa_status_t vector_check_hash(const val_vector_t *vector)
+{
+    size_t        length;
+    psa_status_t  status;
+
+    status = val->crypto->hash_compute(vector->alg, vector->input.data, vector->input.size,
+                                       vector_output, sizeof(vector_output), &length);
+    if ((status == PSA_SUCCESS) && !vector_equal(&vector->output, vector_output, length))
+    {
+        status = PSA_ERROR_INVALID_SIGNATURE;
+    }
+    return status;
+}
+
+/**
+    @brief    - Checks a MAC vector, computing the MAC of a valid vector and
+                verifying the MAC of any vector
+    @param    - vector : Vector
+                key    : Key of the vector
+    @return   - PSA status, PSA_ERROR_INVALID_SIGNATURE for an incorrect MAC
+**/
+static psa_status_t vector_check_mac(const val_vector_t *vector, psa_key_id_t key)
+{
+    size_t        length;
+    psa_status_t  status;
+
+    if (!(vector->flags & VAL_VECTOR_INVALID))
+    {
+        status = val->crypto->mac_compute(key, vector->alg, vector->input.data,
+                                          vector->input.size, vector_output,
+                                          sizeof(vector_output), &length);
+        if (status != PSA_SUCCESS)
+        {
+            return status;
+        }
+        if (!vector_equal(&vector->output, vector_output, length))
+        {
+            return PSA_ERROR_INVALID_SIGNATURE;
+        }
+    }
+
+    return val->crypto->mac_verify(key, vector->alg, vector->input.data, vector->input.size,
+                                   vector->output.data, vector->output.size);
+}
+
+/**
+    @brief    - Checks a cipher vector, encrypting the input of a valid vector
+                and decrypting the output of any vector
+    @param    - vector : Vector
+                key    : Key of the vector
+    @return   - PSA status, PSA_ERROR_INVALID_SIGNATURE for an incorrect output
+**/
+static psa_status_t vector_check_cipher(const val_vector_t *vector, psa_key_id_t key)
+{
+    size_t        length;
+    psa_status_t  status;
+
+    if (!(vector->flags & VAL_VECTOR_INVALID))
+    {
+        status = vector_cipher_run(vector, key, 1, &vector->input, vector_output, &length);
+        if (status != PSA_SUCCESS)
+        {
+            return status;
+        }
+        if (!vector_equal(&vector->output, vector_output, length))
+        {
+            return PSA_ERROR_INVALID_SIGNATURE;
+        }
+    }
+
+    status = vector_cipher_run(vector, key, 0, &vector->output, vector_check, &length);
+    if ((status == PSA_SUCCESS) && !vector_equal(&vector->input, vector_check, length))
+    {
+        status = PSA_ERROR_INVALID_SIGNATURE;
+    }
+    return status;
+}
+
+/**
+    @brief    - Checks an AEAD vector, encrypting the input of a valid vector
+                and decrypting the output of any vector
+    @param    - vector : Vector
+                key    : Key of the vector
+    @return   - PSA status, PSA_ERROR_INVALID_SIGNATURE for an incorrect output
+**/
+static psa_status_t vector_check_aead(const val_vector_t *vector, psa_key_id_t key)
+{
+    size_t        length;
+    psa_status_t  status;
+
+    if (!(vector->flags & VAL_VECTOR_INVALID))
+    {
+        status = val->crypto->aead_encrypt(key, vector->alg, vector->iv.data, vector->iv.size,
+                                           vector->aad.data, vector->aad.size,
+                                           vector->input.data, vector->input.size,
+                                           vector_output, sizeof(vector_output), &length);
+        if (status != PSA_SUCCESS)
+        {
+            return status;
+        }
+        if (!vector_equal(&vector->output, vector_output, length))
+        {
+            return PSA_ERROR_INVALID_SIGNATURE;
+        }
+    }
+
+    status = val->crypto->aead_decrypt(key, vector->alg, vector->iv.data, vector->iv.size,
+                                       vector->aad.data, vector->aad.size,
+                                       vector->output.data, vector->output.size,
+                                       vector_check, sizeof(vector_check), &length);
+    if ((status == PSA_SUCCESS) && !vector_equal(&vector->input, vector_check, length))
+    {
+        status = PSA_ERROR_INVALID_SIGNATURE;
+    }
+    return status;
+}
+
+/**
+    @brief    - Checks a sign vector. The signature of the input is verified
+                rather than compared, as it can be randomized, and the expected
+                signature of the vector, if any, is verified too.
+    @param    - vector : Vector
+                key    : Key pair of the vector
+    @return   - PSA status
+**/
+static psa_status_t vector_check_sign(const val_vector_t *vector, psa_key_id_t key)
+{
+    size_t        length;
+    psa_status_t  status;
+
+    status = val->crypto->sign_message(key, vector->alg, vector->input.data, vector->input.size,
+                                       vector_output, sizeof(vector_output), &length);
+    if (status == PSA_SUCCESS)
+    {
+        status = val->crypto->verify_message(key, vector->alg, vector->input.data,
+                                             vector->input.size, vector_output, length);
+    }
+    if ((status == PSA_SUCCESS) && (vector->output.size != 0))
+    {
+        status = val->crypto->verify_message(key, vector->alg, vector->input.data,
+                                             vector->input.size, vector->output.data,
+                                             vector->output.size);
+    }
+    return status;
+}
+
+/**
+    @brief    - Runs a vector
+    @param    - vector : Vector
+    @return   - vector_result_t
+**/
+static vector_result_t vector_run(const val_vector_t *vector)
+{
+    static const psa_key_usage_t usages[VECTOR_KINDS] = {
+        0, 0,
+        PSA_KEY_USAGE_SIGN_MESSAGE | PSA_KEY_USAGE_VERIFY_MESSAGE,
+        PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT,
+        PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT,
+        PSA_KEY_USAGE_SIGN_MESSAGE | PSA_KEY_USAGE_VERIFY_MESSAGE,
+        PSA_KEY_USAGE_VERIFY_MESSAGE,
+    };
+    psa_key_id_t  key = 0;
+    psa_status_t  status;
+
+    if ((vector->input.size > ARCH_TEST_VECTORS_MAX_OUTPUT) ||
+        (vector->output.size > ARCH_TEST_VECTORS_MAX_OUTPUT))
+    {
+        return VECTOR_SKIP;
+    }
+
+    if (vector->kind == VAL_VECTOR_HASH)
+    {
+        return vector_result(vector, vector_check_hash(vector));
+    }
+
+    if ((vector->kind == 0) || (vector->kind >= VECTOR_KINDS))
+    {
+        return VECTOR_SKIP;
+    }
+
+    /* A key rejected on import fails an invalid vector as expected */
+    status = vector_import_key(vector, usages[vector->kind], &key);
+    if (status != PSA_SUCCESS)
+    {
+        return vector_result(vector, status);
+    }
+
+    switch (vector->kind)
+    {
+        case VAL_VECTOR_MAC:
+            status = vector_check_mac(vector, key);
+            break;
+        case VAL_VECTOR_CIPHER:
+            status = vector_check_cipher(vector, key);
+            break;
+        case VAL_VECTOR_AEAD:
+            status = vector_check_aead(vector, key);
+            break;
+        case VAL_VECTOR_SIGN:
+            status = vector_check_sign(vector, key);
+            break;
+        default:
+            status = val->crypto->verify_message(key, vector->alg, vector->input.data,
+                                                 vector->input.size, vector->output.data,
+                                                 vector->output.size);
+            break;
+    }
+
+    val->crypto->destroy_key(key);
+    return vector_result(vector, status);
+}
+
+int32_t psa_external_vectors_test(caller_security_t caller __UNUSED)
+{
+    val_vectors_t    corpus;
+    val_vector_t     vector;
+    vector_result_t  result;
+    uint32_t         failures = 0;
+    uint32_t         i;
+    int32_t          status;
+
+    status = val->vectors_open(&corpus);
+    if (status == VAL_STATUS_NOT_FOUND)
+    {
+        val->print(PRINT_TEST, "No external test vector corpus, see pal_vectors_get\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+    TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto->crypto_init();
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+    memset(vector_counts, 0, sizeof(vector_counts));
+    val->print(PRINT_TEST, "[Check 1] Run %d external test vectors\n", (int32_t)corpus.count);
+
+    while ((status = val->vectors_next(&corpus, &vector)) == VAL_STATUS_SUCCESS)
+    {
+        /* Setting up the watchdog timer for each batch of vectors */
+        if ((corpus.index % VECTORS_PER_WD_TIMEOUT) == 1)
+        {
+            status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+            TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(3));
+        }
+
+        result = vector_run(&vector);
+        vector_counts[(vector.kind < VECTOR_KINDS) ? vector.kind : 0][result]++;
+
+        if ((result == VECTOR_FAIL) && (failures++ < VECTORS_MAX_REPORTED))
+        {
+            val->print(PRINT_ERROR, "\tVector %d", (int32_t)(corpus.index - 1));
+            val->print(PRINT_ERROR, " (", 0);
+            val->print(PRINT_ERROR, vector_kind_names[(vector.kind < VECTOR_KINDS) ? vector.kind
+                                                                                   : 0], 0);
+            val->print(PRINT_ERROR, " id %d) failed\n", (int32_t)vector.id);
+        }
+    }
+    TEST_ASSERT_EQUAL(status, VAL_STATUS_NOT_FOUND, TEST_CHECKPOINT_NUM(4));
+
+    for (i = 0; i < VECTOR_KINDS; i++)
+    {
+        if ((vector_counts[i][VECTOR_PASS] + vector_counts[i][VECTOR_FAIL] +
+             vector_counts[i][VECTOR_SKIP]) == 0)
+        {
+            continue;
+        }
+        val->print(PRINT_TEST, "\t", 0);
+        val->print(PRINT_TEST, vector_kind_names[i], 0);
+        val->print(PRINT_TEST, ": %d passed", (int32_t)vector_counts[i][VECTOR_PASS]);
+        val->print(PRINT_TEST, ", %d failed", (int32_t)vector_counts[i][VECTOR_FAIL]);
+        val->print(PRINT_TEST, ", %d skipped\n", (int32_t)vector_counts[i][VECTOR_SKIP]);
+    }
+
+    TEST_ASSERT_EQUAL(failures, 0, TEST_CHECKPOINT_NUM(5));
+    return VAL_STATUS_SUCCESS;
+}
@@ -0,0 +1,129 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_c070.h"
+
+const client_test_t test_c070_crypto_list[] = {
+    NULL,
+    psa_cipher_encrypt_alias_test,
+    psa_cipher_decrypt_alias_test,
+    psa_cipher_update_alias_test,
+    psa_aead_encrypt_alias_test,
+    psa_aead_decrypt_alias_test,
+    psa_aead_update_alias_test,
+    NULL,
+};
+
+/* Layouts of the output against the input in the aliasing buffer. A
+ * positive offset puts the output after the input, where an implementation
+ * processing the message forwards without a copy overwrites input it has not
+ * read yet.
+ */
+static const struct {
+    const char *name;
+    int32_t     offset;
+} c070_layouts[] = {
+    {"in-place",              0},
+    {"output at input + 1",   1},
+    {"output at input - 1",  -1},
+    {"output at input + 16",  C070_ALIAS_MARGIN},
+    {"output at input - 16", -C070_ALIAS_MARGIN},
+};
+
+static uint8_t c070_buffer[C070_ALIAS_BUFFER_SIZE];
+static uint8_t c070_reference[C070_ALIAS_BUFFER_SIZE];
+
+/**
+    @brief    - Runs an operation with separate input and output buffers, then
+                with the output on top of the input and overlapping it at each
+                layout of c070_layouts. The PSA Crypto API requires the same
+                result whatever the overlap of the buffers, so the aliased
+                outputs must match the separate buffer one, or pass the verify
+                function when the operation is not deterministic.
+    @param    - vector       : Test vector, passed to op and verify
+                input        : Input of the operation
+                input_length : Input length
+                output_size  : Output buffer size of the test vector
+                op           : Operation
+                verify       : Output check, NULL to compare the output with
+                               the separate buffer one
+    @return   - Test status
+**/
+int32_t c070_alias_check(const void *vector, const uint8_t *input, size_t input_length,
+                         size_t output_size, c070_op_t op, c070_verify_t verify)
+{
+    uint8_t   *alias_input, *output;
+    size_t     reference_length = 0, output_length, room;
+    int32_t    status;
+    uint32_t   i;
+
+    TEST_ASSERT_RANGE((int32_t)input_length, 0,
+                      (int32_t)(sizeof(c070_buffer) - (2 * C070_ALIAS_MARGIN)),
+                      TEST_CHECKPOINT_NUM(1));
+
+    /* Separate input and output buffers, the reference of the other layouts */
+    status = op(vector, input, input_length, c070_reference,
+                (output_size < sizeof(c070_reference)) ? output_size : sizeof(c070_reference),
+                &reference_length);
+    if (status == PSA_ERROR_NOT_SUPPORTED)
+    {
+        val->print(PRINT_TEST, "\tNot supported by the implementation, skipped\n", 0);
+        return VAL_STATUS_SUCCESS;
+    }
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+    if (verify != NULL)
+    {
+        status = verify(vector, c070_reference, reference_length);
+        TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(3));
+    }
+
+    for (i = 0; i < sizeof(c070_layouts)/sizeof(c070_layouts[0]); i++)
+    {
+        val->print(PRINT_DEBUG, "\tLayout ", 0);
+        val->print(PRINT_DEBUG, c070_layouts[i].name, 0);
+        val->print(PRINT_DEBUG, "\n", 0);
+
+        memset(c070_buffer, 0, sizeof(c070_buffer));
+        alias_input = c070_buffer + C070_ALIAS_MARGIN;
+        if (input_length != 0)
+        {
+            memcpy(alias_input, input, input_length);
+        }
+        output = alias_input + c070_layouts[i].offset;
+        room   = sizeof(c070_buffer) - (size_t)(output - c070_buffer);
+
+        status = op(vector, alias_input, input_length, output,
+                    (output_size < room) ? output_size : room, &output_length);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
+
+        if (verify != NULL)
+        {
+            status = verify(vector, output, output_length);
+            TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(5));
+            continue;
+        }
+
+        /* Check if the output matches the separate buffer one */
+        TEST_ASSERT_EQUAL(output_length, reference_length, TEST_CHECKPOINT_NUM(6));
+        TEST_ASSERT_MEMCMP(output, c070_reference, output_length, TEST_CHECKPOINT_NUM(7));
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
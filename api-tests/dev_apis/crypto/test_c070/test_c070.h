@@ -0,0 +1,59 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _TEST_C070_CLIENT_TESTS_H_
+#define _TEST_C070_CLIENT_TESTS_H_
+
+#include "val_crypto.h"
+#define test_entry CONCAT(test_entry_, c070)
+#define val CONCAT(val, test_entry)
+#define psa CONCAT(psa, test_entry)
+
+/* Room left before and after the input in the aliasing buffer, for the
+ * output to start up to one AES block away from the input
+ */
+#define C070_ALIAS_MARGIN       16
+#define C070_ALIAS_BUFFER_SIZE  256
+
+/* Operation of a buffer aliasing check, run on the buffers it is given. It
+ * creates and destroys its key.
+ */
+typedef psa_status_t (*c070_op_t)(const void *vector, const uint8_t *input, size_t input_length,
+                                  uint8_t *output, size_t output_size, size_t *output_length);
+
+/* Checks an output which the operation cannot reproduce, e.g. a ciphertext
+ * with a random IV, returns VAL_STATUS_SUCCESS if it is valid
+ */
+typedef int32_t (*c070_verify_t)(const void *vector, const uint8_t *output,
+                                 size_t output_length);
+
+extern val_api_t *val;
+extern psa_api_t *psa;
+extern const client_test_t test_c070_crypto_list[];
+extern uint32_t g_test_count;
+
+int32_t c070_alias_check(const void *vector, const uint8_t *input, size_t input_length,
+                         size_t output_size, c070_op_t op, c070_verify_t verify);
+int32_t psa_cipher_encrypt_alias_test(caller_security_t caller);
+int32_t psa_cipher_decrypt_alias_test(caller_security_t caller);
+int32_t psa_cipher_update_alias_test(caller_security_t caller);
+int32_t psa_aead_encrypt_alias_test(caller_security_t caller);
+int32_t psa_aead_decrypt_alias_test(caller_security_t caller);
+int32_t psa_aead_update_alias_test(caller_security_t caller);
+extern void crypto_common_exit_action(void);
+
+#endif /* _TEST_C070_CLIENT_TESTS_H_ */
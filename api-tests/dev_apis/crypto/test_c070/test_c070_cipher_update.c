@@ -0,0 +1,135 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_c070.h"
+#include "test_c036/test_data.h"
+
+#if ((defined(ARCH_TEST_AES_128) && (defined(ARCH_TEST_CBC_NO_PADDING) || \
+      defined(ARCH_TEST_CBC_PKCS7) || defined(ARCH_TEST_CIPHER_MODE_CTR))) || \
+     (defined(ARCH_TEST_CBC_NO_PADDING) && (defined(ARCH_TEST_DES_1KEY) || \
+      defined(ARCH_TEST_DES_2KEY) || defined(ARCH_TEST_DES_3KEY))))
+/**
+    @brief    - Encrypts or decrypts a message fragment with psa_cipher_update,
+                in a multipart operation set up with the IV of the test vector
+    @param    - vector        : psa_cipher_update test vector
+                input         : Message fragment
+                input_length  : Fragment length
+                output        : Output of the update
+                output_size   : Output buffer size
+                output_length : Output length
+    @return   - PSA status
+**/
+static psa_status_t cipher_update_op(const void *vector, const uint8_t *input,
+                                     size_t input_length, uint8_t *output,
+                                     size_t output_size, size_t *output_length)
+{
+    const test_data         *data = (const test_data *)vector;
+    psa_key_attributes_t     attributes = PSA_KEY_ATTRIBUTES_INIT;
+    psa_cipher_operation_t   operation = PSA_CIPHER_OPERATION_INIT;
+    psa_key_id_t             key;
+    psa_status_t             status, abort_status, destroy_status;
+
+    val->crypto->set_key_type(&attributes, data->type);
+    val->crypto->set_key_algorithm(&attributes, data->alg);
+    val->crypto->set_key_usage_flags(&attributes, data->usage_flags);
+
+    status = val->crypto->import_key(&attributes, data->data, data->data_length, &key);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    if (data->usage_flags == PSA_KEY_USAGE_ENCRYPT)
+    {
+        status = val->crypto->cipher_encrypt_setup(&operation, key, data->alg);
+    }
+    else
+    {
+        status = val->crypto->cipher_decrypt_setup(&operation, key, data->alg);
+    }
+
+    if (status == PSA_SUCCESS)
+    {
+        status = val->crypto->cipher_set_iv(&operation, data->iv, data->iv_length);
+    }
+
+    if (status == PSA_SUCCESS)
+    {
+        status = val->crypto->cipher_update(&operation, input, input_length, output,
+                                            output_size, output_length);
+    }
+
+    abort_status   = val->crypto->cipher_abort(&operation);
+    destroy_status = val->crypto->destroy_key(key);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+    return (abort_status == PSA_SUCCESS) ? destroy_status : abort_status;
+}
+#endif
+
+int32_t psa_cipher_update_alias_test(caller_security_t caller __UNUSED)
+{
+#if ((defined(ARCH_TEST_AES_128) && (defined(ARCH_TEST_CBC_NO_PADDING) || \
+      defined(ARCH_TEST_CBC_PKCS7) || defined(ARCH_TEST_CIPHER_MODE_CTR))) || \
+     (defined(ARCH_TEST_CBC_NO_PADDING) && (defined(ARCH_TEST_DES_1KEY) || \
+      defined(ARCH_TEST_DES_2KEY) || defined(ARCH_TEST_DES_3KEY))))
+    int                     num_checks = sizeof(check1)/sizeof(check1[0]);
+    int32_t                 i, status;
+
+    if (num_checks == 0)
+    {
+        val->print(PRINT_TEST, "No test available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto->crypto_init();
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    for (i = 0; i < num_checks; i++)
+    {
+        /* Only the vectors of a successful operation have an output to alias */
+        if ((check1[i].expected_status != PSA_SUCCESS) ||
+            ((check1[i].usage_flags != PSA_KEY_USAGE_ENCRYPT) &&
+             (check1[i].usage_flags != PSA_KEY_USAGE_DECRYPT)))
+            continue;
+
+        val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
+        val->print(PRINT_TEST, check1[i].test_desc, 0);
+
+        /* Setting up the watchdog timer for each check */
+        status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+        TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        status = c070_alias_check(&check1[i], check1[i].input, check1[i].input_length,
+                                  check1[i].output_size, cipher_update_op, NULL);
+        if (status != VAL_STATUS_SUCCESS)
+        {
+            return status;
+        }
+    }
+
+    return VAL_STATUS_SUCCESS;
+#else
+    val->print(PRINT_TEST, "No test available for the selected crypto configuration\n", 0);
+    return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+#endif
+}
@@ -0,0 +1,70 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "pal_timer_dwt.h"
+
+#define DWT_CTRL      (*(volatile uint32_t *)DWT_CTRL_ADDR)
+#define DWT_CYCCNT    (*(volatile uint32_t *)DWT_CYCCNT_ADDR)
+#define DCB_DEMCR     (*(volatile uint32_t *)DCB_DEMCR_ADDR)
+
+/* 64-bit extension of the 32-bit cycle counter */
+static uint32_t g_dwt_last;
+static uint32_t g_dwt_high;
+
+/**
+    @brief           - Enables the DWT cycle counter. The counter is left running
+                       if it is already enabled.
+    @param           - void
+    @return          - SUCCESS, UNSUPPORTED_FUNC if the core has no cycle counter
+**/
+int pal_timer_dwt_init(void)
+{
+    if (DWT_CTRL & DWT_CTRL_CYCCNTENA_Msk)
+    {
+        return PAL_STATUS_SUCCESS;
+    }
+
+    DCB_DEMCR |= DCB_DEMCR_TRCENA_Msk;
+    if (DWT_CTRL & DWT_CTRL_NOCYCCNT_Msk)
+    {
+        return PAL_STATUS_UNSUPPORTED_FUNC;
+    }
+
+    DWT_CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    return (DWT_CTRL & DWT_CTRL_CYCCNTENA_Msk) ? PAL_STATUS_SUCCESS
+                                               : PAL_STATUS_UNSUPPORTED_FUNC;
+}
+
+/**
+    @brief           - Reads the DWT cycle counter, extended to 64 bits. The
+                       counter must be read at least once per 2^32 cycles for
+                       the extension to be correct.
+    @param           - void
+    @return          - Number of CPU cycles
+**/
+uint64_t pal_timer_dwt_read(void)
+{
+    uint32_t now = DWT_CYCCNT;
+
+    if (now < g_dwt_last)
+    {
+        g_dwt_high++;
+    }
+    g_dwt_last = now;
+
+    return ((uint64_t)g_dwt_high << 32) | now;
+}
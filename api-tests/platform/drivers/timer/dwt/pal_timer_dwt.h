@@ -0,0 +1,44 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _PAL_TIMER_DWT_H_
+#define _PAL_TIMER_DWT_H_
+
+#include "pal_common.h"
+
+/* Cycle counter of the Data Watchpoint and Trace unit (DWT_CYCCNT), available on
+ * Armv7-M and Armv8-M Mainline cores. It counts CPU clock cycles, so its
+ * frequency is the CPU clock frequency.
+ */
+
+#define DWT_CTRL_ADDR              0xE0001000UL
+#define DWT_CYCCNT_ADDR            0xE0001004UL
+#define DCB_DEMCR_ADDR             0xE000EDFCUL
+
+/* DWT CTRL Register Definitions */
+#define DWT_CTRL_CYCCNTENA_Pos     0
+#define DWT_CTRL_CYCCNTENA_Msk     (0x1UL << DWT_CTRL_CYCCNTENA_Pos)
+#define DWT_CTRL_NOCYCCNT_Pos      25
+#define DWT_CTRL_NOCYCCNT_Msk      (0x1UL << DWT_CTRL_NOCYCCNT_Pos)
+
+/* DCB DEMCR Register Definitions */
+#define DCB_DEMCR_TRCENA_Pos       24
+#define DCB_DEMCR_TRCENA_Msk       (0x1UL << DCB_DEMCR_TRCENA_Pos)
+
+int      pal_timer_dwt_init(void);
+uint64_t pal_timer_dwt_read(void);
+#endif /* _PAL_TIMER_DWT_H_ */
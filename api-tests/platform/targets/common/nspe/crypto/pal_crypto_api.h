@@ -0,0 +1,365 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _PAL_CRYPTO_API_H_
+#define _PAL_CRYPTO_API_H_
+
+#include "pal_common.h"
+
+/* Crypto dispatch table, with one entry per PSA Crypto API carrying the API
+ * prototype, followed by the PAL services of the crypto suite. Entries are
+ * named after the API without its psa_ prefix. The tests call through it
+ * directly, so argument types are checked at compile time and no argument
+ * marshalling is done on the way to the crypto implementation.
+ *
+ * APIs which are not enabled in pal_crypto_config.h are kept in the table and
+ * return PAL_STATUS_UNSUPPORTED_FUNC.
+ */
+typedef struct pal_crypto_api_s {
+    /* Library initialization */
+    psa_status_t         (*crypto_init)                   (void);
+
+    /* Key attributes */
+    psa_key_attributes_t (*key_attributes_init)           (void);
+    void                 (*set_key_id)                    (psa_key_attributes_t *attributes,
+                                                           psa_key_id_t id);
+    psa_key_id_t         (*get_key_id)                    (const psa_key_attributes_t *attributes);
+    void                 (*set_key_lifetime)              (psa_key_attributes_t *attributes,
+                                                           psa_key_lifetime_t lifetime);
+    psa_key_lifetime_t   (*get_key_lifetime)              (const psa_key_attributes_t *attributes);
+    void                 (*set_key_usage_flags)           (psa_key_attributes_t *attributes,
+                                                           psa_key_usage_t usage_flags);
+    psa_key_usage_t      (*get_key_usage_flags)           (const psa_key_attributes_t *attributes);
+    void                 (*set_key_algorithm)             (psa_key_attributes_t *attributes,
+                                                           psa_algorithm_t alg);
+    psa_algorithm_t      (*get_key_algorithm)             (const psa_key_attributes_t *attributes);
+    void                 (*set_key_type)                  (psa_key_attributes_t *attributes,
+                                                           psa_key_type_t type);
+    psa_key_type_t       (*get_key_type)                  (const psa_key_attributes_t *attributes);
+    void                 (*set_key_bits)                  (psa_key_attributes_t *attributes,
+                                                           size_t bits);
+    size_t               (*get_key_bits)                  (const psa_key_attributes_t *attributes);
+    psa_status_t         (*get_key_attributes)            (psa_key_id_t key,
+                                                           psa_key_attributes_t *attributes);
+    void                 (*reset_key_attributes)          (psa_key_attributes_t *attributes);
+
+    /* Key management */
+    psa_status_t         (*import_key)                    (const psa_key_attributes_t *attributes,
+                                                           const uint8_t *data,
+                                                           size_t data_length,
+                                                           psa_key_id_t *key);
+    psa_status_t         (*generate_key)                  (const psa_key_attributes_t *attributes,
+                                                           psa_key_id_t *key);
+    psa_status_t         (*copy_key)                      (psa_key_id_t source_key,
+                                                           const psa_key_attributes_t *attributes,
+                                                           psa_key_id_t *target_key);
+    psa_status_t         (*destroy_key)                   (psa_key_id_t key);
+    psa_status_t         (*purge_key)                     (psa_key_id_t key);
+    psa_status_t         (*export_key)                    (psa_key_id_t key,
+                                                           uint8_t *data,
+                                                           size_t data_size,
+                                                           size_t *data_length);
+    psa_status_t         (*export_public_key)             (psa_key_id_t key,
+                                                           uint8_t *data,
+                                                           size_t data_size,
+                                                           size_t *data_length);
+
+    /* Message digests */
+    psa_status_t         (*hash_compute)                  (psa_algorithm_t alg,
+                                                           const uint8_t *input,
+                                                           size_t input_length,
+                                                           uint8_t *hash,
+                                                           size_t hash_size,
+                                                           size_t *hash_length);
+    psa_status_t         (*hash_compare)                  (psa_algorithm_t alg,
+                                                           const uint8_t *input,
+                                                           size_t input_length,
+                                                           const uint8_t *hash,
+                                                           size_t hash_length);
+    psa_hash_operation_t (*hash_operation_init)           (void);
+    psa_status_t         (*hash_setup)                    (psa_hash_operation_t *operation,
+                                                           psa_algorithm_t alg);
+    psa_status_t         (*hash_update)                   (psa_hash_operation_t *operation,
+                                                           const uint8_t *input,
+                                                           size_t input_length);
+    psa_status_t         (*hash_finish)                   (psa_hash_operation_t *operation,
+                                                           uint8_t *hash,
+                                                           size_t hash_size,
+                                                           size_t *hash_length);
+    psa_status_t         (*hash_verify)                   (psa_hash_operation_t *operation,
+                                                           const uint8_t *hash,
+                                                           size_t hash_length);
+    psa_status_t         (*hash_abort)                    (psa_hash_operation_t *operation);
+    psa_status_t         (*hash_clone)                    (const psa_hash_operation_t *source_operation,
+                                                           psa_hash_operation_t *target_operation);
+    psa_status_t         (*hash_suspend)                  (psa_hash_operation_t *operation,
+                                                           uint8_t *hash_state,
+                                                           size_t hash_state_size,
+                                                           size_t *hash_state_length);
+    psa_status_t         (*hash_resume)                   (psa_hash_operation_t *operation,
+                                                           const uint8_t *hash_state,
+                                                           size_t hash_state_length);
+
+    /* Message authentication codes */
+    psa_status_t         (*mac_compute)                   (psa_key_id_t key,
+                                                           psa_algorithm_t alg,
+                                                           const uint8_t *input,
+                                                           size_t input_length,
+                                                           uint8_t *mac,
+                                                           size_t mac_size,
+                                                           size_t *mac_length);
+    psa_status_t         (*mac_verify)                    (psa_key_id_t key,
+                                                           psa_algorithm_t alg,
+                                                           const uint8_t *input,
+                                                           size_t input_length,
+                                                           const uint8_t *mac,
+                                                           size_t mac_length);
+    psa_mac_operation_t  (*mac_operation_init)            (void);
+    psa_status_t         (*mac_sign_setup)                (psa_mac_operation_t *operation,
+                                                           psa_key_id_t key,
+                                                           psa_algorithm_t alg);
+    psa_status_t         (*mac_verify_setup)              (psa_mac_operation_t *operation,
+                                                           psa_key_id_t key,
+                                                           psa_algorithm_t alg);
+    psa_status_t         (*mac_update)                    (psa_mac_operation_t *operation,
+                                                           const uint8_t *input,
+                                                           size_t input_length);
+    psa_status_t         (*mac_sign_finish)               (psa_mac_operation_t *operation,
+                                                           uint8_t *mac,
+                                                           size_t mac_size,
+                                                           size_t *mac_length);
+    psa_status_t         (*mac_verify_finish)             (psa_mac_operation_t *operation,
+                                                           const uint8_t *mac,
+                                                           size_t mac_length);
+    psa_status_t         (*mac_abort)                     (psa_mac_operation_t *operation);
+
+    /* Unauthenticated ciphers */
+    psa_status_t         (*cipher_encrypt)                (psa_key_id_t key,
+                                                           psa_algorithm_t alg,
+                                                           const uint8_t *input,
+                                                           size_t input_length,
+                                                           uint8_t *output,
+                                                           size_t output_size,
+                                                           size_t *output_length);
+    psa_status_t         (*cipher_decrypt)                (psa_key_id_t key,
+                                                           psa_algorithm_t alg,
+                                                           const uint8_t *input,
+                                                           size_t input_length,
+                                                           uint8_t *output,
+                                                           size_t output_size,
+                                                           size_t *output_length);
+    psa_cipher_operation_t (*cipher_operation_init)       (void);
+    psa_status_t         (*cipher_encrypt_setup)          (psa_cipher_operation_t *operation,
+                                                           psa_key_id_t key,
+                                                           psa_algorithm_t alg);
+    psa_status_t         (*cipher_decrypt_setup)          (psa_cipher_operation_t *operation,
+                                                           psa_key_id_t key,
+                                                           psa_algorithm_t alg);
+    psa_status_t         (*cipher_generate_iv)            (psa_cipher_operation_t *operation,
+                                                           uint8_t *iv,
+                                                           size_t iv_size,
+                                                           size_t *iv_length);
+    psa_status_t         (*cipher_set_iv)                 (psa_cipher_operation_t *operation,
+                                                           const uint8_t *iv,
+                                                           size_t iv_length);
+    psa_status_t         (*cipher_update)                 (psa_cipher_operation_t *operation,
+                                                           const uint8_t *input,
+                                                           size_t input_length,
+                                                           uint8_t *output,
+                                                           size_t output_size,
+                                                           size_t *output_length);
+    psa_status_t         (*cipher_finish)                 (psa_cipher_operation_t *operation,
+                                                           uint8_t *output,
+                                                           size_t output_size,
+                                                           size_t *output_length);
+    psa_status_t         (*cipher_abort)                  (psa_cipher_operation_t *operation);
+
+    /* Authenticated encryption with associated data */
+    psa_status_t         (*aead_encrypt)                  (psa_key_id_t key,
+                                                           psa_algorithm_t alg,
+                                                           const uint8_t *nonce,
+                                                           size_t nonce_length,
+                                                           const uint8_t *additional_data,
+                                                           size_t additional_data_length,
+                                                           const uint8_t *plaintext,
+                                                           size_t plaintext_length,
+                                                           uint8_t *ciphertext,
+                                                           size_t ciphertext_size,
+                                                           size_t *ciphertext_length);
+    psa_status_t         (*aead_decrypt)                  (psa_key_id_t key,
+                                                           psa_algorithm_t alg,
+                                                           const uint8_t *nonce,
+                                                           size_t nonce_length,
+                                                           const uint8_t *additional_data,
+                                                           size_t additional_data_length,
+                                                           const uint8_t *ciphertext,
+                                                           size_t ciphertext_length,
+                                                           uint8_t *plaintext,
+                                                           size_t plaintext_size,
+                                                           size_t *plaintext_length);
+    psa_aead_operation_t (*aead_operation_init)           (void);
+    psa_status_t         (*aead_encrypt_setup)            (psa_aead_operation_t *operation,
+                                                           psa_key_id_t key,
+                                                           psa_algorithm_t alg);
+    psa_status_t         (*aead_decrypt_setup)            (psa_aead_operation_t *operation,
+                                                           psa_key_id_t key,
+                                                           psa_algorithm_t alg);
+    psa_status_t         (*aead_generate_nonce)           (psa_aead_operation_t *operation,
+                                                           uint8_t *nonce,
+                                                           size_t nonce_size,
+                                                           size_t *nonce_length);
+    psa_status_t         (*aead_set_nonce)                (psa_aead_operation_t *operation,
+                                                           const uint8_t *nonce,
+                                                           size_t nonce_length);
+    psa_status_t         (*aead_set_lengths)              (psa_aead_operation_t *operation,
+                                                           size_t ad_length,
+                                                           size_t plaintext_length);
+    psa_status_t         (*aead_update_ad)                (psa_aead_operation_t *operation,
+                                                           const uint8_t *input,
+                                                           size_t input_length);
+    psa_status_t         (*aead_update)                   (psa_aead_operation_t *operation,
+                                                           const uint8_t *input,
+                                                           size_t input_length,
+                                                           uint8_t *output,
+                                                           size_t output_size,
+                                                           size_t *output_length);
+    psa_status_t         (*aead_finish)                   (psa_aead_operation_t *operation,
+                                                           uint8_t *ciphertext,
+                                                           size_t ciphertext_size,
+                                                           size_t *ciphertext_length,
+                                                           uint8_t *tag,
+                                                           size_t tag_size,
+                                                           size_t *tag_length);
+    psa_status_t         (*aead_verify)                   (psa_aead_operation_t *operation,
+                                                           uint8_t *plaintext,
+                                                           size_t plaintext_size,
+                                                           size_t *plaintext_length,
+                                                           const uint8_t *tag,
+                                                           size_t tag_length);
+    psa_status_t         (*aead_abort)                    (psa_aead_operation_t *operation);
+
+    /* Asymmetric signature */
+    psa_status_t         (*sign_message)                  (psa_key_id_t key,
+                                                           psa_algorithm_t alg,
+                                                           const uint8_t *input,
+                                                           size_t input_length,
+                                                           uint8_t *signature,
+                                                           size_t signature_size,
+                                                           size_t *signature_length);
+    psa_status_t         (*verify_message)                (psa_key_id_t key,
+                                                           psa_algorithm_t alg,
+                                                           const uint8_t *input,
+                                                           size_t input_length,
+                                                           const uint8_t *signature,
+                                                           size_t signature_length);
+    psa_status_t         (*sign_hash)                     (psa_key_id_t key,
+                                                           psa_algorithm_t alg,
+                                                           const uint8_t *hash,
+                                                           size_t hash_length,
+                                                           uint8_t *signature,
+                                                           size_t signature_size,
+                                                           size_t *signature_length);
+    psa_status_t         (*verify_hash)                   (psa_key_id_t key,
+                                                           psa_algorithm_t alg,
+                                                           const uint8_t *hash,
+                                                           size_t hash_length,
+                                                           const uint8_t *signature,
+                                                           size_t signature_length);
+
+    /* Asymmetric encryption */
+    psa_status_t         (*asymmetric_encrypt)            (psa_key_id_t key,
+                                                           psa_algorithm_t alg,
+                                                           const uint8_t *input,
+                                                           size_t input_length,
+                                                           const uint8_t *salt,
+                                                           size_t salt_length,
+                                                           uint8_t *output,
+                                                           size_t output_size,
+                                                           size_t *output_length);
+    psa_status_t         (*asymmetric_decrypt)            (psa_key_id_t key,
+                                                           psa_algorithm_t alg,
+                                                           const uint8_t *input,
+                                                           size_t input_length,
+                                                           const uint8_t *salt,
+                                                           size_t salt_length,
+                                                           uint8_t *output,
+                                                           size_t output_size,
+                                                           size_t *output_length);
+
+    /* Key derivation */
+    psa_key_derivation_operation_t (*key_derivation_operation_init) (void);
+    psa_status_t         (*key_derivation_setup)          (psa_key_derivation_operation_t *operation,
+                                                           psa_algorithm_t alg);
+    psa_status_t         (*key_derivation_get_capacity)   (const psa_key_derivation_operation_t *operation,
+                                                           size_t *capacity);
+    psa_status_t         (*key_derivation_set_capacity)   (psa_key_derivation_operation_t *operation,
+                                                           size_t capacity);
+    psa_status_t         (*key_derivation_input_bytes)    (psa_key_derivation_operation_t *operation,
+                                                           psa_key_derivation_step_t step,
+                                                           const uint8_t *data,
+                                                           size_t data_length);
+    psa_status_t         (*key_derivation_input_integer)  (psa_key_derivation_operation_t *operation,
+                                                           psa_key_derivation_step_t step,
+                                                           uint64_t value);
+    psa_status_t         (*key_derivation_input_key)      (psa_key_derivation_operation_t *operation,
+                                                           psa_key_derivation_step_t step,
+                                                           psa_key_id_t key);
+    psa_status_t         (*key_derivation_key_agreement)  (psa_key_derivation_operation_t *operation,
+                                                           psa_key_derivation_step_t step,
+                                                           psa_key_id_t private_key,
+                                                           const uint8_t *peer_key,
+                                                           size_t peer_key_length);
+    psa_status_t         (*key_derivation_output_bytes)   (psa_key_derivation_operation_t *operation,
+                                                           uint8_t *output,
+                                                           size_t output_length);
+    psa_status_t         (*key_derivation_output_key)     (const psa_key_attributes_t *attributes,
+                                                           psa_key_derivation_operation_t *operation,
+                                                           psa_key_id_t *key);
+    psa_status_t         (*key_derivation_verify_bytes)   (psa_key_derivation_operation_t *operation,
+                                                           const uint8_t *expected_output,
+                                                           size_t output_length);
+    psa_status_t         (*key_derivation_verify_key)     (psa_key_derivation_operation_t *operation,
+                                                           psa_key_id_t expected);
+    psa_status_t         (*key_derivation_abort)          (psa_key_derivation_operation_t *operation);
+
+    /* Key agreement */
+    psa_status_t         (*raw_key_agreement)             (psa_algorithm_t alg,
+                                                           psa_key_id_t private_key,
+                                                           const uint8_t *peer_key,
+                                                           size_t peer_key_length,
+                                                           uint8_t *output,
+                                                           size_t output_size,
+                                                           size_t *output_length);
+
+    /* Random number generation */
+    psa_status_t         (*generate_random)               (uint8_t *output,
+                                                           size_t output_size);
+
+    /* PAL services */
+    int32_t              (*free_keys)                     (void);
+    int32_t              (*reset)                         (void);
+    uint32_t             (*live_key_count)                (void);
+    uint32_t             (*key_track_overflow)            (void);
+    uint32_t             (*free_key_slots)                (void);
+    psa_status_t         (*fixture_key)                   (const psa_key_attributes_t *attributes,
+                                                           psa_key_id_t *key);
+} pal_crypto_api_t;
+
+/* Crypto dispatch table of the platform */
+extern const pal_crypto_api_t pal_crypto_api;
+
+#endif /* _PAL_CRYPTO_API_H_ */
@@ -53,6 +53,10 @@
 #error "ARCH_TEST_ECC_CURVE_SECP384R1 defined, but not all prerequisites"
 #endif
 
+#if defined(ARCH_TEST_ECC_CURVE_25519) && !defined(ARCH_TEST_ECC)
+#error "ARCH_TEST_ECC_CURVE_25519 defined, but not all prerequisites"
+#endif
+
 #if defined(ARCH_TEST_AES_128) && !defined(ARCH_TEST_AES)
 #error "ARCH_TEST_AES_128 defined, but not all prerequisites"
 #endif
@@ -216,4 +220,17 @@
 #error "ARCH_TEST_ECDSA defined, but not all prerequisites"
 #endif
 
+#if defined(ARCH_TEST_RSA_PSS) && !defined(ARCH_TEST_RSA)
+#error "ARCH_TEST_RSA_PSS defined, but not all prerequisites"
+#endif
+
+#if defined(ARCH_TEST_EDDSA) && !defined(ARCH_TEST_ECC)
+#error "ARCH_TEST_EDDSA defined, but not all prerequisites"
+#endif
+
+#if (defined(ARCH_TEST_FFDHE2048) || defined(ARCH_TEST_FFDHE3072) || \
+     defined(ARCH_TEST_FFDHE4096)) && !defined(ARCH_TEST_FFDH)
+#error "ARCH_TEST_FFDHEXXXX defined, but not all prerequisites"
+#endif
+
 #endif /* _PAL_CRYPTO_CONFIG_CHECK_H_ */
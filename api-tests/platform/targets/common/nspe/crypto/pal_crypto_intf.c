@@ -1,5 +1,5 @@
 /** @file
- * Copyright (c) 2019-2024, Arm Limited or its affiliates. All rights reserved.
+ * Copyright (c) 2019-2026, Arm Limited or its affiliates. All rights reserved.
  * SPDX-License-Identifier : Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -18,882 +18,587 @@
 
 #include "pal_crypto_intf.h"
 
-#define  PAL_KEY_SLOT_COUNT  32
+/* Keys created through the dispatch table are tracked in an open addressed set
+ * with linear probing, kept at most half full, so that they can be destroyed
+ * at the end of the test. Keys destroyed by the test leave the set in O(1).
+ */
+#define PAL_KEY_TRACK_SLOTS     (2 * PAL_KEY_TRACK_COUNT)
+#define PAL_KEY_TRACK_MASK      (PAL_KEY_TRACK_SLOTS - 1)
 
 int pal_system_reset(void);
-psa_key_id_t g_global_key_array[PAL_KEY_SLOT_COUNT];
-uint8_t g_key_count;
+
+static psa_key_id_t g_key_track[PAL_KEY_TRACK_SLOTS];
+static uint32_t     g_key_track_count;
+static uint32_t     g_key_track_overflow;
+
+/* Keys which are slow to generate, such as RSA key pairs, are generated once
+ * as persistent fixture keys, PAL_KEY_FIXTURE_COUNT IDs from
+ * PAL_KEY_FIXTURE_ID_BASE, and copied by export and import into the keys of
+ * the tests which only need a valid key of a type and size. The fixtures are
+ * not tracked: pal_crypto_free_keys leaves them in the key store, so that the
+ * next test and the next run find them.
+ */
+static uint8_t      g_key_fixture_data[PAL_KEY_FIXTURE_MAX_SIZE];
+
+/* Untracked keys filling the key store while its free slots are counted */
+static psa_key_id_t g_key_probe[PAL_KEY_PROBE_COUNT];
+
+/**
+    @brief    - Returns the home slot of a key in the tracked key set
+    @param    - key     : Key ID
+    @return   - Slot index
+**/
+static uint32_t pal_key_track_slot(psa_key_id_t key)
+{
+	return ((uint32_t)key * 2654435761u) & PAL_KEY_TRACK_MASK;
+}
+
+/**
+    @brief    - Adds a created key to the tracked key set. Keys which do not
+                fit are counted, see pal_crypto_key_track_overflow.
+    @param    - key     : Key ID
+    @return   - void
+**/
+static void pal_key_track_add(psa_key_id_t key)
+{
+	uint32_t i;
+
+	if (key == (psa_key_id_t)0)
+		return;
+
+	for (i = pal_key_track_slot(key); g_key_track[i] != (psa_key_id_t)0;
+		 i = (i + 1) & PAL_KEY_TRACK_MASK) {
+		if (g_key_track[i] == key)
+			return;
+	}
+
+	if (g_key_track_count >= PAL_KEY_TRACK_COUNT) {
+		g_key_track_overflow++;
+		return;
+	}
+
+	g_key_track[i] = key;
+	g_key_track_count++;
+}
 
 /**
-    @brief    - This API will call the requested crypto function
-    @param    - type    : function code
-                valist  : variable argument list
+    @brief    - Removes a key from the tracked key set. The entries following
+                it in its cluster are shifted back, so that no tombstone is
+                left behind.
+    @param    - key     : Key ID
+    @return   - void
+**/
+static void pal_key_track_remove(psa_key_id_t key)
+{
+	uint32_t i, j, home;
+
+	if (key == (psa_key_id_t)0)
+		return;
+
+	for (i = pal_key_track_slot(key); g_key_track[i] != key;
+		 i = (i + 1) & PAL_KEY_TRACK_MASK) {
+		if (g_key_track[i] == (psa_key_id_t)0)
+			return;
+	}
+
+	for (j = (i + 1) & PAL_KEY_TRACK_MASK; g_key_track[j] != (psa_key_id_t)0;
+		 j = (j + 1) & PAL_KEY_TRACK_MASK) {
+		home = pal_key_track_slot(g_key_track[j]);
+		/* The entry can fill the hole if the hole lies between its home slot and it */
+		if (((j - home) & PAL_KEY_TRACK_MASK) >= ((j - i) & PAL_KEY_TRACK_MASK)) {
+			g_key_track[i] = g_key_track[j];
+			i = j;
+		}
+	}
+
+	g_key_track[i] = (psa_key_id_t)0;
+	g_key_track_count--;
+}
+
+/**
+    @brief    - Checks if a key is present in the key store
+    @param    - key     : Key ID
+    @return   - 1 if the key is present, 0 otherwise
+**/
+static int pal_key_is_live(psa_key_id_t key)
+{
+	psa_key_attributes_t attributes = psa_key_attributes_init();
+	psa_status_t         status;
+
+	status = psa_get_key_attributes(key, &attributes);
+	psa_reset_key_attributes(&attributes);
+	return (status == PSA_SUCCESS) ? 1 : 0;
+}
+
+/**
+    @brief    - Counts the tracked keys still present in the key store, probing
+                each of them with psa_get_key_attributes. Keys found destroyed
+                leave the tracked key set.
+    @param    - void
+    @return   - Number of live keys
+**/
+static uint32_t pal_crypto_live_key_count(void)
+{
+	uint32_t i = 0;
+
+	while (i < PAL_KEY_TRACK_SLOTS) {
+		/* A removal may shift another entry into slot i, check it again */
+		if (g_key_track[i] != (psa_key_id_t)0 && !pal_key_is_live(g_key_track[i]))
+			pal_key_track_remove(g_key_track[i]);
+		else
+			i++;
+	}
+
+	return g_key_track_count;
+}
+
+/**
+    @brief    - Returns the number of created keys which did not fit in the
+                tracked key set since the previous call, and were therefore not
+                destroyed at the end of their test
+    @param    - void
+    @return   - Number of untracked keys
+**/
+static uint32_t pal_crypto_key_track_overflow(void)
+{
+	uint32_t overflow = g_key_track_overflow;
+
+	g_key_track_overflow = 0;
+	return overflow;
+}
+
+/**
+    @brief    - Counts the free key slots of the key store, importing untracked
+                volatile keys until the store is full and destroying them. This
+                sees the keys that no tracked key accounts for, such as keys
+                created around the PAL or slots the service failed to release.
+    @param    - void
+    @return   - Number of free key slots, PAL_KEY_PROBE_COUNT when the store can
+                hold at least that many more keys, as a store allocating its
+                slots dynamically does
+**/
+static uint32_t pal_crypto_free_key_slots(void)
+{
+	psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+	const uint8_t        data[1] = {0};
+	uint32_t             count, i;
+
+	if (psa_crypto_init() != PSA_SUCCESS)
+		return 0;
+
+	psa_set_key_type(&attributes, PSA_KEY_TYPE_RAW_DATA);
+	for (count = 0; count < PAL_KEY_PROBE_COUNT; count++) {
+		if (psa_import_key(&attributes, data, sizeof(data), &g_key_probe[count]) != PSA_SUCCESS)
+			break;
+	}
+
+	for (i = 0; i < count; i++)
+		psa_destroy_key(g_key_probe[i]);
+
+	return count;
+}
+
+/**
+    @brief    - Imports a key, tracking it for pal_crypto_free_keys
+    @param    - Arguments of psa_import_key
     @return   - error status
 **/
-int32_t pal_crypto_function(int type, va_list valist)
+static psa_status_t pal_crypto_import_key(const psa_key_attributes_t *attributes,
+										  const uint8_t *data,
+										  size_t data_length,
+										  psa_key_id_t *key)
 {
-    psa_algorithm_t                           alg;
-    const uint8_t                            *input, *input1;
-    uint64_t                                  input_value;
-    size_t                                    input_length, input_length1, bits;
-    uint8_t                                  *output;
-    size_t                                    output_size;
-    size_t                                    output_length, *p_output_length;
-    size_t                                   *p_bits;
-    psa_key_id_t                              key, id;
-    psa_cipher_operation_t                   *cipher_operation, cipher_operation_temp;
-    const psa_key_attributes_t               *c_attributes;
-    psa_key_attributes_t                     *attributes, attributes_temp;
-    psa_key_id_t                             *target_key, *p_id, *p_key;
-    psa_algorithm_t                          *p_alg;
-    psa_key_lifetime_t                        lifetime;
-    psa_key_lifetime_t                       *p_lifetime;
-    psa_key_type_t                           *p_type;
-    psa_key_usage_t                           usage_flags;
-    psa_key_usage_t                          *p_usage_flags;
-    psa_hash_operation_t                     *hash_operation, *hash_target_operation;
-    psa_hash_operation_t                      hash_operation_temp;
-    const psa_hash_operation_t               *hash_source_operation;
-    psa_key_derivation_operation_t           *derivation_operation, derivation_operation_temp;
-    const psa_key_derivation_operation_t     *c_derivation_operation;
-    psa_key_derivation_step_t                 step;
-    psa_mac_operation_t                      *mac_operation, mac_operation_temp;
-    psa_aead_operation_t                     *aead_operation, aead_operation_temp;
-    const uint8_t                            *nonce;
-    size_t                                    nonce_length;
-    const uint8_t                            *additional_data;
-    size_t                                    additional_data_length;
-    psa_status_t                              status;
-    uint8_t                                  *output1;
-    size_t                                   output_size1, *p_output_length1;
-#ifdef CRYPTO_1_1_0
-    const uint8_t                            *expected_output;
+	psa_status_t status;
+
+	status = psa_import_key(attributes, data, data_length, key);
+	if (status == PSA_SUCCESS)
+		pal_key_track_add(*key);
+	return status;
+}
+
+/**
+    @brief    - Generates a key, tracking it for pal_crypto_free_keys
+    @param    - Arguments of psa_generate_key
+    @return   - error status
+**/
+static psa_status_t pal_crypto_generate_key(const psa_key_attributes_t *attributes,
+											psa_key_id_t *key)
+{
+	psa_status_t status;
+
+	status = psa_generate_key(attributes, key);
+	if (status == PSA_SUCCESS)
+		pal_key_track_add(*key);
+	return status;
+}
+
+/**
+    @brief    - Copies a key, tracking the copy for pal_crypto_free_keys
+    @param    - Arguments of psa_copy_key
+    @return   - error status
+**/
+static psa_status_t pal_crypto_copy_key(psa_key_id_t source_key,
+										const psa_key_attributes_t *attributes,
+										psa_key_id_t *target_key)
+{
+	psa_status_t status;
+
+	status = psa_copy_key(source_key, attributes, target_key);
+	if (status == PSA_SUCCESS)
+		pal_key_track_add(*target_key);
+	return status;
+}
+
+/**
+    @brief    - Derives a key, tracking it for pal_crypto_free_keys
+    @param    - Arguments of psa_key_derivation_output_key
+    @return   - error status
+**/
+static psa_status_t pal_crypto_key_derivation_output_key(const psa_key_attributes_t *attributes,
+														 psa_key_derivation_operation_t *operation,
+														 psa_key_id_t *key)
+{
+	psa_status_t status;
+
+	status = psa_key_derivation_output_key(attributes, operation, key);
+	if (status == PSA_SUCCESS)
+		pal_key_track_add(*key);
+	return status;
+}
+
+/**
+    @brief    - Destroys a key, removing it from the tracked key set
+    @param    - Arguments of psa_destroy_key
+    @return   - error status
+**/
+static psa_status_t pal_crypto_destroy_key(psa_key_id_t key)
+{
+	psa_status_t status;
+
+	status = psa_destroy_key(key);
+	if (status == PSA_SUCCESS)
+		pal_key_track_remove(key);
+	return status;
+}
+
+#ifndef ARCH_TEST_HASH_SUSPEND
+static psa_status_t pal_crypto_hash_suspend(psa_hash_operation_t *operation,
+											uint8_t *hash_state,
+											size_t hash_state_size,
+											size_t *hash_state_length)
+{
+	(void)operation;
+	(void)hash_state;
+	(void)hash_state_size;
+	(void)hash_state_length;
+	return (psa_status_t)PAL_STATUS_UNSUPPORTED_FUNC;
+}
 #endif
 
+#ifndef ARCH_TEST_HASH_RESUME
+static psa_status_t pal_crypto_hash_resume(psa_hash_operation_t *operation,
+										   const uint8_t *hash_state,
+										   size_t hash_state_length)
+{
+	(void)operation;
+	(void)hash_state;
+	(void)hash_state_length;
+	return (psa_status_t)PAL_STATUS_UNSUPPORTED_FUNC;
+}
+#endif
 
-    switch (type)
-	{
-		case PAL_CRYPTO_AEAD_DECRYPT:
-			key                      = va_arg(valist, psa_key_id_t);
-			alg                      = va_arg(valist, psa_algorithm_t);
-			nonce                    = va_arg(valist, const uint8_t *);
-			nonce_length             = va_arg(valist, size_t);
-			additional_data          = va_arg(valist, const uint8_t *);
-			additional_data_length   = va_arg(valist, size_t);
-			input                    = va_arg(valist, const uint8_t *);
-			input_length             = va_arg(valist, size_t);
-			output                   = va_arg(valist, uint8_t *);
-			output_size              = va_arg(valist, size_t);
-			p_output_length          = va_arg(valist, size_t *);
-			return psa_aead_decrypt(key,
-									alg,
-									nonce,
-									nonce_length,
-									additional_data,
-									additional_data_length,
-									input,
-									input_length,
-									output,
-									output_size,
-									p_output_length);
-			break;
-		case PAL_CRYPTO_AEAD_ENCRYPT:
-			key                      = va_arg(valist, psa_key_id_t);
-			alg                      = va_arg(valist, psa_algorithm_t);
-			nonce                    = va_arg(valist, const uint8_t *);
-			nonce_length             = va_arg(valist, size_t);
-			additional_data          = va_arg(valist, const uint8_t *);
-			additional_data_length   = va_arg(valist, size_t);
-			input                    = va_arg(valist, const uint8_t *);
-			input_length             = va_arg(valist, size_t);
-			output                   = va_arg(valist, uint8_t *);
-			output_size              = va_arg(valist, size_t);
-			p_output_length          = va_arg(valist, size_t *);
-			return psa_aead_encrypt(key,
-									alg,
-									nonce,
-									nonce_length,
-									additional_data,
-									additional_data_length,
-									input,
-									input_length,
-									output,
-									output_size,
-									p_output_length);
-			break;
-		case PAL_CRYPTO_AEAD_ABORT:
-			aead_operation           = va_arg(valist, psa_aead_operation_t *);
-			return psa_aead_abort(aead_operation);
-			break;
-		case PAL_CRYPTO_AEAD_DECRYPT_SETUP:
-			aead_operation           = va_arg(valist, psa_aead_operation_t *);
-			key                      = va_arg(valist, psa_key_id_t);
-			alg                      = va_arg(valist, psa_algorithm_t);
-			return psa_aead_decrypt_setup(aead_operation,
-										  key,
-										  alg);
-			break;
-		case PAL_CRYPTO_AEAD_ENCRYPT_SETUP:
-			aead_operation           = va_arg(valist, psa_aead_operation_t *);
-			key                      = va_arg(valist, psa_key_id_t);
-			alg                      = va_arg(valist, psa_algorithm_t);
-			return psa_aead_encrypt_setup(aead_operation,
-										  key,
-										  alg);
-			break;
-		case PAL_CRYPTO_AEAD_FINISH:
-			aead_operation           = va_arg(valist, psa_aead_operation_t *);
-			output                   = va_arg(valist, uint8_t *);
-			output_size              = va_arg(valist, size_t);
-			p_output_length          = va_arg(valist, size_t *);
-			output1                  = va_arg(valist, uint8_t *);
-			output_size1             = va_arg(valist, size_t);
-			p_output_length1         = va_arg(valist, size_t *);
-			return psa_aead_finish(aead_operation,
-								   output,
-								   output_size,
-								   p_output_length,
-								   output1,
-								   output_size1,
-								   p_output_length1);
-			break;
-		case PAL_CRYPTO_AEAD_GENERATE_NONCE:
-			aead_operation           = va_arg(valist, psa_aead_operation_t *);
-			output                   = va_arg(valist, uint8_t *);
-			output_size              = va_arg(valist, size_t);
-			p_output_length          = va_arg(valist, size_t *);
-			return psa_aead_generate_nonce(aead_operation,
-										   output,
-										   output_size,
-										   p_output_length);
-			break;
-		case PAL_CRYPTO_AEAD_SET_LENGTHS:
-			aead_operation           = va_arg(valist, psa_aead_operation_t *);
-			input_length             = va_arg(valist, size_t);
-			input_length1            = va_arg(valist, size_t);
-			return psa_aead_set_lengths(aead_operation,
-										input_length,
-										input_length1);
-			break;
-		case PAL_CRYPTO_AEAD_SET_NONCE:
-			aead_operation           = va_arg(valist, psa_aead_operation_t *);
-			input                    = va_arg(valist, const uint8_t *);
-			input_length             = va_arg(valist, size_t);
-			return psa_aead_set_nonce(aead_operation,
-									  input,
-									  input_length);
-			break;
-		case PAL_CRYPTO_AEAD_UPDATE:
-			aead_operation           = va_arg(valist, psa_aead_operation_t *);
-			input                    = va_arg(valist, const uint8_t *);
-			input_length             = va_arg(valist, size_t);
-			output                   = va_arg(valist, uint8_t *);
-			output_size              = va_arg(valist, size_t);
-			p_output_length          = va_arg(valist, size_t *);
-			return psa_aead_update(aead_operation,
-								   input,
-								   input_length,
-								   output,
-								   output_size,
-								   p_output_length);
-			break;
-		case PAL_CRYPTO_AEAD_UPDATE_AD:
-			aead_operation           = va_arg(valist, psa_aead_operation_t *);
-			input                    = va_arg(valist, const uint8_t *);
-			input_length             = va_arg(valist, size_t);
-			return psa_aead_update_ad(aead_operation,
-									  input,
-									  input_length);
-			break;
-		case PAL_CRYPTO_AEAD_VERIFY:
-			aead_operation           = va_arg(valist, psa_aead_operation_t *);
-			output                   = va_arg(valist, uint8_t *);
-			output_size              = va_arg(valist, size_t);
-			p_output_length          = va_arg(valist, size_t *);
-			input                    = va_arg(valist, const uint8_t *);
-			input_length             = va_arg(valist, size_t);
-			return psa_aead_verify(aead_operation,
-								   output,
-								   output_size,
-								   p_output_length,
-								   input,
-								   input_length);
-			break;
-		case PAL_CRYPTO_AEAD_OPERATION_INIT:
-			aead_operation           = va_arg(valist, psa_aead_operation_t *);
-			aead_operation_temp      = psa_aead_operation_init();
-			memcpy((void *)aead_operation, (void *)&aead_operation_temp,
-				   sizeof(psa_aead_operation_t));
-			return 0;
-			break;
-		case PAL_CRYPTO_ASYMMETRIC_DECRYPT:
-			key                      = va_arg(valist, psa_key_id_t);
-			alg                      = va_arg(valist, psa_algorithm_t);
-			input                    = va_arg(valist, const uint8_t *);
-			input_length             = va_arg(valist, size_t);
-			input1                   = va_arg(valist, const uint8_t *);
-			input_length1            = va_arg(valist, size_t);
-			output                   = va_arg(valist, uint8_t *);
-			output_size              = va_arg(valist, size_t);
-			p_output_length          = va_arg(valist, size_t *);
-			return psa_asymmetric_decrypt(key,
-										  alg,
-										  input,
-										  input_length,
-										  input1,
-										  input_length1,
-										  output,
-										  output_size,
-										  p_output_length);
-			break;
-		case PAL_CRYPTO_ASYMMETRIC_ENCRYPT:
-			key                      = va_arg(valist, psa_key_id_t);
-			alg                      = va_arg(valist, psa_algorithm_t);
-			input                    = va_arg(valist, const uint8_t *);
-			input_length             = va_arg(valist, size_t);
-			input1                   = va_arg(valist, const uint8_t *);
-			input_length1            = va_arg(valist, size_t);
-			output                   = va_arg(valist, uint8_t *);
-			output_size              = va_arg(valist, size_t);
-			p_output_length          = va_arg(valist, size_t *);
-			return psa_asymmetric_encrypt(key,
-										  alg,
-										  input,
-										  input_length,
-										  input1,
-										  input_length1,
-										  output,
-										  output_size,
-										  p_output_length);
-			break;
-		case PAL_CRYPTO_CIPHER_ABORT:
-			cipher_operation         =  va_arg(valist, psa_cipher_operation_t *);
-			return psa_cipher_abort(cipher_operation);
-			break;
-		case PAL_CRYPTO_CIPHER_DECRYPT:
-			key                      = va_arg(valist, psa_key_id_t);
-			alg                      = va_arg(valist, psa_algorithm_t);
-			input                    = va_arg(valist, const uint8_t *);
-			input_length             = va_arg(valist, size_t);
-			output                   = va_arg(valist, uint8_t *);
-			output_size              = va_arg(valist, size_t);
-			p_output_length          = va_arg(valist, size_t *);
-			return psa_cipher_decrypt(key,
-									  alg,
-									  input,
-									  input_length,
-									  output,
-									  output_size,
-									  p_output_length);
-			break;
-		case PAL_CRYPTO_CIPHER_DECRYPT_SETUP:
-			cipher_operation         = va_arg(valist, psa_cipher_operation_t *);
-			key                      = va_arg(valist, psa_key_id_t);
-			alg                      = va_arg(valist, psa_algorithm_t);
-			return psa_cipher_decrypt_setup(cipher_operation,
-											key,
-											alg);
-			break;
-		case PAL_CRYPTO_CIPHER_ENCRYPT:
-			key                      = va_arg(valist, psa_key_id_t);
-			alg                      = va_arg(valist, psa_algorithm_t);
-			input                    = va_arg(valist, const uint8_t *);
-			input_length             = va_arg(valist, size_t);
-			output                   = va_arg(valist, uint8_t *);
-			output_size              = va_arg(valist, size_t);
-			p_output_length          = va_arg(valist, size_t *);
-			return psa_cipher_encrypt(key,
-									  alg,
-									  input,
-									  input_length,
-									  output,
-									  output_size,
-									  p_output_length);
-			break;
-		case PAL_CRYPTO_CIPHER_ENCRYPT_SETUP:
-			cipher_operation         = va_arg(valist, psa_cipher_operation_t *);
-			key                      = va_arg(valist, psa_key_id_t);
-			alg                      = va_arg(valist, psa_algorithm_t);
-			return psa_cipher_encrypt_setup(cipher_operation,
-											key,
-											alg);
-			break;
-		case PAL_CRYPTO_CIPHER_FINISH:
-			cipher_operation         = va_arg(valist, psa_cipher_operation_t *);
-			output                   = va_arg(valist, uint8_t *);
-			output_size              = va_arg(valist, size_t);
-			p_output_length          = va_arg(valist, size_t *);
-			return psa_cipher_finish(cipher_operation,
-									 output,
-									 output_size,
-									 p_output_length);
-			break;
-		case PAL_CRYPTO_CIPHER_GENERATE_IV:
-			cipher_operation         = va_arg(valist, psa_cipher_operation_t *);
-			output                   = va_arg(valist, uint8_t *);
-			output_size              = va_arg(valist, size_t);
-			p_output_length          = va_arg(valist, size_t *);
-			return psa_cipher_generate_iv(cipher_operation,
-										  output,
-										  output_size,
-										  p_output_length);
-			break;
-		case PAL_CRYPTO_CIPHER_OPERATION_INIT:
-			cipher_operation         = va_arg(valist, psa_cipher_operation_t *);
-			cipher_operation_temp    = psa_cipher_operation_init();
-			memcpy((void *)cipher_operation, (void *)&cipher_operation_temp,
-				   sizeof(psa_cipher_operation_t));
-			return 0;
-			break;
-		case PAL_CRYPTO_CIPHER_SET_IV:
-			cipher_operation         = va_arg(valist, psa_cipher_operation_t *);
-			input                    = va_arg(valist, const uint8_t *);
-			input_length             = va_arg(valist, size_t);
-			return psa_cipher_set_iv(cipher_operation,
-									 input,
-									 input_length);
-			break;
-		case PAL_CRYPTO_CIPHER_UPDATE:
-			cipher_operation         = va_arg(valist, psa_cipher_operation_t *);
-			input                    = va_arg(valist, const uint8_t *);
-			input_length             = va_arg(valist, size_t);
-			output                   = va_arg(valist, uint8_t *);
-			output_size              = va_arg(valist, size_t);
-			p_output_length          = va_arg(valist, size_t *);
-			return psa_cipher_update(cipher_operation,
-									 input,
-									 input_length,
-									 output,
-									 output_size,
-									 p_output_length);
-			break;
-		case PAL_CRYPTO_COPY_KEY:
-			key                      = va_arg(valist, psa_key_id_t);
-			c_attributes             = va_arg(valist, const psa_key_attributes_t *);
-			target_key               = va_arg(valist, psa_key_id_t *);
-			status = psa_copy_key(key,
-								c_attributes,
-								target_key);
-			g_global_key_array[g_key_count++] = *target_key;
-                        return status;
-			break;
-		case PAL_CRYPTO_INIT:
-			return psa_crypto_init();
-			break;
-		case PAL_CRYPTO_DESTROY_KEY:
-			key                      = va_arg(valist, psa_key_id_t);
-			return psa_destroy_key(key);
-			break;
-		case PAL_CRYPTO_EXPORT_KEY:
-			key                      = va_arg(valist, psa_key_id_t);
-			output                   = va_arg(valist, uint8_t *);
-			output_size              = va_arg(valist, size_t);
-			p_output_length          = va_arg(valist, size_t *);
-			return psa_export_key(key,
-								  output,
-								  output_size,
-								  p_output_length);
-			break;
-		case PAL_CRYPTO_EXPORT_PUBLIC_KEY:
-			key                      = va_arg(valist, psa_key_id_t);
-			output                   = va_arg(valist, uint8_t *);
-			output_size              = va_arg(valist, size_t);
-			p_output_length          = va_arg(valist, size_t *);
-			return psa_export_public_key(key,
-										 output,
-										 output_size,
-										 p_output_length);
-			break;
-		case PAL_CRYPTO_GENERATE_KEY:
-			c_attributes             = va_arg(valist, const psa_key_attributes_t *);
-			target_key               = va_arg(valist, psa_key_id_t *);
-			status =  psa_generate_key(c_attributes, target_key);
-                        g_global_key_array[g_key_count++] = *target_key;
-                        return status;
-			break;
-		case PAL_CRYPTO_GENERATE_RANDOM:
-			output                   = va_arg(valist, uint8_t *);
-			output_size              = va_arg(valist, size_t);
-			return psa_generate_random(output,
-									   output_size);
-			break;
-		case PAL_CRYPTO_GET_KEY_ALGORITHM:
-			c_attributes             = va_arg(valist, const psa_key_attributes_t *);
-			p_alg                    = va_arg(valist, psa_algorithm_t *);
-			*p_alg                   = psa_get_key_algorithm(c_attributes);
-			return 0;
-			break;
-		case PAL_CRYPTO_GET_KEY_ATTRIBUTES:
-			key                      = va_arg(valist, psa_key_id_t);
-			attributes               = va_arg(valist, psa_key_attributes_t *);
-			return psa_get_key_attributes(key,
-										  attributes);
-			break;
-		case PAL_CRYPTO_GET_KEY_BITS:
-			c_attributes             = va_arg(valist, const psa_key_attributes_t *);
-			p_bits                   = va_arg(valist, size_t *);
-			*p_bits                  = psa_get_key_bits(c_attributes);
-			return 0;
-			break;
-		case PAL_CRYPTO_GET_KEY_ID:
-			c_attributes             = va_arg(valist, const psa_key_attributes_t *);
-			p_id                     = va_arg(valist, psa_key_id_t *);
-			*p_id                    = psa_get_key_id(c_attributes);
-			return 0;
-			break;
-		case PAL_CRYPTO_GET_KEY_LIFETIME:
-			c_attributes             = va_arg(valist, const psa_key_attributes_t *);
-			p_lifetime               = va_arg(valist, psa_key_lifetime_t *);
-			*p_lifetime              = psa_get_key_lifetime(c_attributes);
-			return 0;
-			break;
-		case PAL_CRYPTO_GET_KEY_TYPE:
-			c_attributes             = va_arg(valist, const psa_key_attributes_t *);
-			p_type                   = va_arg(valist, psa_key_type_t *);
-			*p_type                  = psa_get_key_type(c_attributes);
-			return 0;
-			break;
-		case PAL_CRYPTO_GET_KEY_USAGE_FLAGS:
-			c_attributes             = va_arg(valist, const psa_key_attributes_t *);
-			p_usage_flags            = va_arg(valist, psa_key_usage_t *);
-			*p_usage_flags           = psa_get_key_usage_flags(c_attributes);
-			return 0;
-			break;
-		case PAL_CRYPTO_HASH_ABORT:
-			hash_operation           = va_arg(valist, psa_hash_operation_t *);
-			return psa_hash_abort(hash_operation);
-			break;
-		case PAL_CRYPTO_HASH_CLONE:
-			hash_source_operation    = va_arg(valist, const psa_hash_operation_t *);
-			hash_target_operation    = va_arg(valist, psa_hash_operation_t *);
-			return psa_hash_clone(hash_source_operation,
-								  hash_target_operation);
-			break;
-		case PAL_CRYPTO_HASH_COMPARE:
-			alg                      = va_arg(valist, psa_algorithm_t);
-			input                    = va_arg(valist, const uint8_t *);
-			input_length             = va_arg(valist, size_t);
-			input1                   = va_arg(valist, const uint8_t *);
-			input_length1            = va_arg(valist, size_t);
-			return psa_hash_compare(alg,
-									input,
-									input_length,
-									input1,
-									input_length1);
-			break;
-		case PAL_CRYPTO_HASH_COMPUTE:
-			alg                      = va_arg(valist, psa_algorithm_t);
-			input                    = va_arg(valist, const uint8_t *);
-			input_length             = va_arg(valist, size_t);
-			output                   = va_arg(valist, uint8_t *);
-			output_size              = va_arg(valist, size_t);
-			p_output_length          = va_arg(valist, size_t *);
-			return psa_hash_compute(alg,
-									input,
-									input_length,
-									output,
-									output_size,
-									p_output_length);
+#ifndef ARCH_TEST_PBKDF2
+static psa_status_t pal_crypto_key_derivation_input_integer(psa_key_derivation_operation_t *operation,
+															psa_key_derivation_step_t step,
+															uint64_t value)
+{
+	(void)operation;
+	(void)step;
+	(void)value;
+	return (psa_status_t)PAL_STATUS_UNSUPPORTED_FUNC;
+}
+#endif
+
+#ifndef CRYPTO_1_1_0
+static psa_status_t pal_crypto_key_derivation_verify_bytes(psa_key_derivation_operation_t *operation,
+														   const uint8_t *expected_output,
+														   size_t output_length)
+{
+	(void)operation;
+	(void)expected_output;
+	(void)output_length;
+	return (psa_status_t)PAL_STATUS_UNSUPPORTED_FUNC;
+}
+
+static psa_status_t pal_crypto_key_derivation_verify_key(psa_key_derivation_operation_t *operation,
+														 psa_key_id_t expected)
+{
+	(void)operation;
+	(void)expected;
+	return (psa_status_t)PAL_STATUS_UNSUPPORTED_FUNC;
+}
+#endif
+/**
+    @brief    - Looks up the key fixture of a key type and size
+    @param    - type    : Key type
+                bits    : Key size
+                fixture : ID of the fixture found
+                free_id : First unused fixture ID, 0 if all are used
+    @return   - PSA_SUCCESS if a fixture was found
+**/
+static psa_status_t pal_key_fixture_find(psa_key_type_t type,
+										 size_t bits,
+										 psa_key_id_t *fixture,
+										 psa_key_id_t *free_id)
+{
+	psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+	psa_key_id_t         id;
+	uint32_t             i;
+	int                  match;
+
+	*free_id = 0;
+	for (i = 0; i < PAL_KEY_FIXTURE_COUNT; i++) {
+		id = (psa_key_id_t)(PAL_KEY_FIXTURE_ID_BASE + i);
+		if (psa_get_key_attributes(id, &attributes) != PSA_SUCCESS) {
+			if (*free_id == 0)
+				*free_id = id;
+			continue;
+		}
+
+		match = (psa_get_key_type(&attributes) == type &&
+				 psa_get_key_bits(&attributes) == bits);
+		psa_reset_key_attributes(&attributes);
+		if (match) {
+			*fixture = id;
+			return PSA_SUCCESS;
+		}
+
+		/* Do not keep the other fixtures loaded in key slots */
+		psa_purge_key(id);
+	}
+
+	return PSA_ERROR_DOES_NOT_EXIST;
+}
+
+/**
+    @brief    - Generates the persistent fixture of a key type and size,
+                exportable so that it can be copied into other keys
+    @param    - type : Key type
+                bits : Key size
+                id   : Fixture ID
+    @return   - error status
+**/
+static psa_status_t pal_key_fixture_create(psa_key_type_t type,
+										   size_t bits,
+										   psa_key_id_t id)
+{
+	psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+	psa_key_id_t         key;
+	psa_status_t         status;
+
+	psa_set_key_id(&attributes, id);
+	psa_set_key_lifetime(&attributes, PSA_KEY_LIFETIME_PERSISTENT);
+	psa_set_key_type(&attributes, type);
+	psa_set_key_bits(&attributes, bits);
+	psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_EXPORT);
+	status = psa_generate_key(&attributes, &key);
+	psa_reset_key_attributes(&attributes);
+	return status;
+}
+
+/**
+    @brief    - Creates a key of the type and size of the attributes from the
+                key fixture of that type and size, generating the fixture the
+                first time. The key gets the policy and lifetime of the
+                attributes and is tracked like an imported key. The exported
+                fixture is cleared once imported and the fixture purged from
+                the key slots. Without persistent key support or a free
+                fixture ID, the key is generated.
+    @param    - Arguments of psa_generate_key
+    @return   - error status
+**/
+static psa_status_t pal_crypto_fixture_key(const psa_key_attributes_t *attributes,
+										   psa_key_id_t *key)
+{
+	psa_key_type_t type = psa_get_key_type(attributes);
+	size_t         bits = psa_get_key_bits(attributes);
+	psa_key_id_t   fixture, free_id;
+	psa_status_t   status;
+	size_t         length;
+	uint32_t       attempt;
+
+	for (attempt = 0; attempt < 2; attempt++) {
+		if (pal_key_fixture_find(type, bits, &fixture, &free_id) == PSA_SUCCESS) {
+			status = psa_export_key(fixture, g_key_fixture_data,
+									sizeof(g_key_fixture_data), &length);
+			/* The fixture stays in storage only, its slot is not a leak of the test */
+			psa_purge_key(fixture);
+			/* Do not leave the private key in memory for the rest of the run */
+			if (status == PSA_SUCCESS) {
+				status = pal_crypto_import_key(attributes, g_key_fixture_data, length, key);
+				memset(g_key_fixture_data, 0, length);
+				return status;
+			}
+			memset(g_key_fixture_data, 0, sizeof(g_key_fixture_data));
 			break;
-		case PAL_CRYPTO_HASH_FINISH:
-			hash_operation           = va_arg(valist, psa_hash_operation_t *);
-			output                   = va_arg(valist, uint8_t *);
-			output_size              = va_arg(valist, size_t);
-			p_output_length          = va_arg(valist, size_t *);
-			return psa_hash_finish(hash_operation,
-								   output,
-								   output_size,
-								   p_output_length);
+		}
+
+		if (free_id == 0)
 			break;
-		case PAL_CRYPTO_HASH_OPERATION_INIT:
-			hash_operation           = va_arg(valist, psa_hash_operation_t *);
-			hash_operation_temp      = psa_hash_operation_init();
-			memcpy((void *)hash_operation, (void *)&hash_operation_temp,
-				   sizeof(psa_hash_operation_t));
-			return 0;
+
+		/* A concurrent test process may have created the fixture first */
+		status = pal_key_fixture_create(type, bits, free_id);
+		if (status != PSA_SUCCESS && status != PSA_ERROR_ALREADY_EXISTS)
 			break;
-		case PAL_CRYPTO_HASH_RESUME:
-#ifdef ARCH_TEST_HASH_RESUME
-			hash_operation           = va_arg(valist, psa_hash_operation_t *);
-			input                    = va_arg(valist, const uint8_t *);
-			input_length             = va_arg(valist, size_t);
-			return psa_hash_resume(hash_operation,
-								   input,
-								   input_length);
+	}
+
+	return pal_crypto_generate_key(attributes, key);
+}
+
+/**
+    @brief    - Destroys the tracked keys, at the end of each test. Keys which
+                cannot be destroyed stay tracked, to be reported by
+                pal_crypto_live_key_count.
+    @param    - void
+    @return   - error status
+**/
+static int32_t pal_crypto_free_keys(void)
+{
+	psa_key_id_t key;
+	uint32_t     i = 0;
+
+	while (i < PAL_KEY_TRACK_SLOTS) {
+		key = g_key_track[i];
+		/* A removal may shift another entry into slot i, check it again */
+		if (key != (psa_key_id_t)0 &&
+			(psa_destroy_key(key) == PSA_SUCCESS || !pal_key_is_live(key)))
+			pal_key_track_remove(key);
+		else
+			i++;
+	}
+
+	return 0;
+}
+
+/**
+    @brief    - Resets the system, for the tests checking persistent keys
+    @param    - void
+    @return   - error status
+**/
+static int32_t pal_crypto_reset(void)
+{
+	return pal_system_reset();
+}
+
+const pal_crypto_api_t pal_crypto_api = {
+	.crypto_init                   = psa_crypto_init,
+	.key_attributes_init           = psa_key_attributes_init,
+	.set_key_id                    = psa_set_key_id,
+	.get_key_id                    = psa_get_key_id,
+	.set_key_lifetime              = psa_set_key_lifetime,
+	.get_key_lifetime              = psa_get_key_lifetime,
+	.set_key_usage_flags           = psa_set_key_usage_flags,
+	.get_key_usage_flags           = psa_get_key_usage_flags,
+	.set_key_algorithm             = psa_set_key_algorithm,
+	.get_key_algorithm             = psa_get_key_algorithm,
+	.set_key_type                  = psa_set_key_type,
+	.get_key_type                  = psa_get_key_type,
+	.set_key_bits                  = psa_set_key_bits,
+	.get_key_bits                  = psa_get_key_bits,
+	.get_key_attributes            = psa_get_key_attributes,
+	.reset_key_attributes          = psa_reset_key_attributes,
+	.import_key                    = pal_crypto_import_key,
+	.generate_key                  = pal_crypto_generate_key,
+	.copy_key                      = pal_crypto_copy_key,
+	.destroy_key                   = pal_crypto_destroy_key,
+	.purge_key                     = psa_purge_key,
+	.export_key                    = psa_export_key,
+	.export_public_key             = psa_export_public_key,
+	.hash_compute                  = psa_hash_compute,
+	.hash_compare                  = psa_hash_compare,
+	.hash_operation_init           = psa_hash_operation_init,
+	.hash_setup                    = psa_hash_setup,
+	.hash_update                   = psa_hash_update,
+	.hash_finish                   = psa_hash_finish,
+	.hash_verify                   = psa_hash_verify,
+	.hash_abort                    = psa_hash_abort,
+	.hash_clone                    = psa_hash_clone,
+#ifdef ARCH_TEST_HASH_SUSPEND
+	.hash_suspend                  = psa_hash_suspend,
 #else
-			return PAL_STATUS_UNSUPPORTED_FUNC;
+	.hash_suspend                  = pal_crypto_hash_suspend,
 #endif
-			break;
-		case PAL_CRYPTO_HASH_SUSPEND:
-#ifdef ARCH_TEST_HASH_SUSPEND
-			hash_operation           = va_arg(valist, psa_hash_operation_t *);
-			output                   = va_arg(valist, uint8_t *);
-			output_size              = va_arg(valist, size_t);
-			p_output_length          = va_arg(valist, size_t *);
-			return psa_hash_suspend(hash_operation,
-									output,
-									output_size,
-									p_output_length);
+#ifdef ARCH_TEST_HASH_RESUME
+	.hash_resume                   = psa_hash_resume,
 #else
-			return PAL_STATUS_UNSUPPORTED_FUNC;
+	.hash_resume                   = pal_crypto_hash_resume,
 #endif
-			break;
-		case PAL_CRYPTO_HASH_SETUP:
-			hash_operation           = va_arg(valist, psa_hash_operation_t *);
-			alg                      = va_arg(valist, psa_algorithm_t);
-			return psa_hash_setup(hash_operation,
-								  alg);
-			break;
-		case PAL_CRYPTO_HASH_UPDATE:
-			hash_operation           = va_arg(valist, psa_hash_operation_t *);
-			input                    = va_arg(valist, const uint8_t *);
-			input_length             = va_arg(valist, size_t);
-			return psa_hash_update(hash_operation,
-								   input,
-								   input_length);
-			break;
-		case PAL_CRYPTO_HASH_VERIFY:
-			hash_operation           = va_arg(valist, psa_hash_operation_t *);
-			input                    = va_arg(valist, const uint8_t *);
-			input_length             = va_arg(valist, size_t);
-			return psa_hash_verify(hash_operation,
-								   input,
-								   input_length);
-			break;
-		case PAL_CRYPTO_IMPORT_KEY:
-			c_attributes             = va_arg(valist, const psa_key_attributes_t *);
-			input                    = va_arg(valist, const uint8_t *);
-			input_length             = va_arg(valist, size_t);
-			p_key                    = va_arg(valist, psa_key_id_t *);
-			status = psa_import_key(c_attributes,
-								  input,
-								  input_length,
-								  p_key);
-			g_global_key_array[g_key_count++] = *p_key;
-			return status;
-			break;
-		case PAL_CRYPTO_KEY_ATTRIBUTES_INIT:
-			attributes               = va_arg(valist, psa_key_attributes_t *);
-			attributes_temp          = psa_key_attributes_init();
-			memcpy((void *)attributes, (void *)&attributes_temp,\
-								sizeof(psa_key_attributes_t));
-			return 0;
-			break;
-		case PAL_CRYPTO_KEY_DERIVATION_ABORT:
-			derivation_operation     = va_arg(valist, psa_key_derivation_operation_t *);
-			return psa_key_derivation_abort(derivation_operation);
-			break;
-		case PAL_CRYPTO_KEY_DERIVATION_GET_CAPACITY:
-                	c_derivation_operation   = va_arg(valist,
-	                                                 const psa_key_derivation_operation_t *);
-			p_output_length          = va_arg(valist, size_t *);
-			return psa_key_derivation_get_capacity(c_derivation_operation,\
-		        p_output_length);
-			break;
-		case PAL_CRYPTO_KEY_DERIVATION_INPUT_BYTES:
-			derivation_operation     = va_arg(valist, psa_key_derivation_operation_t *);
-			step                     = (psa_key_derivation_step_t)va_arg(valist, int);
-			input                    = va_arg(valist, const uint8_t *);
-			input_length             = va_arg(valist, size_t);
-			return psa_key_derivation_input_bytes(derivation_operation,
-		        step, input, input_length);
-			break;
-        case PAL_CRYPTO_KEY_DERIVATION_INPUT_INTEGER:
+	.mac_compute                   = psa_mac_compute,
+	.mac_verify                    = psa_mac_verify,
+	.mac_operation_init            = psa_mac_operation_init,
+	.mac_sign_setup                = psa_mac_sign_setup,
+	.mac_verify_setup              = psa_mac_verify_setup,
+	.mac_update                    = psa_mac_update,
+	.mac_sign_finish               = psa_mac_sign_finish,
+	.mac_verify_finish             = psa_mac_verify_finish,
+	.mac_abort                     = psa_mac_abort,
+	.cipher_encrypt                = psa_cipher_encrypt,
+	.cipher_decrypt                = psa_cipher_decrypt,
+	.cipher_operation_init         = psa_cipher_operation_init,
+	.cipher_encrypt_setup          = psa_cipher_encrypt_setup,
+	.cipher_decrypt_setup          = psa_cipher_decrypt_setup,
+	.cipher_generate_iv            = psa_cipher_generate_iv,
+	.cipher_set_iv                 = psa_cipher_set_iv,
+	.cipher_update                 = psa_cipher_update,
+	.cipher_finish                 = psa_cipher_finish,
+	.cipher_abort                  = psa_cipher_abort,
+	.aead_encrypt                  = psa_aead_encrypt,
+	.aead_decrypt                  = psa_aead_decrypt,
+	.aead_operation_init           = psa_aead_operation_init,
+	.aead_encrypt_setup            = psa_aead_encrypt_setup,
+	.aead_decrypt_setup            = psa_aead_decrypt_setup,
+	.aead_generate_nonce           = psa_aead_generate_nonce,
+	.aead_set_nonce                = psa_aead_set_nonce,
+	.aead_set_lengths              = psa_aead_set_lengths,
+	.aead_update_ad                = psa_aead_update_ad,
+	.aead_update                   = psa_aead_update,
+	.aead_finish                   = psa_aead_finish,
+	.aead_verify                   = psa_aead_verify,
+	.aead_abort                    = psa_aead_abort,
+	.sign_message                  = psa_sign_message,
+	.verify_message                = psa_verify_message,
+	.sign_hash                     = psa_sign_hash,
+	.verify_hash                   = psa_verify_hash,
+	.asymmetric_encrypt            = psa_asymmetric_encrypt,
+	.asymmetric_decrypt            = psa_asymmetric_decrypt,
+	.key_derivation_operation_init = psa_key_derivation_operation_init,
+	.key_derivation_setup          = psa_key_derivation_setup,
+	.key_derivation_get_capacity   = psa_key_derivation_get_capacity,
+	.key_derivation_set_capacity   = psa_key_derivation_set_capacity,
+	.key_derivation_input_bytes    = psa_key_derivation_input_bytes,
 #ifdef ARCH_TEST_PBKDF2
-            derivation_operation     = va_arg(valist, psa_key_derivation_operation_t *);
-            step                     = (psa_key_derivation_step_t)va_arg(valist, int);
-            input_value              = va_arg(valist, uint64_t);
-            return psa_key_derivation_input_integer(derivation_operation,
-                step, input_value);
+	.key_derivation_input_integer  = psa_key_derivation_input_integer,
 #else
-			return PAL_STATUS_UNSUPPORTED_FUNC;
+	.key_derivation_input_integer  = pal_crypto_key_derivation_input_integer,
 #endif
-            break;
-		case PAL_CRYPTO_KEY_DERIVATION_INPUT_KEY:
-			derivation_operation     = va_arg(valist, psa_key_derivation_operation_t *);
-			step                     = (psa_key_derivation_step_t)va_arg(valist, int);
-			key                      = va_arg(valist, psa_key_id_t);
-			return psa_key_derivation_input_key(derivation_operation,
-		        step, key);
-			break;
-		case PAL_CRYPTO_KEY_DERIVATION_KEY_AGREEMENT:
-			derivation_operation     = va_arg(valist, psa_key_derivation_operation_t *);
-			step                     = (psa_key_derivation_step_t)va_arg(valist, int);
-			key                      = va_arg(valist, psa_key_id_t);
-			input                    = va_arg(valist, const uint8_t *);
-			input_length             = va_arg(valist, size_t);
-			return psa_key_derivation_key_agreement(derivation_operation,
-			step, key, input, input_length);
-			break;
-		case PAL_CRYPTO_KEY_DERIVATION_OPERATION_INIT:
-			derivation_operation     = va_arg(valist, psa_key_derivation_operation_t *);
-			derivation_operation_temp = psa_key_derivation_operation_init();
-			memcpy((void *)derivation_operation, (void *)&derivation_operation_temp,
-				   sizeof(psa_key_derivation_operation_t));
-			return 0;
-			break;
-		case PAL_CRYPTO_KEY_DERIVATION_OUTPUT_BYTES:
-	                derivation_operation     = va_arg(valist, psa_key_derivation_operation_t *);
-                        output                   = va_arg(valist, uint8_t *);
-			output_length            = va_arg(valist, size_t);
-			return psa_key_derivation_output_bytes(derivation_operation,
-		        output, output_length);
-			break;
-		case PAL_CRYPTO_KEY_DERIVATION_OUTPUT_KEY:
-			c_attributes             = va_arg(valist, const psa_key_attributes_t *);
-			derivation_operation     = va_arg(valist, psa_key_derivation_operation_t *);
-			p_key                    = va_arg(valist, psa_key_id_t *);
-			return psa_key_derivation_output_key(c_attributes,
-		        derivation_operation, p_key);
-			break;
+	.key_derivation_input_key      = psa_key_derivation_input_key,
+	.key_derivation_key_agreement  = psa_key_derivation_key_agreement,
+	.key_derivation_output_bytes   = psa_key_derivation_output_bytes,
+	.key_derivation_output_key     = pal_crypto_key_derivation_output_key,
 #ifdef CRYPTO_1_1_0
-        case PAL_CRYPTO_KEY_DERIVATION_VERIFY_BYTES:
-			derivation_operation     = va_arg(valist, psa_key_derivation_operation_t *);
-            expected_output          = va_arg(valist, const uint8_t *);
-            output_length            = va_arg(valist, size_t);
-            return psa_key_derivation_verify_bytes(derivation_operation,
-                expected_output, output_length);
-            break;
-        case PAL_CRYPTO_KEY_DERIVATION_VERIFY_KEY:
-			derivation_operation     = va_arg(valist, psa_key_derivation_operation_t *);
-            key                      = va_arg(valist, psa_key_id_t);
-            return psa_key_derivation_verify_key(derivation_operation,
-                key);
-            break;
+	.key_derivation_verify_bytes   = psa_key_derivation_verify_bytes,
+	.key_derivation_verify_key     = psa_key_derivation_verify_key,
+#else
+	.key_derivation_verify_bytes   = pal_crypto_key_derivation_verify_bytes,
+	.key_derivation_verify_key     = pal_crypto_key_derivation_verify_key,
 #endif
-		case PAL_CRYPTO_KEY_DERIVATION_SET_CAPACITY:
-			derivation_operation     = va_arg(valist, psa_key_derivation_operation_t *);
-		        input_length             = va_arg(valist, size_t);
-			return psa_key_derivation_set_capacity(derivation_operation, input_length);
-			break;
-		case PAL_CRYPTO_KEY_DERIVATION_SETUP:
-			derivation_operation     = va_arg(valist, psa_key_derivation_operation_t *);
-			alg                      = va_arg(valist, psa_algorithm_t);
-			return psa_key_derivation_setup(derivation_operation,
-											alg);
-			break;
-		case PAL_CRYPTO_MAC_ABORT:
-			mac_operation            = va_arg(valist, psa_mac_operation_t *);
-			return psa_mac_abort(mac_operation);
-			break;
-		case PAL_CRYPTO_MAC_COMPUTE:
-			key                      = va_arg(valist, psa_key_id_t);
-			alg                      = va_arg(valist, psa_algorithm_t);
-			input                    = va_arg(valist, const uint8_t *);
-			input_length             = va_arg(valist, size_t);
-			output                   = va_arg(valist, uint8_t *);
-			output_size              = va_arg(valist, size_t);
-			p_output_length          = va_arg(valist, size_t *);
-			return psa_mac_compute(key,
-								   alg,
-								   input,
-								   input_length,
-								   output,
-								   output_size,
-								   p_output_length);
-			break;
-		case PAL_CRYPTO_MAC_OPERATION_INIT:
-			mac_operation            = va_arg(valist, psa_mac_operation_t *);
-			mac_operation_temp       = psa_mac_operation_init();
-			memcpy((void *)mac_operation, (void *)&mac_operation_temp, \
-					sizeof(psa_mac_operation_t));
-			return 0;
-			break;
-		case PAL_CRYPTO_MAC_SIGN_FINISH:
-			mac_operation            = va_arg(valist, psa_mac_operation_t *);
-			output                   = va_arg(valist, uint8_t *);
-			output_size              = va_arg(valist, size_t);
-			p_output_length          = va_arg(valist, size_t *);
-			return psa_mac_sign_finish(mac_operation,
-									   output,
-									   output_size,
-									   p_output_length);
-			break;
-		case PAL_CRYPTO_MAC_SIGN_SETUP:
-			mac_operation            = va_arg(valist, psa_mac_operation_t *);
-			key                      = va_arg(valist, psa_key_id_t);
-			alg                      = va_arg(valist, psa_algorithm_t);
-			return psa_mac_sign_setup(mac_operation,
-									  key,
-									  alg);
-			break;
-		case PAL_CRYPTO_MAC_UPDATE:
-			mac_operation            = va_arg(valist, psa_mac_operation_t *);
-			input                    = va_arg(valist, uint8_t *);
-			input_length             = va_arg(valist, size_t);
-			return psa_mac_update(mac_operation,
-								  input,
-								  input_length);
-			break;
-		case PAL_CRYPTO_MAC_VERIFY:
-			key                      = va_arg(valist, psa_key_id_t);
-			alg                      = va_arg(valist, psa_algorithm_t);
-			input                    = va_arg(valist, const uint8_t *);
-			input_length             = va_arg(valist, size_t);
-			input1                   = va_arg(valist, const uint8_t *);
-			input_length1            = va_arg(valist, size_t);
-			return psa_mac_verify(key,
-								  alg,
-								  input,
-								  input_length,
-								  input1,
-								  input_length1);
-			break;
-		case PAL_CRYPTO_MAC_VERIFY_FINISH:
-			mac_operation            = va_arg(valist, psa_mac_operation_t *);
-			input                    = va_arg(valist, const uint8_t *);
-			input_length             = va_arg(valist, size_t);
-			return psa_mac_verify_finish(mac_operation,
-										 input,
-										 input_length);
-			break;
-		case PAL_CRYPTO_MAC_VERIFY_SETUP:
-			mac_operation            = va_arg(valist, psa_mac_operation_t *);
-			key                      = va_arg(valist, psa_key_id_t);
-			alg                      = va_arg(valist, psa_algorithm_t);
-			return psa_mac_verify_setup(mac_operation,
-										key,
-										alg);
-			break;
-		case PAL_CRYPTO_PURGE_KEY:
-			key                      = va_arg(valist, psa_key_id_t);
-			return psa_purge_key(key);
-			break;
-		case PAL_CRYPTO_RAW_KEY_AGREEMENT:
-			alg                      = va_arg(valist, psa_algorithm_t);
-			key                      = va_arg(valist, psa_key_id_t);
-			input                    = va_arg(valist, const uint8_t *);
-			input_length             = va_arg(valist, size_t);
-			output                   = va_arg(valist, uint8_t *);
-			output_size              = va_arg(valist, size_t);
-			p_output_length          = va_arg(valist, size_t *);
-			return psa_raw_key_agreement(alg,
-										 key,
-										 input,
-										 input_length,
-										 output,
-										 output_size,
-										 p_output_length);
-			break;
-		case PAL_CRYPTO_RESET_KEY_ATTRIBUTES:
-			attributes               = va_arg(valist, psa_key_attributes_t *);
-			psa_reset_key_attributes(attributes);
-			return 0;
-			break;
-		case PAL_CRYPTO_SET_KEY_ALGORITHM:
-			attributes               = va_arg(valist, psa_key_attributes_t *);
-			alg                      = va_arg(valist, psa_algorithm_t);
-			psa_set_key_algorithm(attributes,
-								  alg);
-			return 0;
-			break;
-		case PAL_CRYPTO_SET_KEY_BITS:
-			attributes               = va_arg(valist, psa_key_attributes_t *);
-			bits                     = va_arg(valist, size_t);
-			psa_set_key_bits(attributes,
-							 bits);
-			return 0;
-			break;
-		case PAL_CRYPTO_SET_KEY_ID:
-			attributes               = va_arg(valist, psa_key_attributes_t *);
-			id                       = va_arg(valist, psa_key_id_t);
-			psa_set_key_id(attributes,
-						   id);
-			return 0;
-			break;
-		case PAL_CRYPTO_SET_KEY_LIFETIME:
-			attributes               = va_arg(valist, psa_key_attributes_t *);
-			lifetime                 = va_arg(valist, psa_key_lifetime_t);
-			psa_set_key_lifetime(attributes,
-								 lifetime);
-			return 0;
-			break;
-		case PAL_CRYPTO_SET_KEY_TYPE:
-			attributes               = va_arg(valist, psa_key_attributes_t *);
-			type                     = (psa_key_type_t)va_arg(valist, int);
-			psa_set_key_type(attributes,
-							 type);
-			return 0;
-			break;
-		case PAL_CRYPTO_SET_KEY_USAGE_FLAGS:
-			attributes               = va_arg(valist, psa_key_attributes_t *);
-			usage_flags              = va_arg(valist, psa_key_usage_t);
-			psa_set_key_usage_flags(attributes,
-									usage_flags);
-			return 0;
-			break;
-		case PAL_CRYPTO_SIGN_HASH:
-			key                      = va_arg(valist, psa_key_id_t);
-			alg                      = va_arg(valist, psa_algorithm_t);
-			input                    = va_arg(valist, const uint8_t *);
-			input_length             = va_arg(valist, size_t);
-			output                   = va_arg(valist, uint8_t *);
-			output_size              = va_arg(valist, size_t);
-			p_output_length          = va_arg(valist, size_t *);
-			return psa_sign_hash(key,
-								 alg,
-								 input,
-								 input_length,
-								 output,
-								 output_size,
-								 p_output_length);
-			break;
-		case PAL_CRYPTO_SIGN_MESSAGE:
-			key                      = va_arg(valist, psa_key_id_t);
-			alg                      = va_arg(valist, psa_algorithm_t);
-			input                    = va_arg(valist, const uint8_t *);
-			input_length             = va_arg(valist, size_t);
-			output                   = va_arg(valist, uint8_t *);
-			output_size              = va_arg(valist, size_t);
-			p_output_length          = va_arg(valist, size_t *);
-			return psa_sign_message(key,
-									alg,
-									input,
-									input_length,
-									output,
-									output_size,
-									p_output_length);
-			break;
-		case PAL_CRYPTO_VERIFY_MESSAGE:
-			key                      = va_arg(valist, psa_key_id_t);
-			alg                      = va_arg(valist, psa_algorithm_t);
-			input                    = va_arg(valist, const uint8_t *);
-			input_length             = va_arg(valist, size_t);
-			input1                   = va_arg(valist, const uint8_t *);
-			input_length1            = va_arg(valist, size_t);
-			return psa_verify_message(key,
-									  alg,
-									  input,
-									  input_length,
-									  input1,
-									  input_length1);
-			break;
-		case PAL_CRYPTO_VERIFY_HASH:
-			key                      = va_arg(valist, psa_key_id_t);
-			alg                      = va_arg(valist, psa_algorithm_t);
-			input                    = va_arg(valist, const uint8_t *);
-			input_length             = va_arg(valist, size_t);
-			input1                   = va_arg(valist, const uint8_t *);
-			input_length1            = va_arg(valist, size_t);
-			return psa_verify_hash(key,
-								   alg,
-								   input,
-								   input_length,
-								   input1,
-								   input_length1);
-			break;
-		case PAL_CRYPTO_RESET:
-			return pal_system_reset();
-			break;
-		case PAL_CRYPTO_FREE:
-			for (int i = 0; i < g_key_count; i++) {
-				psa_destroy_key(g_global_key_array[i]);
-				g_global_key_array[i] = (psa_key_id_t)0;
-			}
-			g_key_count = 0;
-			return 0;
-			break;
-		default:
-			return PAL_STATUS_UNSUPPORTED_FUNC;
-    }
-}
+	.key_derivation_abort          = psa_key_derivation_abort,
+	.raw_key_agreement             = psa_raw_key_agreement,
+	.generate_random               = psa_generate_random,
+	.free_keys                     = pal_crypto_free_keys,
+	.reset                         = pal_crypto_reset,
+	.live_key_count                = pal_crypto_live_key_count,
+	.key_track_overflow            = pal_crypto_key_track_overflow,
+	.free_key_slots                = pal_crypto_free_key_slots,
+	.fixture_key                   = pal_crypto_fixture_key,
+};
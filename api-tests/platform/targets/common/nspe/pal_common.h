@@ -82,6 +82,41 @@ typedef enum {
     UART_PRINT            = 0x2,
 } uart_fn_type_t;
 
+/* Formats of the machine readable result records */
+typedef enum {
+    PAL_RESULT_FORMAT_NONE    = 0x0,
+    PAL_RESULT_FORMAT_JSONL   = 0x1,
+    PAL_RESULT_FORMAT_JUNIT   = 0x2,
+} pal_result_format_t;
+
+/* Scopes of the test repetition */
+typedef enum {
+    PAL_TEST_REPEAT_TEST      = 0x0,  /* each test is repeated before the next one */
+    PAL_TEST_REPEAT_LIST      = 0x1,  /* the whole test list is repeated */
+} pal_test_repeat_scope_t;
+
+/* Test repetition (soak) settings. The repetition stops when the first of the
+ * given bounds is reached, a zero bound is not used. */
+typedef struct {
+    uint32_t iterations;  /* Number of iterations */
+    uint32_t duration_s;  /* Duration in seconds, an iteration is never cut short */
+    uint32_t scope;       /* pal_test_repeat_scope_t */
+} pal_test_repeat_t;
+
+/* Callbacks used by the platform to execute tests in isolated contexts */
+typedef struct {
+    /* Brings the shared state to a clean baseline once, before any test context is
+     * created from it. Optional, returns zero on success */
+    int32_t  (*prepare)(void);
+    /* Runs the given test inside the isolated context, returns the test state */
+    uint32_t (*run)(test_id_t test_id);
+    /* Reports a test whose isolated context terminated abnormally, returns the test state */
+    uint32_t (*abort)(test_id_t test_id);
+} pal_test_ops_t;
+
+/* Function run by each thread of pal_thread_run, index goes from 0 to count - 1 */
+typedef void (*pal_thread_fn_t)(void *arg, uint32_t index);
+
 /*
  * Redefining some of the client.h elements for compilation to go through
  * when PSA IPC APIs are not implemented.
@@ -0,0 +1,618 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include <stdio.h>
+
+#include "pal_common.h"
+#include "pal_test_filter.h"
+
+/* Test selections are compiled into bitmaps indexed by test ID when they are set,
+ * so that pal_is_test_enabled() is a constant time lookup.
+ */
+
+/* Same layout as VAL_CREATE_TEST_ID(): component * 200 + test number. Test names
+ * use the component letter in place of the component number, e.g. c001 is 201.
+ */
+#define PAL_TESTS_PER_COMP       200
+#define PAL_COMP_LETTERS         "icsab"
+
+#define PAL_TEST_FILTER_WORDS    ((PAL_TEST_FILTER_MAX_ID / 32) + 1)
+#define PAL_TEST_ITEM_SIZE       64
+#define PAL_TEST_NAME_PREFIX     "test_"
+#define PAL_TEST_SEPARATORS      ",; \t\r\n"
+#define PAL_RECORD_LINE_SIZE     1024
+
+/* Largest shard count accepted on the command line, the dispatcher has its own limit */
+#define PAL_TEST_SHARD_MAX       0xFFFF
+
+static uint32_t g_included_tests[PAL_TEST_FILTER_WORDS];
+static uint32_t g_excluded_tests[PAL_TEST_FILTER_WORDS];
+static uint8_t  g_include_given;
+
+/* Tests which did not pass in a previous run, intersected with the included
+ * tests whatever the order of the selections is
+ */
+static uint32_t g_failed_tests[PAL_TEST_FILTER_WORDS];
+static uint8_t  g_failed_given;
+
+static uint32_t g_test_shard;
+static uint32_t g_test_shard_count;
+static uint32_t g_test_weights[PAL_TEST_FILTER_MAX_ID + 1];
+
+static pal_test_repeat_t g_test_repeat;
+
+static void pal_filter_set(uint32_t *bitmap, uint32_t test_id)
+{
+    bitmap[test_id / 32] |= (uint32_t)1 << (test_id % 32);
+}
+
+static int pal_filter_get(const uint32_t *bitmap, uint32_t test_id)
+{
+    return (bitmap[test_id / 32] >> (test_id % 32)) & 1;
+}
+
+/**
+    @brief    - Removes the optional test name prefix of a selection item
+    @param    - item : Selection item, updated
+    @return   - void
+**/
+static void pal_skip_name_prefix(const char **item)
+{
+    if (!strncmp(*item, PAL_TEST_NAME_PREFIX, strlen(PAL_TEST_NAME_PREFIX)))
+        *item += strlen(PAL_TEST_NAME_PREFIX);
+}
+
+/**
+    @brief    - Parses a test ID given either as a number or as a test name
+    @param    - str     : Test ID string, not NUL terminated
+                len     : Length of str
+                test_id : Returns the test ID
+    @return   - 0 on success, -1 on malformed test ID
+**/
+static int pal_parse_test_id(const char *str, size_t len, uint32_t *test_id)
+{
+    const char *comp = NULL;
+    uint32_t    num = 0;
+    size_t      i = 0;
+
+    if (len > strlen(PAL_TEST_NAME_PREFIX) &&
+        !strncmp(str, PAL_TEST_NAME_PREFIX, strlen(PAL_TEST_NAME_PREFIX)))
+    {
+        str += strlen(PAL_TEST_NAME_PREFIX);
+        len -= strlen(PAL_TEST_NAME_PREFIX);
+    }
+
+    if (len > 0 && str[0] != '\0')
+    {
+        comp = strchr(PAL_COMP_LETTERS, str[0]);
+        if (comp)
+            i = 1;
+    }
+
+    if (i == len)
+        return -1;
+
+    for (; i < len; i++)
+    {
+        if (str[i] < '0' || str[i] > '9')
+            return -1;
+
+        num = (num * 10) + (uint32_t)(str[i] - '0');
+        if (num > PAL_TEST_FILTER_MAX_ID)
+            return -1;
+    }
+
+    if (comp)
+    {
+        if (num >= PAL_TESTS_PER_COMP)
+            return -1;
+        num += (uint32_t)(comp - PAL_COMP_LETTERS) * PAL_TESTS_PER_COMP;
+    }
+
+    if (num > PAL_TEST_FILTER_MAX_ID)
+        return -1;
+
+    *test_id = num;
+    return 0;
+}
+
+/**
+    @brief    - Matches a string against a glob pattern supporting '*' and '?'
+    @param    - pattern : Glob pattern
+                str     : String to be matched
+    @return   - 1 if the string matches, 0 otherwise
+**/
+static int pal_glob_match(const char *pattern, const char *str)
+{
+    const char *star = NULL;
+    const char *retry = NULL;
+
+    while (*str)
+    {
+        if (*pattern == '*')
+        {
+            star = pattern++;
+            retry = str;
+        }
+        else if (*pattern == '?' || *pattern == *str)
+        {
+            pattern++;
+            str++;
+        }
+        else if (star)
+        {
+            pattern = star + 1;
+            str = ++retry;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
+    while (*pattern == '*')
+        pattern++;
+
+    return (*pattern == '\0');
+}
+
+/**
+    @brief    - Adds one selection item to the test filter
+    @param    - item : Selection item, NUL terminated
+    @return   - 0 on success, -1 if the item is malformed
+**/
+static int pal_add_filter_item(const char *item)
+{
+    uint32_t   *bitmap = g_included_tests;
+    uint32_t    first, last, test_id;
+    const char *dash;
+    char        name[16];
+
+    if (item[0] == '!')
+    {
+        bitmap = g_excluded_tests;
+        item++;
+    }
+    else
+    {
+        g_include_given = 1;
+    }
+
+    if (item[0] == '\0')
+        return -1;
+
+    if (strchr(item, '*') || strchr(item, '?'))
+    {
+        pal_skip_name_prefix(&item);
+        for (test_id = 0; test_id <= PAL_TEST_FILTER_MAX_ID; test_id++)
+        {
+            snprintf(name, sizeof(name), "%u", test_id);
+            if (pal_glob_match(item, name))
+            {
+                pal_filter_set(bitmap, test_id);
+                continue;
+            }
+
+            if ((test_id / PAL_TESTS_PER_COMP) < strlen(PAL_COMP_LETTERS))
+            {
+                snprintf(name, sizeof(name), "%c%03u",
+                         PAL_COMP_LETTERS[test_id / PAL_TESTS_PER_COMP],
+                         test_id % PAL_TESTS_PER_COMP);
+                if (pal_glob_match(item, name))
+                    pal_filter_set(bitmap, test_id);
+            }
+        }
+        return 0;
+    }
+
+    dash = strchr(item, '-');
+    if (dash)
+    {
+        if (pal_parse_test_id(item, (size_t)(dash - item), &first) ||
+            pal_parse_test_id(dash + 1, strlen(dash + 1), &last) ||
+            first > last)
+            return -1;
+    }
+    else
+    {
+        if (pal_parse_test_id(item, strlen(item), &first))
+            return -1;
+        last = first;
+    }
+
+    for (test_id = first; test_id <= last; test_id++)
+        pal_filter_set(bitmap, test_id);
+
+    return 0;
+}
+
+/**
+    @brief    - Adds a test selection to the test filter.
+    @param    - selection : Test selection string
+    @return   - 0 on success, -1 if the selection is malformed
+**/
+int pal_add_test_filter(const char *selection)
+{
+    char    item[PAL_TEST_ITEM_SIZE];
+    size_t  len;
+    int     status = 0;
+
+    while (*selection)
+    {
+        selection += strspn(selection, PAL_TEST_SEPARATORS);
+        len = strcspn(selection, PAL_TEST_SEPARATORS);
+        if (len == 0)
+            break;
+
+        if (len >= sizeof(item))
+        {
+            status = -1;
+        }
+        else
+        {
+            memcpy(item, selection, len);
+            item[len] = '\0';
+            if (pal_add_filter_item(item))
+                status = -1;
+        }
+        selection += len;
+    }
+
+    return status;
+}
+
+/**
+ *   @brief    - Sets the custom test list buffer. The list replaces any previous
+ *               test selection, a NULL list enables all tests.
+ *   @param    - custom_test_list : Custom test list buffer
+     @return   - void
+**/
+void pal_set_custom_test_list(char *custom_test_list)
+{
+    memset(g_included_tests, 0, sizeof(g_included_tests));
+    memset(g_excluded_tests, 0, sizeof(g_excluded_tests));
+    memset(g_failed_tests, 0, sizeof(g_failed_tests));
+    g_include_given = 0;
+    g_failed_given = 0;
+
+    if (!custom_test_list)
+        return;
+
+    /* An empty list enables no test */
+    g_include_given = 1;
+    pal_add_test_filter(custom_test_list);
+}
+
+/**
+ *   @brief    - Tells if a test is enabled on platform
+ *   @param    - test_id : Test ID
+ *   @return   - TRUE/FALSE
+**/
+bool_t pal_is_test_enabled(test_id_t test_id)
+{
+    if (test_id > PAL_TEST_FILTER_MAX_ID)
+        return (g_include_given || g_failed_given) ? 0 : 1;
+
+    if (g_include_given && !pal_filter_get(g_included_tests, test_id))
+        return 0;
+
+    if (g_failed_given && !pal_filter_get(g_failed_tests, test_id))
+        return 0;
+
+    return pal_filter_get(g_excluded_tests, test_id) ? 0 : 1;
+}
+
+/**
+    @brief    - Parses an unsigned decimal number
+    @param    - str   : Number string, updated to the first character after it
+                value : Returns the number
+                max   : Largest accepted value
+    @return   - 0 on success, -1 on malformed or too large number
+**/
+static int pal_parse_uint(const char **str, uint32_t *value, uint32_t max)
+{
+    const char *p = *str;
+    uint32_t    num = 0;
+
+    if (*p < '0' || *p > '9')
+        return -1;
+
+    for (; *p >= '0' && *p <= '9'; p++)
+    {
+        if (num > (max - (uint32_t)(*p - '0')) / 10)
+            return -1;
+        num = (num * 10) + (uint32_t)(*p - '0');
+    }
+
+    *str = p;
+    *value = num;
+    return 0;
+}
+
+/**
+    @brief    - Selects the shard of the enabled tests to be executed.
+    @param    - spec : K/N, the K-th of N shards with K from 1 to N
+    @return   - 0 on success, -1 if the shard is malformed
+**/
+int pal_set_test_shard(const char *spec)
+{
+    uint32_t shard, count;
+
+    if (pal_parse_uint(&spec, &shard, PAL_TEST_SHARD_MAX) || *spec++ != '/' ||
+        pal_parse_uint(&spec, &count, PAL_TEST_SHARD_MAX) || *spec != '\0' ||
+        shard == 0 || shard > count)
+        return -1;
+
+    g_test_shard = shard - 1;
+    g_test_shard_count = count;
+    return 0;
+}
+
+/**
+    @brief    - Finds the number value following a key in a record line
+    @param    - line  : Record line
+                key   : Key including its delimiters, e.g. "\"test_id\":"
+                value : Returns the value
+    @return   - 0 on success, -1 if the key is missing or its value is not a number
+**/
+static int pal_find_uint(const char *line, const char *key, uint32_t *value)
+{
+    const char *p = strstr(line, key);
+
+    if (!p)
+        return -1;
+
+    p += strlen(key);
+    return pal_parse_uint(&p, value, 0xFFFFFFFF);
+}
+
+/**
+    @brief    - Parses a timing file line
+    @param    - line     : Timing file line
+                test_id  : Returns the test ID
+                duration : Returns the duration in micro seconds
+    @return   - 0 on success, -1 if the line has no test duration
+**/
+static int pal_parse_timing_line(const char *line, uint32_t *test_id, uint32_t *duration)
+{
+    size_t len;
+
+    line += strspn(line, PAL_TEST_SEPARATORS);
+
+    if (line[0] == '{')
+    {
+        if (!strstr(line, "\"type\":\"test\"") ||
+            pal_find_uint(line, "\"test_id\":", test_id) ||
+            pal_find_uint(line, "\"duration_us\":", duration))
+            return -1;
+
+        return (*test_id > PAL_TEST_FILTER_MAX_ID) ? -1 : 0;
+    }
+
+    len = strcspn(line, PAL_TEST_SEPARATORS);
+    if (len == 0 || pal_parse_test_id(line, len, test_id))
+        return -1;
+
+    line += len;
+    line += strspn(line, PAL_TEST_SEPARATORS);
+    return pal_parse_uint(&line, duration, 0xFFFFFFFF);
+}
+
+/**
+    @brief    - Loads the historical test durations the shards are balanced with.
+    @param    - path : Timing file path
+    @return   - 0 on success, -1 if the file cannot be read
+**/
+int pal_load_test_timings(const char *path)
+{
+    char      line[PAL_RECORD_LINE_SIZE];
+    uint32_t  test_id, duration;
+    FILE     *file;
+    int       status;
+
+    file = fopen(path, "r");
+    if (!file)
+        return -1;
+
+    while (fgets(line, sizeof(line), file))
+    {
+        if (pal_parse_timing_line(line, &test_id, &duration) == 0)
+            g_test_weights[test_id] = duration;
+    }
+
+    status = ferror(file) ? -1 : 0;
+    fclose(file);
+    return status;
+}
+
+/**
+    @brief    - Parses a test record line of a result file
+    @param    - line    : Result file line
+                test_id : Returns the test ID
+                failed  : Returns 1 if the test failed or hit a SIM ERROR, else 0
+    @return   - 0 on success, -1 if the line is not a test record
+**/
+static int pal_parse_result_line(const char *line, uint32_t *test_id, int *failed)
+{
+    line += strspn(line, PAL_TEST_SEPARATORS);
+
+    if (line[0] == '{')
+    {
+        /* JSON Lines test record */
+        if (!strstr(line, "\"type\":\"test\"") ||
+            pal_find_uint(line, "\"test_id\":", test_id))
+            return -1;
+
+        *failed = (strstr(line, "\"state\":\"FAILED\"") ||
+                   strstr(line, "\"state\":\"SIM ERROR\"")) ? 1 : 0;
+    }
+    else
+    {
+        /* JUnit <testcase> element, written one per line */
+        if (strncmp(line, "<testcase ", 10) ||
+            pal_find_uint(line, " id=\"", test_id))
+            return -1;
+
+        *failed = (strstr(line, "<failure") || strstr(line, "<error")) ? 1 : 0;
+    }
+
+    return (*test_id > PAL_TEST_FILTER_MAX_ID) ? -1 : 0;
+}
+
+/**
+    @brief    - Selects the tests which did not pass in a previous run. When
+                tests are also included explicitly, only the failed tests among
+                them are selected.
+    @param    - path : Result file path
+    @return   - Number of selected tests, -1 if the file cannot be read
+**/
+int pal_add_failed_tests(const char *path)
+{
+    static uint32_t  failed_tests[PAL_TEST_FILTER_WORDS];
+    char             line[PAL_RECORD_LINE_SIZE];
+    uint32_t         test_id, i;
+    int              failed, count = 0;
+    FILE            *file;
+
+    file = fopen(path, "r");
+    if (!file)
+        return -1;
+
+    memset(failed_tests, 0, sizeof(failed_tests));
+
+    /* A test may have several records, e.g. in an appended file. The last one wins. */
+    while (fgets(line, sizeof(line), file))
+    {
+        if (pal_parse_result_line(line, &test_id, &failed) != 0)
+            continue;
+
+        if (failed)
+            pal_filter_set(failed_tests, test_id);
+        else
+            failed_tests[test_id / 32] &= ~((uint32_t)1 << (test_id % 32));
+    }
+
+    if (ferror(file))
+    {
+        fclose(file);
+        return -1;
+    }
+    fclose(file);
+
+    /* No failed test means no test to run. Several result files select the
+       tests which failed in any of them. */
+    g_failed_given = 1;
+    for (i = 0; i < PAL_TEST_FILTER_WORDS; i++)
+    {
+        g_failed_tests[i] |= failed_tests[i];
+        for (test_id = failed_tests[i]; test_id; test_id &= test_id - 1)
+            count++;
+    }
+
+    return count;
+}
+
+/**
+ *   @brief    - Returns the shard of the enabled tests the platform executes
+ *   @param    - index : Returns the shard index, from 0 to count - 1
+ *               count : Returns the number of shards
+ *   @return   - SUCCESS, PAL_STATUS_UNSUPPORTED_FUNC if all enabled tests are executed
+**/
+int pal_get_test_shard(uint32_t *index, uint32_t *count)
+{
+    if (g_test_shard_count == 0)
+        return PAL_STATUS_UNSUPPORTED_FUNC;
+
+    *index = g_test_shard;
+    *count = g_test_shard_count;
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+ *   @brief    - Returns the historical duration of a test, used to balance the shards
+ *   @param    - test_id : Test ID
+ *   @return   - Duration in micro seconds, 0 if unknown
+**/
+uint32_t pal_get_test_weight(test_id_t test_id)
+{
+    return (test_id > PAL_TEST_FILTER_MAX_ID) ? 0 : g_test_weights[test_id];
+}
+
+/**
+    @brief    - Sets a bound of the test repetition.
+    @param    - spec : Number of iterations, or duration with a s, m or h suffix
+    @return   - 0 on success, -1 if the bound is malformed
+**/
+int pal_set_test_repeat(const char *spec)
+{
+    uint32_t value, unit = 0;
+
+    if (pal_parse_uint(&spec, &value, 0xFFFFFFFF) || value == 0)
+        return -1;
+
+    if (spec[0] != '\0' && spec[1] != '\0')
+        return -1;
+
+    switch (spec[0])
+    {
+        case '\0':
+            g_test_repeat.iterations = value;
+            return 0;
+        case 's':
+            unit = 1;
+            break;
+        case 'm':
+            unit = 60;
+            break;
+        case 'h':
+            unit = 3600;
+            break;
+        default:
+            return -1;
+    }
+
+    if (value > 0xFFFFFFFF / unit)
+        return -1;
+
+    g_test_repeat.duration_s = value * unit;
+    return 0;
+}
+
+/**
+    @brief    - Sets the scope of the test repetition.
+    @param    - list : Non-zero to repeat the whole test list, zero to repeat
+                       each test before the next one
+    @return   - void
+**/
+void pal_set_test_repeat_scope(int list)
+{
+    g_test_repeat.scope = list ? PAL_TEST_REPEAT_LIST : PAL_TEST_REPEAT_TEST;
+}
+
+/**
+ *   @brief    - Returns the test repetition (soak) settings
+ *   @param    - repeat : Returns the repetition settings
+ *   @return   - SUCCESS, PAL_STATUS_UNSUPPORTED_FUNC if tests are run once
+**/
+int pal_get_test_repeat(pal_test_repeat_t *repeat)
+{
+    if (g_test_repeat.iterations == 0 && g_test_repeat.duration_s == 0)
+        return PAL_STATUS_UNSUPPORTED_FUNC;
+
+    *repeat = g_test_repeat;
+    return PAL_STATUS_SUCCESS;
+}
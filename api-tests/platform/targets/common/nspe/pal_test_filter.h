@@ -0,0 +1,92 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _PAL_TEST_FILTER_H_
+#define _PAL_TEST_FILTER_H_
+
+/* Runtime test selection for host targets. This header must stay self-contained
+ * as it is included by the target main.c files.
+ *
+ * A selection is a list of items separated by ',', ';' or white spaces:
+ *   201, c001, test_c001 : a single test, by test ID or by test name
+ *   c001-c010, 201-210   : an inclusive range of tests
+ *   c0?5, test_s*        : a glob pattern over the test names and test IDs
+ *   !c005, !c01*         : excludes the matching tests
+ * The tests which failed in a previous run can also be selected from its result
+ * file, see pal_add_failed_tests.
+ * When no including item is given, all tests except the excluded ones are enabled.
+ *
+ * The enabled tests can further be split into shards, e.g. across CI nodes, the
+ * split itself is done by the dispatcher (see pal_get_test_shard).
+ */
+
+/* Test IDs above this value cannot be selected */
+#define PAL_TEST_FILTER_MAX_ID    1023
+
+/**
+    @brief    - Adds a test selection to the test filter.
+    @param    - selection : Test selection string
+    @return   - 0 on success, -1 if the selection is malformed
+**/
+int pal_add_test_filter(const char *selection);
+
+/**
+    @brief    - Selects the tests which did not pass in a previous run, i.e. the
+                tests whose last record in the given result file (JSON Lines or
+                JUnit XML, see --results) is FAILED or SIM ERROR. When tests are
+                also included explicitly, only the failed tests among them are
+                selected.
+    @param    - path : Result file path
+    @return   - Number of selected tests, -1 if the file cannot be read
+**/
+int pal_add_failed_tests(const char *path);
+
+/**
+    @brief    - Selects the shard of the enabled tests to be executed.
+    @param    - spec : K/N, the K-th of N shards with K from 1 to N
+    @return   - 0 on success, -1 if the shard is malformed
+**/
+int pal_set_test_shard(const char *spec);
+
+/**
+    @brief    - Loads the historical test durations the shards are balanced with.
+                Each line of the file is either a test record of a JSON Lines
+                result file (see --results) or "<test> <duration in us>".
+                Other lines are ignored, the last duration of a test is kept.
+    @param    - path : Timing file path
+    @return   - 0 on success, -1 if the file cannot be read
+**/
+int pal_load_test_timings(const char *path);
+
+/**
+    @brief    - Sets a bound of the test repetition (soak mode). Iterations and
+                duration may both be set, the first bound reached ends the
+                repetition.
+    @param    - spec : Number of iterations, or duration with a s, m or h suffix
+    @return   - 0 on success, -1 if the bound is malformed
+**/
+int pal_set_test_repeat(const char *spec);
+
+/**
+    @brief    - Sets the scope of the test repetition.
+    @param    - list : Non-zero to repeat the whole test list, zero to repeat
+                       each test before the next one
+    @return   - void
+**/
+void pal_set_test_repeat_scope(int list);
+
+#endif /* _PAL_TEST_FILTER_H_ */
@@ -0,0 +1,99 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "pal_test_filter.h"
+#include "pal_test_options.h"
+
+/**
+    @brief    - Selects the tests which did not pass in a previous run.
+    @param    - path    : result file of the previous run
+    @return   - 0 on success, -1 if the file cannot be read
+**/
+static int add_failed_tests(const char *path)
+{
+    int count = pal_add_failed_tests(path);
+
+    if (count < 0)
+    {
+        fprintf(stderr, "Cannot read result file '%s'\n", path);
+        return -1;
+    }
+
+    fprintf(stderr, "Rerunning %d failed test(s) of '%s'\n", count, path);
+    return 0;
+}
+
+int pal_parse_test_option(const char *arg)
+{
+    int status = 0;
+
+    if (!strncmp(arg, "--rerun-failed=", 15))
+        status = add_failed_tests(&arg[15]);
+    else if (!strncmp(arg, "--repeat=", 9))
+    {
+        status = pal_set_test_repeat(&arg[9]);
+        if (status != 0)
+            fprintf(stderr, "Invalid repetition '%s'\n", &arg[9]);
+    }
+    else if (!strcmp(arg, "--repeat-list"))
+        pal_set_test_repeat_scope(1);
+    else if (!strncmp(arg, "--shard=", 8))
+    {
+        status = pal_set_test_shard(&arg[8]);
+        if (status != 0)
+            fprintf(stderr, "Invalid test shard '%s'\n", &arg[8]);
+    }
+    else if (!strncmp(arg, "--shard-timings=", 16))
+    {
+        status = pal_load_test_timings(&arg[16]);
+        if (status != 0)
+            fprintf(stderr, "Cannot read timing file '%s'\n", &arg[16]);
+    }
+    else if (arg[0] == '-')
+    {
+        fprintf(stderr, "Unknown option '%s'\n", arg);
+        status = PAL_TEST_OPTION_UNKNOWN;
+    }
+    else if (pal_add_test_filter(arg) != 0)
+    {
+        fprintf(stderr, "Invalid test selection '%s'\n", arg);
+        status = -1;
+    }
+
+    return status;
+}
+
+void pal_print_test_options(void)
+{
+    printf("  --rerun-failed=FILE\n");
+    printf("                   Select the tests which failed or hit a SIM ERROR in\n");
+    printf("                   the result file FILE of a previous run.\n");
+    printf("  --repeat=N|TIME  Run each test N times and/or for TIME (e.g. 90s, 30m,\n");
+    printf("                   12h), reporting latencies and key store leaks.\n");
+    printf("  --repeat-list    Repeat the whole test list instead of each test.\n");
+    printf("  --shard=K/N      Run the K-th of N shards of the selected tests.\n");
+    printf("  --shard-timings=FILE\n");
+    printf("                   Balance the shards with the test durations of FILE,\n");
+    printf("                   e.g. a JSON Lines result file of a previous run.\n");
+    printf("  -h, --help       Print this help.\n");
+    printf("Tests are selected by test ID or name (201, c001, test_c001), range\n");
+    printf("(c001-c010), glob pattern (c0?5, s*) or exclusion (!c005). All tests\n");
+    printf("are run by default.\n");
+}
@@ -0,0 +1,47 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _PAL_TEST_OPTIONS_H_
+#define _PAL_TEST_OPTIONS_H_
+
+/* Command line options shared by the host target main.c files: test selection,
+ * --rerun-failed, --shard, --shard-timings, --repeat and --repeat-list.
+ * Target specific options are parsed by the target before falling back to
+ * pal_parse_test_option. This header must stay self-contained.
+ */
+
+/* Returned by pal_parse_test_option for an option it does not know */
+#define PAL_TEST_OPTION_UNKNOWN    1
+
+/**
+    @brief    - Parses a command line argument common to the host targets. An
+                argument which does not start with '-' is a test selection, see
+                pal_add_test_filter. Errors are reported on stderr.
+    @param    - arg : Command line argument
+    @return   - 0 on success, -1 on invalid argument, PAL_TEST_OPTION_UNKNOWN
+                if arg is not a common option
+**/
+int pal_parse_test_option(const char *arg);
+
+/**
+    @brief    - Prints the usage of the common options and of the test selection,
+                to be appended to the usage of the target specific options.
+    @return   - void
+**/
+void pal_print_test_options(void);
+
+#endif /* _PAL_TEST_OPTIONS_H_ */
@@ -32,6 +32,166 @@ __attribute__((weak)) bool_t pal_is_test_enabled(test_id_t test_id)
 	return 1;
 }
 
+/**
+ *   @brief    - Returns the shard of the enabled tests the platform executes.
+ *               By default all enabled tests are executed.
+ *   @return   - PAL_STATUS_UNSUPPORTED_FUNC
+**/
+__attribute__((weak)) int pal_get_test_shard(uint32_t *index, uint32_t *count)
+{
+	(void)index;
+	(void)count;
+
+	return PAL_STATUS_UNSUPPORTED_FUNC;
+}
+
+/**
+ *   @brief    - Returns the historical duration of a test. Unknown by default.
+ *   @return   - Zero
+**/
+__attribute__((weak)) uint32_t pal_get_test_weight(test_id_t test_id)
+{
+	(void)test_id;
+
+	return 0;
+}
+
+/**
+ *   @brief    - Returns the test repetition settings. Tests are run once by default.
+ *   @return   - PAL_STATUS_UNSUPPORTED_FUNC
+**/
+__attribute__((weak)) int pal_get_test_repeat(pal_test_repeat_t *repeat)
+{
+	(void)repeat;
+
+	return PAL_STATUS_UNSUPPORTED_FUNC;
+}
+
+/**
+ *   @brief    - Returns the number of isolated workers the platform executes tests in.
+ *               By default tests run sequentially in the VAL context.
+ *   @return   - Zero
+**/
+__attribute__((weak)) uint32_t pal_get_test_workers(void)
+{
+	return 0;
+}
+
+/**
+ *   @brief    - Executes each test of the list in its own isolated context.
+ *               Not supported by default.
+ *   @return   - PAL_STATUS_UNSUPPORTED_FUNC
+**/
+__attribute__((weak)) int pal_run_tests(const test_id_t *test_ids, uint32_t count,
+                                        const pal_test_ops_t *ops, uint32_t *results)
+{
+	(void)test_ids;
+	(void)count;
+	(void)ops;
+	(void)results;
+
+	return PAL_STATUS_UNSUPPORTED_FUNC;
+}
+
+/**
+ *   @brief    - Reads a free running, monotonic timer. No timer by default.
+ *   @return   - Zero
+**/
+__attribute__((weak)) uint64_t pal_timer_get_ticks(void)
+{
+	return 0;
+}
+
+/**
+ *   @brief    - Returns the frequency of the timer read by pal_timer_get_ticks.
+ *               No timer by default.
+ *   @return   - Zero
+**/
+__attribute__((weak)) uint32_t pal_timer_get_freq(void)
+{
+	return 0;
+}
+
+/**
+ *   @brief    - Returns the clock frequency of the CPU running the tests.
+ *               Not known by default.
+ *   @return   - Zero
+**/
+__attribute__((weak)) uint32_t pal_cpu_get_freq_khz(void)
+{
+	return 0;
+}
+
+/**
+ *   @brief    - Returns the number of threads the benchmark suites may run
+ *               concurrently. No threads by default.
+ *   @return   - Zero
+**/
+__attribute__((weak)) uint32_t pal_thread_get_max(void)
+{
+	return 0;
+}
+
+/**
+ *   @brief    - Runs a function in concurrent threads. Not supported by default.
+ *   @return   - PAL_STATUS_UNSUPPORTED_FUNC
+**/
+__attribute__((weak)) int pal_thread_run(uint32_t count, pal_thread_fn_t fn, void *arg)
+{
+	(void)count;
+	(void)fn;
+	(void)arg;
+
+	return PAL_STATUS_UNSUPPORTED_FUNC;
+}
+
+/**
+ *   @brief    - Returns the external crypto test vector corpus. No corpus by default.
+ *   @return   - PAL_STATUS_UNSUPPORTED_FUNC
+**/
+__attribute__((weak)) int pal_vectors_get(const uint8_t **data, uint32_t *size)
+{
+	(void)data;
+	(void)size;
+
+	return PAL_STATUS_UNSUPPORTED_FUNC;
+}
+
+/**
+ *   @brief    - Returns the length of the streamed benchmark messages. No
+ *               streaming by default.
+ *   @return   - PAL_STATUS_UNSUPPORTED_FUNC
+**/
+__attribute__((weak)) int pal_get_stream_size(uint64_t *size)
+{
+	(void)size;
+
+	return PAL_STATUS_UNSUPPORTED_FUNC;
+}
+
+/**
+ *   @brief    - Returns the format of the result records expected by the platform.
+ *               No result sink by default.
+ *   @return   - PAL_RESULT_FORMAT_NONE
+**/
+__attribute__((weak)) uint32_t pal_result_get_format(void)
+{
+	return PAL_RESULT_FORMAT_NONE;
+}
+
+/**
+ *   @brief    - Writes a result record to the platform result sink.
+ *               Not supported by default.
+ *   @return   - PAL_STATUS_UNSUPPORTED_FUNC
+**/
+__attribute__((weak)) int pal_result_write(const char *record, uint32_t size)
+{
+	(void)record;
+	(void)size;
+
+	return PAL_STATUS_UNSUPPORTED_FUNC;
+}
+
 /**
  *   @brief    - initialize anything relavent to a platform
  *               like any key initialization for crypto operations and etc
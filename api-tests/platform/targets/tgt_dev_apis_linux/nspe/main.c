@@ -1,5 +1,5 @@
 /** @file
- * Copyright (c) 2021, Arm Limited or its affiliates. All rights reserved.
+ * Copyright (c) 2021-2026, Arm Limited or its affiliates. All rights reserved.
  * SPDX-License-Identifier : Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -16,18 +16,201 @@
 **/
 
 #include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pal_process_intf.h"
+#include "pal_test_options.h"
 
 int32_t val_entry(void);
 
 /**
-    @brief    - PSA C main function, used for generating tgt_dev_apis_stdc test binaries.
+    @brief    - Prints the command line usage of the test binary.
+    @param    - prog    : program name
+    @return   - void
+**/
+static void usage(const char *prog)
+{
+    printf("Usage: %s [options] [tests...]\n", prog);
+    printf("  -j N, --jobs=N   Run each test in its own process, N at a time.\n");
+    printf("                   N = 0 or 'auto' uses one process per online CPU.\n");
+    printf("  --fork-server    Initialize the services under test once and fork\n");
+    printf("                   each test from that state (implies -j 1 at least).\n");
+    printf("  --results=[jsonl:|junit:]FILE\n");
+    printf("                   Write machine readable results to FILE ('-' for\n");
+    printf("                   stderr), as JSON Lines (default) or JUnit XML.\n");
+    printf("  --nvmem=FILE     Keep the NVMEM in FILE instead of a temporary file.\n");
+    printf("  --cpu-mhz=N      Convert benchmark results into CPU cycles at N MHz\n");
+    printf("                   instead of the maximum CPU frequency.\n");
+    printf("  --threads=N      Measure benchmark contention with up to N threads\n");
+    printf("                   ('auto' for one per online CPU). The PSA\n");
+    printf("                   implementation must be built thread safe.\n");
+    printf("  --vectors=FILE   Run the crypto test vectors of FILE, packed by\n");
+    printf("                   tools/scripts/pack_vectors.py (test_c069).\n");
+    printf("  --stream=SIZE    Stream messages of SIZE bytes (K, M or G suffix for\n");
+    printf("                   KiB, MiB or GiB) through the multipart crypto APIs\n");
+    printf("                   (test_b032).\n");
+    pal_print_test_options();
+}
+
+/**
+    @brief    - Parses and sets the number of test workers.
+    @param    - arg     : worker count string
+    @return   - 0 on success, -1 on invalid argument
+**/
+static int set_workers(const char *arg)
+{
+    char          *end;
+    unsigned long  value;
+
+    if (!strcmp(arg, "auto"))
+    {
+        pal_set_test_workers(PAL_TEST_WORKERS_AUTO);
+        return 0;
+    }
+
+    value = strtoul(arg, &end, 10);
+    if (*arg == '\0' || *arg == '-' || *end != '\0' || value >= PAL_TEST_WORKERS_AUTO)
+    {
+        fprintf(stderr, "Invalid number of jobs '%s'\n", arg);
+        return -1;
+    }
+
+    pal_set_test_workers(value ? (uint32_t)value : PAL_TEST_WORKERS_AUTO);
+    return 0;
+}
+
+/**
+    @brief    - Parses and sets the CPU frequency of the benchmark results.
+    @param    - arg     : CPU frequency string in MHz
+    @return   - 0 on success, -1 on invalid argument
+**/
+static int set_cpu_freq(const char *arg)
+{
+    char          *end;
+    unsigned long  value;
+
+    value = strtoul(arg, &end, 10);
+    if (*arg == '\0' || *arg == '-' || *end != '\0' || value == 0 || value > (UINT32_MAX / 1000))
+    {
+        fprintf(stderr, "Invalid CPU frequency '%s'\n", arg);
+        return -1;
+    }
+
+    pal_set_cpu_freq_khz((uint32_t)(value * 1000));
+    return 0;
+}
+
+/**
+    @brief    - Parses and sets the maximum number of benchmark threads.
+    @param    - arg     : thread count string
+    @return   - 0 on success, -1 on invalid argument
+**/
+static int set_threads(const char *arg)
+{
+    char          *end;
+    unsigned long  value;
+
+    if (!strcmp(arg, "auto"))
+    {
+        pal_set_thread_max(PAL_THREADS_AUTO);
+        return 0;
+    }
+
+    value = strtoul(arg, &end, 10);
+    if (*arg == '\0' || *arg == '-' || *end != '\0' || value > PAL_THREADS_MAX)
+    {
+        fprintf(stderr, "Invalid thread count '%s'\n", arg);
+        return -1;
+    }
+
+    pal_set_thread_max((uint32_t)value);
+    return 0;
+}
+
+/**
+    @brief    - Parses and sets the length of the streamed benchmark messages.
+    @param    - arg     : length string in bytes, with an optional K, M or G suffix
+    @return   - 0 on success, -1 on invalid argument
+**/
+static int set_stream_size(const char *arg)
+{
+    char               *end;
+    unsigned long long  value;
+    unsigned int        shift = 0;
+
+    value = strtoull(arg, &end, 10);
+    if (*end == 'K')
+        shift = 10;
+    else if (*end == 'M')
+        shift = 20;
+    else if (*end == 'G')
+        shift = 30;
+    if (shift != 0)
+        end++;
+
+    if (*arg == '\0' || *arg == '-' || *end != '\0' || value == 0 || value > (UINT64_MAX >> shift))
+    {
+        fprintf(stderr, "Invalid stream size '%s'\n", arg);
+        return -1;
+    }
+
+    pal_set_stream_size((uint64_t)value << shift);
+    return 0;
+}
+
+/**
+    @brief    - PSA C main function, used for generating tgt_dev_apis_linux test binaries.
     @param    - argc    : the number of command line arguments.
                 argv    : array containing command line arguments.
     @return   - error status
 **/
 int main(int argc, char **argv)
 {
-    (void)argc;
-    (void)argv;
-    return val_entry();
+    int status = 0;
+    int i;
+
+    for (i = 1; i < argc && status == 0; i++)
+    {
+        if (!strcmp(argv[i], "-j") && (i + 1 < argc))
+            status = set_workers(argv[++i]);
+        else if (!strncmp(argv[i], "-j", 2) && argv[i][2] != '\0')
+            status = set_workers(&argv[i][2]);
+        else if (!strncmp(argv[i], "--jobs=", 7))
+            status = set_workers(&argv[i][7]);
+        else if (!strcmp(argv[i], "--fork-server"))
+            pal_set_fork_server(1);
+        else if (!strncmp(argv[i], "--nvmem=", 8) && argv[i][8] != '\0')
+            pal_set_nvmem_file(&argv[i][8]);
+        else if (!strncmp(argv[i], "--results=", 10))
+        {
+            status = pal_set_result_file(&argv[i][10]);
+            if (status != 0)
+                fprintf(stderr, "Cannot open result file '%s'\n", &argv[i][10]);
+        }
+        else if (!strncmp(argv[i], "--cpu-mhz=", 10))
+            status = set_cpu_freq(&argv[i][10]);
+        else if (!strncmp(argv[i], "--threads=", 10))
+            status = set_threads(&argv[i][10]);
+        else if (!strncmp(argv[i], "--vectors=", 10) && argv[i][10] != '\0')
+            pal_set_vectors_file(&argv[i][10]);
+        else if (!strncmp(argv[i], "--stream=", 9))
+            status = set_stream_size(&argv[i][9]);
+        else if (!strcmp(argv[i], "-h") || !strcmp(argv[i], "--help"))
+        {
+            usage(argv[0]);
+            return 0;
+        }
+        else
+            status = pal_parse_test_option(argv[i]);
+    }
+
+    if (status == PAL_TEST_OPTION_UNKNOWN)
+        usage(argv[0]);
+    if (status != 0)
+        return 1;
+
+    pal_set_process_args(argv);
+    return pal_run_entry(val_entry);
 }
@@ -1,5 +1,5 @@
 /** @file
- * Copyright (c) 2021-2023, Arm Limited or its affiliates. All rights reserved.
+ * Copyright (c) 2021-2026, Arm Limited or its affiliates. All rights reserved.
  * SPDX-License-Identifier : Apache-2.0
  * Copyright 2023 NXP
  *
@@ -16,18 +16,37 @@
  * limitations under the License.
 **/
 
+#define _POSIX_C_SOURCE 200809L
+#define _DEFAULT_SOURCE             /* MAP_ANONYMOUS */
+
 #include <inttypes.h>
 #include <limits.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <signal.h>
+#include <stdlib.h>
 #include <string.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
 
 #include "pal_common.h"
-
-/* This stdc implementation doesn't support tests that involve resets of the
- * test process or the system, so we don't actually need non-volatile memory.
- * Just implement the "nvmem" as an array in memory.
+#include "pal_process_intf.h"
+
+/* The NVMEM is a small file mapped in the test process, so that its content
+ * survives the resets of the test process done by re-executing the test binary
+ * (see pal_process_reset). The file descriptor stays open across the exec and
+ * its number is passed to the new process image in PAL_RESUME_ENV, which tells
+ * a resumed run apart from a fresh start. Without a file given on the command
+ * line, an unlinked temporary file is used so that nothing is left behind.
+ *
+ * If the file cannot be set up, the NVMEM falls back to an anonymous shared
+ * mapping, which survives the resets done by killing a forked test process
+ * instead (see pal_run_entry).
  */
 
 /* Using zero as NVMEM_BASE is a bit arbitrary - we don't actually need callers
@@ -37,16 +56,48 @@
 #define NVMEM_BASE 0
 
 #define NVMEM_SIZE (1024)
-static uint8_t g_nvmem[NVMEM_SIZE];
 
-/* The custom test list is a buffer in which all enabled test names are concatenated.
- * The test name template is <TEST_NAME_PREFIX><id><TEST_NAME_SUFFIX>, where <id>
- * is the test identifier.
+/* The VAL boot flag, previous and current test IDs are the first three words of
+ * the NVMEM. Writes to a shared file mapping are seen by the re-executed process
+ * as they are, only the updates of these words are also synced to the file so
+ * that the position of an interrupted run survives a host crash.
  */
-#define TEST_NAME_PREFIX "test_"
-#define TEST_NAME_SUFFIX ";"
+#define NVMEM_SYNC_END (3 * sizeof(uint32_t))
+
+#define NVMEM_TMP_TEMPLATE "psa-arch-tests-nvmem-XXXXXX"
+
+/* Maximum frequency of the first CPU in kHz, as reported by cpufreq */
+#define CPUFREQ_MAX_PATH "/sys/devices/system/cpu/cpu0/cpufreq/cpuinfo_max_freq"
+
+/* Thread of pal_thread_run */
+typedef struct {
+    pthread_t        thread;
+    pal_thread_fn_t  fn;
+    void            *arg;
+    uint32_t         index;
+} pal_thread_t;
 
-char *g_custom_test_list = NULL;
+static uint8_t     g_nvmem_ram[NVMEM_SIZE];
+static uint8_t    *g_nvmem = g_nvmem_ram;
+static int         g_nvmem_fd = -1;
+static const char *g_nvmem_path;
+
+/* CPU frequency in kHz, given on the command line or read from cpufreq */
+static uint32_t    g_cpu_freq_khz;
+
+/* Maximum number of benchmark threads, given on the command line */
+static uint32_t    g_thread_max;
+
+/* Test vector corpus file given on the command line, mapped on first use */
+static const char    *g_vectors_path;
+static const uint8_t *g_vectors;
+static uint32_t       g_vectors_size;
+static uint64_t       g_stream_size;
+
+/* Watchdog POSIX timer and its programmed timeout */
+static timer_t  g_wd_timer;
+static int      g_wd_timer_created;
+static uint32_t g_wd_timeout_us;
 
 /**
     @brief    - Check that an nvmem access is within the bounds of the nvmem
@@ -70,6 +121,179 @@ static int nvmem_check_bounds(addr_t base, uint32_t offset, int size)
     return PAL_STATUS_SUCCESS;
 }
 
+/**
+    @brief    - Sets the file backing the NVMEM
+    @param    - path : File path, NULL for an unlinked temporary file
+    @return   - void
+**/
+void pal_set_nvmem_file(const char *path)
+{
+    g_nvmem_path = path;
+}
+
+/**
+    @brief    - Creates and truncates the NVMEM file of a fresh start
+    @param    - void
+    @return   - File descriptor, -1 on error
+**/
+static int nvmem_create_file(void)
+{
+    char        tmp_path[256];
+    const char *tmp_dir;
+    int         fd, len;
+
+    if (g_nvmem_path)
+    {
+        fd = open(g_nvmem_path, O_RDWR | O_CREAT, 0600);
+    }
+    else
+    {
+        tmp_dir = getenv("TMPDIR");
+        if (!tmp_dir || !*tmp_dir)
+            tmp_dir = "/tmp";
+
+        len = snprintf(tmp_path, sizeof(tmp_path), "%s/%s", tmp_dir, NVMEM_TMP_TEMPLATE);
+        if (len < 0 || (size_t)len >= sizeof(tmp_path))
+            return -1;
+
+        fd = mkstemp(tmp_path);
+        if (fd >= 0)
+            unlink(tmp_path);
+    }
+
+    if (fd < 0)
+        return -1;
+
+    /* Start from an all zero NVMEM, like the in memory array */
+    if (ftruncate(fd, 0) != 0 || ftruncate(fd, NVMEM_SIZE) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+/**
+    @brief    - Maps the NVMEM file. On a resumed run the file inherited from the
+                previous process image is mapped with its content, otherwise
+                a new zeroed file is created.
+    @param    - void
+    @return   - 1 on a resumed run, 0 on a fresh start, -1 if the NVMEM is not
+                backed by a file
+**/
+int pal_nvmem_open(void)
+{
+    const char  *env = getenv(PAL_RESUME_ENV);
+    char         fd_str[16];
+    struct stat  st;
+    void        *map;
+    int          fd = -1, resumed = 0;
+
+    if (env)
+    {
+        fd = atoi(env);
+        resumed = 1;
+        if (fstat(fd, &st) != 0 || st.st_size != NVMEM_SIZE)
+        {
+            fd = -1;
+            resumed = 0;
+        }
+    }
+
+    if (fd < 0)
+        fd = nvmem_create_file();
+
+    if (fd < 0)
+    {
+        unsetenv(PAL_RESUME_ENV);
+        return -1;
+    }
+
+    map = mmap(NULL, NVMEM_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (map == MAP_FAILED)
+    {
+        close(fd);
+        unsetenv(PAL_RESUME_ENV);
+        return -1;
+    }
+
+    snprintf(fd_str, sizeof(fd_str), "%d", fd);
+    if (setenv(PAL_RESUME_ENV, fd_str, 1) != 0)
+    {
+        munmap(map, NVMEM_SIZE);
+        close(fd);
+        return -1;
+    }
+
+    g_nvmem = map;
+    g_nvmem_fd = fd;
+    return resumed;
+}
+
+/**
+    @brief    - Tells if the NVMEM is backed by a file
+    @param    - void
+    @return   - Non-zero if the NVMEM survives a re-execution of the test binary
+**/
+int pal_nvmem_is_persistent(void)
+{
+    return g_nvmem_fd >= 0;
+}
+
+/**
+    @brief    - Tells if the NVMEM holds the state of a test run in progress, i.e.
+                if the VAL boot flag, its first word, has been set
+    @param    - void
+    @return   - Non-zero if a test run is in progress
+**/
+int pal_nvmem_run_started(void)
+{
+    uint32_t boot_flag;
+
+    memcpy(&boot_flag, g_nvmem, sizeof(boot_flag));
+    return boot_flag != 0;
+}
+
+/**
+    @brief    - Moves the in memory NVMEM to an anonymous shared mapping, so that
+                its content is seen by the parent of a forked test process
+    @param    - void
+    @return   - SUCCESS/FAILURE
+**/
+int pal_nvmem_share(void)
+{
+    void *map;
+
+    if (g_nvmem != g_nvmem_ram)
+        return PAL_STATUS_SUCCESS;
+
+    map = mmap(NULL, NVMEM_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (map == MAP_FAILED)
+        return PAL_STATUS_ERROR;
+
+    memcpy(map, g_nvmem_ram, NVMEM_SIZE);
+    g_nvmem = map;
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Gives the calling process a private copy of the NVMEM, so that
+                a test worker does not update the NVMEM of the main process.
+    @param    - void
+    @return   - void
+**/
+void pal_nvmem_detach(void)
+{
+    if (g_nvmem == g_nvmem_ram)
+        return;
+
+    memcpy(g_nvmem_ram, g_nvmem, NVMEM_SIZE);
+    munmap(g_nvmem, NVMEM_SIZE);
+    g_nvmem = g_nvmem_ram;
+    g_nvmem_fd = -1;
+}
+
 /**
     @brief    - Reads from given non-volatile address.
     @param    - base    : Base address of nvmem (must be zero)
@@ -103,6 +327,12 @@ int pal_nvmem_write_ns(addr_t base, uint32_t offset, void *buffer, int size)
         return PAL_STATUS_ERROR;
     }
     memcpy(g_nvmem + offset, buffer, size);
+
+    if (g_nvmem_fd >= 0 && offset < NVMEM_SYNC_END &&
+        msync(g_nvmem, NVMEM_SIZE, MS_SYNC) != 0)
+    {
+        return PAL_STATUS_ERROR;
+    }
     return PAL_STATUS_SUCCESS;
 }
 
@@ -140,10 +370,23 @@ int pal_print_ns(const char *str, int32_t data)
     return PAL_STATUS_SUCCESS;
 }
 
+/**
+    @brief           - Watchdog expiry handler. The expiry is handled as a reset of
+                       the test process, see pal_process_reset.
+    @param           - sig : Signal number
+    @return          - void
+**/
+static void pal_wd_timer_expired(int sig)
+{
+    (void)sig;
+    pal_process_reset();
+}
+
 /**
     @brief           - Initializes an hardware watchdog timer
 
-    This implementation doesn't support watchdogs so this is a noop.
+    This implementation uses a POSIX timer on CLOCK_MONOTONIC raising SIGALRM.
+    A zero timeout disables the watchdog.
 
     @param           - base_addr       : Base address of the watchdog module
                      - time_us         : Time in micro seconds
@@ -152,38 +395,80 @@ int pal_print_ns(const char *str, int32_t data)
 **/
 int pal_wd_timer_init_ns(addr_t base_addr, uint32_t time_us, uint32_t timer_tick_us)
 {
+    struct sigevent  sev;
+    struct sigaction sa;
+    sigset_t         mask;
+
     (void)base_addr;
-    (void)time_us;
     (void)timer_tick_us;
+
+    if (!g_wd_timer_created)
+    {
+        memset(&sa, 0, sizeof(sa));
+        sa.sa_handler = pal_wd_timer_expired;
+        sigemptyset(&sa.sa_mask);
+        if (sigaction(SIGALRM, &sa, NULL) != 0)
+            return PAL_STATUS_ERROR;
+
+        memset(&sev, 0, sizeof(sev));
+        sev.sigev_notify = SIGEV_SIGNAL;
+        sev.sigev_signo = SIGALRM;
+        if (timer_create(CLOCK_MONOTONIC, &sev, &g_wd_timer) != 0)
+            return PAL_STATUS_ERROR;
+
+        g_wd_timer_created = 1;
+
+        /* A reset from the expiry handler re-executes the binary with SIGALRM
+           still blocked, as the signal mask survives the exec */
+        sigemptyset(&mask);
+        sigaddset(&mask, SIGALRM);
+        sigprocmask(SIG_UNBLOCK, &mask, NULL);
+    }
+
+    g_wd_timeout_us = time_us;
     return PAL_STATUS_SUCCESS;
 }
 
 /**
-    @brief           - Enables a hardware watchdog timer
+    @brief           - Arms the watchdog POSIX timer
+    @param           - time_us : Time in micro seconds, zero disarms the timer
+    @return          - SUCCESS/FAILURE
+**/
+static int pal_wd_timer_arm(uint32_t time_us)
+{
+    struct itimerspec its;
 
-    This implementation doesn't support watchdogs so this is a noop.
+    if (!g_wd_timer_created)
+        return PAL_STATUS_SUCCESS;
+
+    memset(&its, 0, sizeof(its));
+    its.it_value.tv_sec = time_us / 1000000;
+    its.it_value.tv_nsec = (long)(time_us % 1000000) * 1000;
+
+    return (timer_settime(g_wd_timer, 0, &its, NULL) == 0) ? PAL_STATUS_SUCCESS
+                                                            : PAL_STATUS_ERROR;
+}
 
+/**
+    @brief           - Enables a hardware watchdog timer
     @param           - base_addr       : Base address of the watchdog module
     @return          - SUCCESS/FAILURE
 **/
 int pal_wd_timer_enable_ns(addr_t base_addr)
 {
     (void)base_addr;
-    return PAL_STATUS_SUCCESS;
+    return pal_wd_timer_arm(g_wd_timeout_us);
 }
 
 /**
     @brief           - Disables a hardware watchdog timer
-
-    This implementation doesn't support watchdogs so this is a noop.
-
     @param           - base_addr  : Base address of the watchdog module
     @return          - SUCCESS/FAILURE
 **/
 int pal_wd_timer_disable_ns(addr_t base_addr)
 {
     (void)base_addr;
-    return PAL_STATUS_SUCCESS;
+    return pal_wd_timer_arm(0);
 }
 
 /**
@@ -201,38 +486,241 @@ void pal_terminate_simulation(void)
 
 /**
  *   @brief    - Resets the system.
+ *
+ *   This implementation resets the test process, see pal_process_reset.
+ *
  *   @param    - void
  *   @return   - SUCCESS/FAILURE
 **/
 int pal_system_reset(void)
 {
-    return PAL_STATUS_UNSUPPORTED_FUNC;
+    fflush(NULL);
+    pal_process_reset();
+    return PAL_STATUS_ERROR;
 }
 
 /**
- *   @brief    - Sets the custom test list buffer
- *   @param    - custom_test_list : Custom test list buffer
-     @return   - void
+ *   @brief    - Reads a free running, monotonic timer.
+ *               This implementation reads CLOCK_MONOTONIC in nanoseconds.
+ *   @param    - void
+ *   @return   - Current timer value in ticks
 **/
-void pal_set_custom_test_list(char *custom_test_list)
+uint64_t pal_timer_get_ticks(void)
 {
-    g_custom_test_list = custom_test_list;
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
+        return 0;
+
+    return ((uint64_t)ts.tv_sec * 1000000000u) + (uint64_t)ts.tv_nsec;
 }
 
 /**
- *   @brief    - Tells if a test is enabled on platform
- *   @param    - test_id : Test ID
- *   @return   - TRUE/FALSE
+ *   @brief    - Returns the frequency of the timer read by pal_timer_get_ticks
+ *   @param    - void
+ *   @return   - Timer ticks per second
 **/
-bool_t pal_is_test_enabled(test_id_t test_id)
+uint32_t pal_timer_get_freq(void)
 {
-    char test_id_str[16] = { 0 };
+    return 1000000000u;
+}
 
-    if (!g_custom_test_list)
-        return 1;
+/**
+ *   @brief    - Sets the CPU frequency benchmark results are converted into CPU
+ *               cycles with
+ *   @param    - khz : CPU frequency in kHz
+ *   @return   - void
+**/
+void pal_set_cpu_freq_khz(uint32_t khz)
+{
+    g_cpu_freq_khz = khz;
+}
+
+/**
+ *   @brief    - Returns the clock frequency of the CPU running the tests.
+ *               This implementation returns the frequency given on the command
+ *               line, else the maximum frequency of the first CPU reported by
+ *               cpufreq. With frequency scaling the cycle counts derived from it
+ *               are nominal.
+ *   @param    - void
+ *   @return   - CPU frequency in kHz, 0 if not known
+**/
+uint32_t pal_cpu_get_freq_khz(void)
+{
+    FILE          *file;
+    unsigned long  khz;
 
-    if (sprintf(test_id_str, "%s%d%s", TEST_NAME_PREFIX, test_id, TEST_NAME_SUFFIX) <= 0)
+    if (g_cpu_freq_khz != 0)
+        return g_cpu_freq_khz;
+
+    file = fopen(CPUFREQ_MAX_PATH, "r");
+    if (file == NULL)
         return 0;
 
-    return strstr(g_custom_test_list, test_id_str)?1:0;
+    if (fscanf(file, "%lu", &khz) == 1 && khz <= UINT32_MAX)
+        g_cpu_freq_khz = (uint32_t)khz;
+    fclose(file);
+
+    return g_cpu_freq_khz;
+}
+
+/**
+ *   @brief    - Sets the maximum number of threads of the benchmark suites
+ *   @param    - count : Number of threads, 0 to disable them or PAL_THREADS_AUTO
+ *   @return   - void
+**/
+void pal_set_thread_max(uint32_t count)
+{
+    long cpus;
+
+    if (count == PAL_THREADS_AUTO)
+    {
+        cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        count = (cpus > 0) ? (uint32_t)cpus : 1;
+    }
+
+    g_thread_max = (count < PAL_THREADS_MAX) ? count : PAL_THREADS_MAX;
+}
+
+/**
+ *   @brief    - Returns the number of threads the benchmark suites may run
+ *               concurrently. Threads are only used when enabled on the command
+ *               line, as the PSA implementation must be built thread safe.
+ *   @param    - void
+ *   @return   - Maximum number of threads, 0 if not enabled
+**/
+uint32_t pal_thread_get_max(void)
+{
+    return g_thread_max;
+}
+
+/**
+ *   @brief    - Entry point of the threads of pal_thread_run
+ *   @param    - arg : pal_thread_t of the thread
+ *   @return   - NULL
+**/
+static void *pal_thread_entry(void *arg)
+{
+    pal_thread_t *thread = arg;
+
+    thread->fn(thread->arg, thread->index);
+    return NULL;
+}
+
+/**
+ *   @brief    - Runs a function in concurrent POSIX threads and joins them
+ *   @param    - count : Number of threads, at most pal_thread_get_max()
+ *               fn    : Function run by each thread, with the thread index
+ *               arg   : Argument passed to the function
+ *   @return   - SUCCESS/FAILURE, FAILURE if a thread could not be created. The
+ *               threads already created are joined before returning.
+**/
+int pal_thread_run(uint32_t count, pal_thread_fn_t fn, void *arg)
+{
+    static pal_thread_t threads[PAL_THREADS_MAX];
+    uint32_t            created;
+    uint32_t            i;
+
+    if (count == 0 || count > g_thread_max)
+        return PAL_STATUS_ERROR;
+
+    for (created = 0; created < count; created++)
+    {
+        threads[created].fn = fn;
+        threads[created].arg = arg;
+        threads[created].index = created;
+        if (pthread_create(&threads[created].thread, NULL, pal_thread_entry,
+                           &threads[created]) != 0)
+            break;
+    }
+
+    for (i = 0; i < created; i++)
+        pthread_join(threads[i].thread, NULL);
+
+    return (created == count) ? PAL_STATUS_SUCCESS : PAL_STATUS_ERROR;
+}
+
+/**
+ *   @brief    - Sets the test vector corpus file
+ *   @param    - path : Corpus file path
+ *   @return   - void
+**/
+void pal_set_vectors_file(const char *path)
+{
+    g_vectors_path = path;
+}
+
+/**
+ *   @brief    - Returns the test vector corpus. The file given on the command
+ *               line is mapped read-only on the first call and stays mapped,
+ *               its records are read in place.
+ *   @param    - data : Start of the corpus
+ *               size : Corpus size in bytes
+ *   @return   - SUCCESS/FAILURE, PAL_STATUS_UNSUPPORTED_FUNC without file
+**/
+int pal_vectors_get(const uint8_t **data, uint32_t *size)
+{
+    struct stat  st;
+    void        *map;
+    int          fd;
+
+    if (g_vectors_path == NULL)
+        return PAL_STATUS_UNSUPPORTED_FUNC;
+
+    if (g_vectors == NULL)
+    {
+        fd = open(g_vectors_path, O_RDONLY);
+        if (fd < 0)
+        {
+            fprintf(stderr, "Cannot open vector file '%s'\n", g_vectors_path);
+            return PAL_STATUS_ERROR;
+        }
+
+        if (fstat(fd, &st) != 0 || st.st_size <= 0 || (uint64_t)st.st_size > UINT32_MAX)
+        {
+            fprintf(stderr, "Invalid vector file '%s'\n", g_vectors_path);
+            close(fd);
+            return PAL_STATUS_ERROR;
+        }
+
+        map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (map == MAP_FAILED)
+        {
+            fprintf(stderr, "Cannot map vector file '%s'\n", g_vectors_path);
+            return PAL_STATUS_ERROR;
+        }
+
+        g_vectors = map;
+        g_vectors_size = (uint32_t)st.st_size;
+    }
+
+    *data = g_vectors;
+    *size = g_vectors_size;
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+ *   @brief    - Sets the length of the streamed benchmark messages
+ *   @param    - size : Message length in bytes, 0 disables the streaming
+ *   @return   - void
+**/
+void pal_set_stream_size(uint64_t size)
+{
+    g_stream_size = size;
+}
+
+/**
+ *   @brief    - Returns the length of the streamed benchmark messages, given on
+ *               the command line
+ *   @param    - size : Message length in bytes
+ *   @return   - SUCCESS, PAL_STATUS_UNSUPPORTED_FUNC without length
+**/
+int pal_get_stream_size(uint64_t *size)
+{
+    if (g_stream_size == 0)
+        return PAL_STATUS_UNSUPPORTED_FUNC;
+
+    *size = g_stream_size;
+    return PAL_STATUS_SUCCESS;
 }
@@ -0,0 +1,628 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <dirent.h>
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "pal_common.h"
+#include "pal_process_intf.h"
+
+/* Each test runs in a forked worker process, so it starts from the PSA state
+ * of the parent and gets its own copy of the VAL globals and of the NVMEM.
+ * The worker stdout is captured in a temporary file which the parent copies
+ * to its own stdout in test ID order, so logs look the same as for a
+ * sequential run whatever the completion order of the workers is.
+ *
+ * Every worker also runs in a private working directory, so that storage
+ * backends keeping their files in the current directory (e.g. the Mbed TLS
+ * ITS file backend) do not share persistent keys between concurrent tests.
+ *
+ * Result records written by a worker (see pal_result_write) are captured the
+ * same way and copied to the result file in test ID order.
+ *
+ * A reset of the test process (on watchdog expiry or pal_system_reset) executes
+ * the test binary again with the same arguments, keeping the file backed NVMEM
+ * (see pal_nvmem_open). The VAL boot flag and test IDs left in NVMEM then make
+ * the dispatcher resume from the interrupted test, like after a system reset.
+ * When the NVMEM is not backed by a file, the entry point runs in a forked
+ * process and the reset terminates it: pal_run_entry then forks a new one,
+ * which resumes from the NVMEM shared with the parent. Neither way leaves the
+ * state of the interrupted process (e.g. a lock held by the crypto library)
+ * to the resumed run. Test workers have a private NVMEM and are not restarted,
+ * they just exit.
+ *
+ * In fork-server mode the parent first lets VAL initialize the services under
+ * test, so workers inherit an initialized (and still key-free) PSA state
+ * copy-on-write instead of initializing it again.
+ */
+
+/* Executable of the running process, re-executed on reset */
+#define PAL_SELF_EXE             "/proc/self/exe"
+
+/* Worker exit code used when the worker could not be set up */
+#define PAL_WORKER_EXIT_ERROR    0xFF
+
+/* Exit code of a forked entry point process which is reset */
+#define PAL_RESET_EXIT           0xFE
+
+#define PAL_WORK_DIR_TEMPLATE    "psa-arch-tests-XXXXXX"
+#define PAL_WORK_DIR_SIZE        256
+
+typedef struct {
+    pid_t     pid;
+    FILE     *log;
+    FILE     *results;
+    char      work_dir[PAL_WORK_DIR_SIZE];
+    uint32_t  state;
+    uint8_t   done;
+    uint8_t   aborted;
+} pal_test_slot_t;
+
+static uint32_t g_test_workers;
+static int      g_fork_server;
+static FILE    *g_result_file;
+static uint32_t g_result_format = PAL_RESULT_FORMAT_NONE;
+
+static volatile sig_atomic_t  g_reset_armed;
+static char                 **g_process_args;
+
+/**
+    @brief    - Sets the number of worker processes tests are executed in.
+    @param    - workers : Number of workers or PAL_TEST_WORKERS_AUTO
+    @return   - void
+**/
+void pal_set_test_workers(uint32_t workers)
+{
+    g_test_workers = workers;
+}
+
+/**
+    @brief    - Enables the fork-server mode.
+    @param    - enable : Non-zero to enable the fork-server mode
+    @return   - void
+**/
+void pal_set_fork_server(int enable)
+{
+    g_fork_server = enable;
+}
+
+/**
+    @brief    - Sets the command line the test binary is re-executed with on reset
+    @param    - argv : NULL terminated argument vector of main
+    @return   - void
+**/
+void pal_set_process_args(char **argv)
+{
+    g_process_args = argv;
+}
+
+/**
+    @brief    - Opens the file machine readable result records are written to.
+    @param    - spec : <format>:<path> with format jsonl or junit, or just <path>
+                       for JSON Lines. A path of '-' writes to stderr.
+    @return   - 0 on success, -1 on invalid format or if the file cannot be opened
+**/
+int pal_set_result_file(const char *spec)
+{
+    uint32_t    format = PAL_RESULT_FORMAT_JSONL;
+    const char *path = spec;
+
+    if (!strncmp(spec, "jsonl:", 6))
+        path = spec + 6;
+    else if (!strncmp(spec, "junit:", 6))
+    {
+        format = PAL_RESULT_FORMAT_JUNIT;
+        path = spec + 6;
+    }
+
+    if (*path == '\0')
+        return -1;
+
+    if (g_result_file && g_result_file != stderr)
+        fclose(g_result_file);
+
+    /* Opened without truncation, which waits for the NVMEM to tell a resumed
+       run from a fresh one, see pal_result_file_start */
+    g_result_file = strcmp(path, "-") ? fopen(path, "a") : stderr;
+    g_result_format = g_result_file ? format : PAL_RESULT_FORMAT_NONE;
+
+    return g_result_file ? 0 : -1;
+}
+
+/**
+    @brief    - Returns the format of the result records expected by the platform
+    @param    - void
+    @return   - pal_result_format_t
+**/
+uint32_t pal_result_get_format(void)
+{
+    return g_result_format;
+}
+
+/**
+    @brief    - Writes a result record to the result file. Records are flushed
+                right away so that the file can be followed while tests run.
+    @param    - record : Record data
+                size   : Record size in bytes
+    @return   - SUCCESS/FAILURE
+**/
+int pal_result_write(const char *record, uint32_t size)
+{
+    if (!g_result_file)
+        return PAL_STATUS_ERROR;
+
+    if (fwrite(record, 1, size, g_result_file) != size || fflush(g_result_file) != 0)
+        return PAL_STATUS_ERROR;
+
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Empties the result file on a fresh run. A run resumed after a
+                reset continues the records of the run it was reset from.
+    @param    - resume : Non-zero if the run is resumed
+    @return   - void
+**/
+static void pal_result_file_start(int resume)
+{
+    if (resume || !g_result_file || g_result_file == stderr)
+        return;
+
+    if (ftruncate(fileno(g_result_file), 0) != 0)
+        perror("Result file");
+}
+
+/**
+    @brief    - Runs the test entry point in forked processes, forking a new one
+                each time the previous one is reset. Used when the test binary
+                cannot be executed again, the NVMEM is then shared with the
+                children.
+    @param    - entry : Test entry point, i.e. val_entry
+    @return   - Status returned by the entry point
+**/
+static int32_t pal_run_entry_forked(int32_t (*entry)(void))
+{
+    int32_t status;
+    pid_t   pid;
+    int     wstatus;
+
+    if (pal_nvmem_share() != PAL_STATUS_SUCCESS)
+    {
+        fprintf(stderr, "No NVMEM, a reset of the test process ends the run\n");
+        return entry();
+    }
+
+    for (;;)
+    {
+        fflush(NULL);
+        pid = fork();
+        if (pid < 0)
+        {
+            perror("fork");
+            return PAL_STATUS_ERROR;
+        }
+
+        if (pid == 0)
+        {
+            g_reset_armed = 1;
+            status = entry();
+            g_reset_armed = 0;
+            exit(((status & 0xFF) == PAL_RESET_EXIT) ? PAL_STATUS_ERROR : status);
+        }
+
+        while (waitpid(pid, &wstatus, 0) < 0)
+        {
+            if (errno != EINTR)
+            {
+                perror("waitpid");
+                return PAL_STATUS_ERROR;
+            }
+        }
+
+        if (!WIFEXITED(wstatus))
+            return PAL_STATUS_ERROR;
+
+        if (WEXITSTATUS(wstatus) != PAL_RESET_EXIT)
+            return WEXITSTATUS(wstatus);
+
+        printf("\n\tTest process reset, resuming test execution\n");
+    }
+}
+
+/**
+    @brief    - Runs the test entry point, restarting it after each reset of the
+                test process.
+    @param    - entry : Test entry point, i.e. val_entry
+    @return   - Status returned by the entry point
+**/
+int32_t pal_run_entry(int32_t (*entry)(void))
+{
+    int32_t status;
+    int     resumed = pal_nvmem_open();
+
+    if (resumed > 0)
+    {
+        printf("\n\tTest process reset, resuming test execution\n");
+    }
+
+    pal_result_file_start((resumed > 0) && pal_nvmem_run_started());
+
+    /* Keep the log up to the last complete line when the process is reset */
+    setvbuf(stdout, NULL, _IOLBF, BUFSIZ);
+
+    if ((resumed < 0) || !g_process_args)
+    {
+        return pal_run_entry_forked(entry);
+    }
+
+    g_reset_armed = 1;
+    status = entry();
+    g_reset_armed = 0;
+
+    return status;
+}
+
+/**
+    @brief    - Resets the test process. Async-signal-safe, never returns.
+    @param    - void
+    @return   - void
+**/
+void pal_process_reset(void)
+{
+    if (!g_reset_armed)
+        _exit(PAL_WORKER_EXIT_ERROR);
+
+    if (pal_nvmem_is_persistent() && g_process_args)
+        execv(PAL_SELF_EXE, g_process_args);
+
+    /* Terminates the forked entry point process, see pal_run_entry_forked */
+    _exit(PAL_RESET_EXIT);
+}
+
+/**
+    @brief    - Returns the number of isolated workers the platform executes tests in
+    @return   - Zero if tests run sequentially in the VAL context, else worker count
+**/
+uint32_t pal_get_test_workers(void)
+{
+    long cpus;
+
+    if (g_test_workers == 0)
+        return g_fork_server ? 1 : 0;
+
+    if (g_test_workers != PAL_TEST_WORKERS_AUTO)
+        return g_test_workers;
+
+    cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return (cpus > 0) ? (uint32_t)cpus : 1;
+}
+
+/**
+    @brief    - Creates the private working directory of a test
+    @param    - slot : Test slot
+    @return   - SUCCESS/FAILURE
+**/
+static int pal_create_work_dir(pal_test_slot_t *slot)
+{
+    const char *tmp_dir = getenv("TMPDIR");
+    int         len;
+
+    if (!tmp_dir || !*tmp_dir)
+        tmp_dir = "/tmp";
+
+    len = snprintf(slot->work_dir, sizeof(slot->work_dir), "%s/%s",
+                   tmp_dir, PAL_WORK_DIR_TEMPLATE);
+    if (len < 0 || (size_t)len >= sizeof(slot->work_dir))
+        return PAL_STATUS_ERROR;
+
+    if (!mkdtemp(slot->work_dir))
+    {
+        slot->work_dir[0] = '\0';
+        return PAL_STATUS_ERROR;
+    }
+
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Removes the private working directory of a test and the files
+                the test left in it
+    @param    - slot : Test slot
+    @return   - void
+**/
+static void pal_remove_work_dir(pal_test_slot_t *slot)
+{
+    char           path[PAL_WORK_DIR_SIZE * 2];
+    struct dirent *entry;
+    DIR           *dir;
+
+    if (!slot->work_dir[0])
+        return;
+
+    dir = opendir(slot->work_dir);
+    if (dir)
+    {
+        while ((entry = readdir(dir)) != NULL)
+        {
+            if (!strcmp(entry->d_name, ".") || !strcmp(entry->d_name, ".."))
+                continue;
+
+            if (snprintf(path, sizeof(path), "%s/%s", slot->work_dir, entry->d_name)
+                < (int)sizeof(path))
+                unlink(path);
+        }
+        closedir(dir);
+    }
+
+    rmdir(slot->work_dir);
+    slot->work_dir[0] = '\0';
+}
+
+/**
+    @brief    - Body of a worker process. Never returns.
+    @param    - slot    : Test slot
+                test_id : Test ID to be executed
+                ops     : VAL callbacks
+    @return   - void
+**/
+static void pal_run_worker(pal_test_slot_t *slot, test_id_t test_id, const pal_test_ops_t *ops)
+{
+    uint32_t state;
+
+    if ((dup2(fileno(slot->log), STDOUT_FILENO) < 0) || (chdir(slot->work_dir) != 0))
+        _exit(PAL_WORKER_EXIT_ERROR);
+
+    if (slot->results)
+        g_result_file = slot->results;
+
+    /* The reset point and the NVMEM belong to the parent, a reset terminates
+       the worker */
+    g_reset_armed = 0;
+    pal_nvmem_detach();
+
+    /* Keep the log of a crashing test up to its last complete line */
+    setvbuf(stdout, NULL, _IOLBF, BUFSIZ);
+
+    state = ops->run(test_id);
+
+    fflush(stdout);
+    _exit((int)(state & 0xFF));
+}
+
+/**
+    @brief    - Starts the worker process of a test
+    @param    - slot    : Test slot
+                test_id : Test ID to be executed
+                ops     : VAL callbacks
+    @return   - SUCCESS/FAILURE
+**/
+static int pal_start_test(pal_test_slot_t *slot, test_id_t test_id, const pal_test_ops_t *ops)
+{
+    slot->log = tmpfile();
+    if (!slot->log)
+        return PAL_STATUS_ERROR;
+
+    if (g_result_file)
+    {
+        slot->results = tmpfile();
+        if (!slot->results)
+            return PAL_STATUS_ERROR;
+    }
+
+    if (pal_create_work_dir(slot) != PAL_STATUS_SUCCESS)
+        return PAL_STATUS_ERROR;
+
+    /* Do not let the worker inherit pending parent output */
+    fflush(NULL);
+
+    slot->pid = fork();
+    if (slot->pid < 0)
+        return PAL_STATUS_ERROR;
+
+    if (slot->pid == 0)
+        pal_run_worker(slot, test_id, ops);
+
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Waits for a worker to terminate and records its test state.
+                Children which are not running workers are reaped in passing.
+    @param    - slots : Test slots
+                count : Number of test slots
+    @return   - SUCCESS once a worker terminated, FAILURE if there is no child
+                left to wait for
+**/
+static int pal_wait_test(pal_test_slot_t *slots, uint32_t count)
+{
+    uint32_t  i;
+    pid_t     pid;
+    int       wstatus;
+
+    while (1)
+    {
+        pid = waitpid(-1, &wstatus, 0);
+        if (pid < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return PAL_STATUS_ERROR;
+        }
+
+        for (i = 0; i < count; i++)
+        {
+            if (slots[i].pid != pid || slots[i].done)
+                continue;
+
+            slots[i].done = 1;
+            if (WIFEXITED(wstatus) && WEXITSTATUS(wstatus) != 0 &&
+                WEXITSTATUS(wstatus) != PAL_WORKER_EXIT_ERROR)
+                slots[i].state = (uint32_t)WEXITSTATUS(wstatus);
+            else
+                slots[i].aborted = 1;
+            return PAL_STATUS_SUCCESS;
+        }
+    }
+}
+
+/**
+    @brief    - Terminates and reaps the workers still running
+    @param    - slots : Test slots
+                count : Number of test slots
+    @return   - void
+**/
+static void pal_stop_tests(pal_test_slot_t *slots, uint32_t count)
+{
+    uint32_t  i;
+
+    for (i = 0; i < count; i++)
+    {
+        if (slots[i].pid <= 0 || slots[i].done)
+            continue;
+
+        kill(slots[i].pid, SIGKILL);
+        while (waitpid(slots[i].pid, NULL, 0) < 0 && errno == EINTR)
+            ;
+        slots[i].done = 1;
+        slots[i].aborted = 1;
+    }
+}
+
+/**
+    @brief    - Copies a capture file to the given stream and closes it
+    @param    - capture : Capture file, set to NULL
+                stream  : Destination stream
+    @return   - void
+**/
+static void pal_replay_capture(FILE **capture, FILE *stream)
+{
+    char    buffer[512];
+    size_t  len;
+
+    if (!*capture)
+        return;
+
+    rewind(*capture);
+    while ((len = fread(buffer, 1, sizeof(buffer), *capture)) > 0)
+        fwrite(buffer, 1, len, stream);
+    fclose(*capture);
+    *capture = NULL;
+}
+
+/**
+    @brief    - Copies the captured output and result records of a test to stdout
+                and to the result file, and releases its slot
+    @param    - slot : Test slot
+    @return   - void
+**/
+static void pal_report_test(pal_test_slot_t *slot)
+{
+    pal_replay_capture(&slot->log, stdout);
+    if (slot->results)
+    {
+        pal_replay_capture(&slot->results, g_result_file);
+        fflush(g_result_file);
+    }
+
+    pal_remove_work_dir(slot);
+}
+
+/**
+    @brief    - Executes each test of the list in its own worker process, with up
+                to pal_get_test_workers() workers at a time. Test outputs and
+                results are reported in list order.
+    @param    - test_ids : Tests to be executed
+                count    : Number of tests in test_ids
+                ops      : Callbacks to prepare the shared state, run a test and
+                           report an aborted test
+                results  : Returns the test state of each test
+    @return   - SUCCESS/FAILURE
+**/
+int pal_run_tests(const test_id_t *test_ids, uint32_t count,
+                  const pal_test_ops_t *ops, uint32_t *results)
+{
+    pal_test_slot_t *slots;
+    uint32_t         workers = pal_get_test_workers();
+    uint32_t         next_start = 0, next_report = 0, running = 0;
+    int              status = PAL_STATUS_SUCCESS;
+
+    if (workers == 0)
+        return PAL_STATUS_UNSUPPORTED_FUNC;
+
+    if (g_fork_server && ops->prepare && ops->prepare() != 0)
+        return PAL_STATUS_ERROR;
+
+    slots = calloc(count, sizeof(pal_test_slot_t));
+    if (!slots)
+        return PAL_STATUS_ERROR;
+
+    while (next_report < count)
+    {
+        while (running < workers && next_start < count)
+        {
+            if (pal_start_test(&slots[next_start], test_ids[next_start], ops)
+                == PAL_STATUS_SUCCESS)
+            {
+                running++;
+            }
+            else
+            {
+                printf("\n\tFailed to start worker for test %u\n", test_ids[next_start]);
+                slots[next_start].done = 1;
+                slots[next_start].aborted = 1;
+            }
+            next_start++;
+        }
+
+        if (running > 0)
+        {
+            if (pal_wait_test(slots, count) != PAL_STATUS_SUCCESS)
+            {
+                status = PAL_STATUS_ERROR;
+                pal_stop_tests(slots, count);
+                break;
+            }
+            running--;
+        }
+
+        while (next_report < count && slots[next_report].done)
+        {
+            pal_report_test(&slots[next_report]);
+            if (slots[next_report].aborted)
+                results[next_report] = ops->abort(test_ids[next_report]);
+            else
+                results[next_report] = slots[next_report].state;
+            next_report++;
+        }
+    }
+
+    for (; next_report < count; next_report++)
+        pal_report_test(&slots[next_report]);
+
+    fflush(stdout);
+    free(slots);
+    return status;
+}
@@ -0,0 +1,176 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _PAL_PROCESS_INTF_H_
+#define _PAL_PROCESS_INTF_H_
+
+/* Host process control interface of the Linux target, used by main.c to
+ * configure test execution from the command line. This header must stay
+ * self-contained as main.c is built without the PAL include paths.
+ */
+
+#include <stdint.h>
+
+/* Use one worker per online CPU */
+#define PAL_TEST_WORKERS_AUTO    0xFFFFFFFF
+
+/* Use one benchmark thread per online CPU */
+#define PAL_THREADS_AUTO         0xFFFFFFFF
+
+/* Maximum number of benchmark threads */
+#define PAL_THREADS_MAX          256
+
+/* Environment variable passing the NVMEM file descriptor to the test binary
+ * re-executed on reset. Its presence marks a resumed run.
+ */
+#define PAL_RESUME_ENV           "PSA_ARCH_TESTS_NVMEM_FD"
+
+/**
+    @brief    - Sets the number of worker processes tests are executed in.
+                Zero runs the tests sequentially in the main process.
+    @param    - workers : Number of workers or PAL_TEST_WORKERS_AUTO
+    @return   - void
+**/
+void pal_set_test_workers(uint32_t workers);
+
+/**
+    @brief    - Enables the fork-server mode. The services under test are
+                initialized once in the main process and every test runs in a
+                worker forked from that snapshot. Implies at least one worker.
+    @param    - enable : Non-zero to enable the fork-server mode
+    @return   - void
+**/
+void pal_set_fork_server(int enable);
+
+/**
+    @brief    - Opens the file machine readable result records are written to.
+    @param    - spec : <format>:<path> with format jsonl or junit, or just <path>
+                       for JSON Lines. A path of '-' writes to stderr.
+    @return   - 0 on success, -1 on invalid format or if the file cannot be opened
+**/
+int pal_set_result_file(const char *spec);
+
+/**
+    @brief    - Sets the command line the test binary is re-executed with on reset
+    @param    - argv : NULL terminated argument vector of main
+    @return   - void
+**/
+void pal_set_process_args(char **argv);
+
+/**
+    @brief    - Sets the file backing the NVMEM. The file is truncated on a
+                fresh start and kept as it is when resuming after a reset.
+    @param    - path : File path, NULL for an unlinked temporary file
+    @return   - void
+**/
+void pal_set_nvmem_file(const char *path);
+
+/**
+    @brief    - Maps the NVMEM file. Called by pal_run_entry.
+    @param    - void
+    @return   - 1 on a resumed run, 0 on a fresh start, -1 if the NVMEM is not
+                backed by a file
+**/
+int pal_nvmem_open(void);
+
+/**
+    @brief    - Tells if the NVMEM is backed by a file
+    @param    - void
+    @return   - Non-zero if the NVMEM survives a re-execution of the test binary
+**/
+int pal_nvmem_is_persistent(void);
+
+/**
+    @brief    - Tells if the NVMEM holds the state of a test run in progress
+    @param    - void
+    @return   - Non-zero if the VAL boot flag has been set
+**/
+int pal_nvmem_run_started(void);
+
+/**
+    @brief    - Moves the in memory NVMEM to a mapping shared with the forked
+                children of the calling process. Called by pal_run_entry when
+                the NVMEM is not backed by a file.
+    @param    - void
+    @return   - SUCCESS/FAILURE
+**/
+int pal_nvmem_share(void);
+
+/**
+    @brief    - Gives the calling process a private copy of the NVMEM. Called in
+                test workers.
+    @param    - void
+    @return   - void
+**/
+void pal_nvmem_detach(void);
+
+/**
+    @brief    - Sets the CPU frequency benchmark results are converted into CPU
+                cycles with, instead of the maximum frequency given by cpufreq.
+    @param    - khz : CPU frequency in kHz
+    @return   - void
+**/
+void pal_set_cpu_freq_khz(uint32_t khz);
+
+/**
+    @brief    - Sets the maximum number of threads the benchmark suites run
+                concurrently to measure contention, capped at PAL_THREADS_MAX.
+                Zero (default) disables the multithreaded measurements.
+    @param    - count : Number of threads or PAL_THREADS_AUTO
+    @return   - void
+**/
+void pal_set_thread_max(uint32_t count);
+
+/**
+    @brief    - Sets the file of the external crypto test vector corpus, mapped
+                in memory when the corpus is first read.
+    @param    - path : Corpus file path
+    @return   - void
+**/
+void pal_set_vectors_file(const char *path);
+
+/**
+    @brief    - Sets the length of the messages streamed by the large message
+                benchmarks. Zero (default) skips them.
+    @param    - size : Message length in bytes
+    @return   - void
+**/
+void pal_set_stream_size(uint64_t size);
+
+/**
+    @brief    - Runs the test entry point, restarting it after each reset of the
+                test process (see pal_process_reset).
+    @param    - entry : Test entry point, i.e. val_entry
+    @return   - Status returned by the entry point
+**/
+int32_t pal_run_entry(int32_t (*entry)(void));
+
+/**
+    @brief    - Resets the test process. In the main process, the test binary is
+                executed again and resumes from the NVMEM content like after a
+                system reset. Without NVMEM file, the entry point runs in a
+                forked process which is terminated, and pal_run_entry forks a
+                new one.
+                In a test worker the worker terminates and its test is reported
+                as aborted.
+                Async-signal-safe, never returns.
+    @param    - void
+    @return   - void
+**/
+void pal_process_reset(void);
+
+#endif /* _PAL_PROCESS_INTF_H_ */
@@ -36,9 +36,12 @@ else()
 	list(APPEND PAL_SRC_C_NSPE
 		# driver files will be compiled as part of NSPE
 		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/pal_driver_intf.c
+		${PSA_ROOT_DIR}/platform/targets/common/nspe/pal_test_filter.c
+		${PSA_ROOT_DIR}/platform/targets/common/nspe/pal_test_options.c
+		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/pal_process_intf.c
 	)
 endif()
-if(${SUITE} STREQUAL "CRYPTO")
+if((${SUITE} STREQUAL "CRYPTO") OR (${SUITE} STREQUAL "BENCH_CRYPTO"))
 	list(APPEND PAL_SRC_C_NSPE
 		${PSA_ROOT_DIR}/platform/targets/common/nspe/crypto/pal_crypto_intf.c
 	)
@@ -1,5 +1,5 @@
 /** @file
- * Copyright (c) 2019-2020, Arm Limited or its affiliates. All rights reserved.
+ * Copyright (c) 2019-2026, Arm Limited or its affiliates. All rights reserved.
  * SPDX-License-Identifier : Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -16,9 +16,24 @@
 **/
 
 #include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pal_test_options.h"
 
 int32_t val_entry(void);
 
+/**
+    @brief    - Prints the command line usage of the test binary.
+    @param    - prog    : program name
+    @return   - void
+**/
+static void usage(const char *prog)
+{
+    printf("Usage: %s [options] [tests...]\n", prog);
+    pal_print_test_options();
+}
+
 /**
     @brief    - PSA C main function, used for generating tgt_dev_apis_stdc test binaries.
     @param    - argc    : the number of command line arguments.
@@ -27,7 +42,24 @@ int32_t val_entry(void);
 **/
 int main(int argc, char **argv)
 {
-    (void)argc;
-    (void)argv;
+    int status = 0;
+    int i;
+
+    for (i = 1; i < argc && status == 0; i++)
+    {
+        if (!strcmp(argv[i], "-h") || !strcmp(argv[i], "--help"))
+        {
+            usage(argv[0]);
+            return 0;
+        }
+        else
+            status = pal_parse_test_option(argv[i]);
+    }
+
+    if (status == PAL_TEST_OPTION_UNKNOWN)
+        usage(argv[0]);
+    if (status != 0)
+        return 1;
+
     return val_entry();
 }
@@ -57,6 +57,15 @@
 #define ARCH_TEST_ECC_CURVE_SECP256R1
 #define ARCH_TEST_ECC_CURVE_SECP384R1
 
+/**
+ * \def ARCH_TEST_ECC_CURVE_25519
+ *
+ * Enable the Montgomery curve Curve25519, for X25519 key agreement.
+ *
+ * Requires: ARCH_TEST_ECC
+ */
+#define ARCH_TEST_ECC_CURVE_25519
+
 /**
  * \def ARCH_TEST_AES
  *
@@ -312,6 +321,20 @@
  */
 #define ARCH_TEST_ECDH
 
+/**
+ * \def ARCH_TEST_FFDH
+ * \def ARCH_TEST_FFDHEXXXX
+ *
+ * Enable finite field Diffie-Hellman and the RFC 7919 groups. Comment macros
+ * to disable a group.
+ *
+ * Requires: ARCH_TEST_FFDH
+ */
+//#define ARCH_TEST_FFDH
+//#define ARCH_TEST_FFDHE2048
+//#define ARCH_TEST_FFDHE3072
+//#define ARCH_TEST_FFDHE4096
+
 /**
  * \def ARCH_TEST_ECDSA
  *
@@ -327,6 +350,25 @@
 */
 #define ARCH_TEST_DETERMINISTIC_ECDSA
 
+/**
+ * \def ARCH_TEST_RSA_PSS
+ *
+ * Enable RSA-PSS signatures (PKCS#1 v2.1).
+ *
+ * Requires: ARCH_TEST_RSA
+ */
+#define ARCH_TEST_RSA_PSS
+
+/**
+ * \def ARCH_TEST_EDDSA
+ *
+ * Enable PureEdDSA signatures over Edwards25519 (Ed25519), not supported by
+ * Mbed TLS.
+ *
+ * Requires: ARCH_TEST_ECC
+ */
+//#define ARCH_TEST_EDDSA
+
 /**
  * \def ARCH_TEST_ECC_ASYMMETRIC_API_SUPPORT
  *
@@ -341,6 +383,33 @@
 */
 #define ARCH_TEST_PBKDF2
 
+
+/**
+ * \def PAL_KEY_TRACK_COUNT
+ *
+ * Number of keys the crypto PAL tracks for their destruction at the end of
+ * each test. Must be a power of two, defaults to 128.
+ */
+#define PAL_KEY_TRACK_COUNT 4096
+
+/**
+ * \def ARCH_TEST_BENCH_MAX_SIZE
+ *
+ * Largest buffer size, in bytes, swept by the crypto benchmark suite
+ * (BENCH_CRYPTO). Input and output buffers of this size are statically
+ * allocated, defaults to 1 MiB.
+ */
+#define ARCH_TEST_BENCH_MAX_SIZE (1024 * 1024)
+
+/**
+ * \def ARCH_TEST_BENCH_MAX_KEYS
+ *
+ * Largest number of live keys the key store scaling benchmark of the crypto
+ * benchmark suite imports, if the key store does not run out of memory
+ * before. Defaults to 1024.
+ */
+#define ARCH_TEST_BENCH_MAX_KEYS 4096
+
 #include "pal_crypto_config_check.h"
 
 #endif /* _PAL_CRYPTO_CONFIG_H_ */
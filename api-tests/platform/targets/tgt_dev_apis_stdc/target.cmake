@@ -32,7 +32,7 @@
 #                                                               libmbedcrypto.a
 # ARGUMENTS:
 #   _exe_name     Name of the test binary to generate.
-#   _api_dir      PSA API directory name e.g. crypto,
+#   _api_dir      PSA API directory name e.g. crypto, bench_crypto,
 #                 internal_trusted_storage or protected_storage.
 ###############################################################################
 function(_create_psa_stdc_exe _exe_name _api_dir)
@@ -51,6 +51,7 @@ function(_create_psa_stdc_exe _exe_name _api_dir)
 	)
 
 	add_executable(${EXE_NAME} ${EXE_SRC})
+	target_include_directories(${EXE_NAME} PRIVATE ${PSA_ROOT_DIR}/platform/targets/common/nspe)
 	target_link_libraries(${EXE_NAME} ${EXE_LIBS} ${PSA_CRYPTO_LIB_FILENAME} ${PSA_STORAGE_LIB_FILENAME})
 	add_dependencies(${EXE_NAME} ${PSA_TARGET_TEST_COMBINE_LIB})
 endfunction(_create_psa_stdc_exe)
@@ -74,16 +75,22 @@ else()
 	list(APPEND PAL_SRC_C_NSPE
 		# driver files will be compiled as part of NSPE
 		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/pal_driver_intf.c
+		${PSA_ROOT_DIR}/platform/targets/common/nspe/pal_test_filter.c
+		${PSA_ROOT_DIR}/platform/targets/common/nspe/pal_test_options.c
 	)
 endif()
-if(${SUITE} STREQUAL "CRYPTO")
+if((${SUITE} STREQUAL "CRYPTO") OR (${SUITE} STREQUAL "BENCH_CRYPTO"))
 	list(APPEND PAL_SRC_C_NSPE
 		${PSA_ROOT_DIR}/platform/targets/common/nspe/crypto/pal_crypto_intf.c
 	)
 	if(NOT DEFINED PSA_CRYPTO_LIB_FILENAME)
 		message(FATAL_ERROR "ERROR: PSA_CRYPTO_LIB_FILENAME undefined.")
 	endif()
-	_create_psa_stdc_exe(psa-arch-tests-crypto crypto)
+	if(${SUITE} STREQUAL "BENCH_CRYPTO")
+		_create_psa_stdc_exe(psa-arch-tests-bench-crypto bench_crypto)
+	else()
+		_create_psa_stdc_exe(psa-arch-tests-crypto crypto)
+	endif()
 endif()
 if(${SUITE} STREQUAL "PROTECTED_STORAGE")
 	list(APPEND PAL_SRC_C_NSPE
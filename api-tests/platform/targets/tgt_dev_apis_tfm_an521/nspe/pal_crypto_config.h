@@ -406,6 +406,24 @@
 */
 #define ARCH_TEST_PBKDF2
 
+/**
+ * \def ARCH_TEST_BENCH_MAX_SIZE
+ *
+ * Largest buffer size, in bytes, swept by the crypto benchmark suite
+ * (BENCH_CRYPTO). Input and output buffers of this size are statically
+ * allocated, defaults to 1 MiB.
+ */
+#define ARCH_TEST_BENCH_MAX_SIZE (64 * 1024)
+
+/**
+ * \def ARCH_TEST_BENCH_MAX_KEYS
+ *
+ * Largest number of live keys the key store scaling benchmark of the crypto
+ * benchmark suite imports, if the key store does not run out of memory
+ * before. Defaults to 1024.
+ */
+#define ARCH_TEST_BENCH_MAX_KEYS 256
+
 #include "pal_crypto_config_check.h"
 
 #endif /* _PAL_CRYPTO_CONFIG_H_ */
@@ -19,6 +19,10 @@
 #include "pal_uart.h"
 #include "pal_nvmem.h"
 #include "pal_wd_cmsdk.h"
+#include "pal_timer_dwt.h"
+
+/* CPU clock of the MPS2+ AN521 platform, counted by the DWT cycle counter */
+#define CPU_CLOCK_FREQ_HZ 25000000
 
 /**
     @brief    - This function initializes the UART
@@ -140,3 +144,34 @@ int pal_system_reset(void)
     /* Reset functionality is not functional on AN521 FVP */
     return PAL_STATUS_UNSUPPORTED_FUNC;
 }
+
+/**
+ *   @brief    - Reads a free running, monotonic timer.
+ *               This implementation reads the DWT cycle counter.
+ *   @param    - void
+ *   @return   - Current timer value in ticks
+**/
+uint64_t pal_timer_get_ticks(void)
+{
+    return pal_timer_dwt_read();
+}
+
+/**
+ *   @brief    - Returns the frequency of the timer read by pal_timer_get_ticks
+ *   @param    - void
+ *   @return   - Timer ticks per second, 0 if the cycle counter is not available
+**/
+uint32_t pal_timer_get_freq(void)
+{
+    return (pal_timer_dwt_init() == PAL_STATUS_SUCCESS) ? CPU_CLOCK_FREQ_HZ : 0;
+}
+
+/**
+ *   @brief    - Returns the clock frequency of the CPU running the tests
+ *   @param    - void
+ *   @return   - CPU frequency in kHz
+**/
+uint32_t pal_cpu_get_freq_khz(void)
+{
+    return CPU_CLOCK_FREQ_HZ / 1000;
+}
@@ -37,10 +37,11 @@ else()
 		${PSA_ROOT_DIR}/platform/drivers/nvmem/pal_nvmem.c
 		${PSA_ROOT_DIR}/platform/drivers/uart/cmsdk/pal_uart.c
 		${PSA_ROOT_DIR}/platform/drivers/watchdog/cmsdk/pal_wd_cmsdk.c
+		${PSA_ROOT_DIR}/platform/drivers/timer/dwt/pal_timer_dwt.c
 	)
 endif()
 
-if(${SUITE} STREQUAL "CRYPTO")
+if((${SUITE} STREQUAL "CRYPTO") OR (${SUITE} STREQUAL "BENCH_CRYPTO"))
 	list(APPEND PAL_SRC_C_NSPE
 		${PSA_ROOT_DIR}/platform/targets/common/nspe/crypto/pal_crypto_intf.c
 	)
@@ -78,6 +79,7 @@ list(APPEND PAL_DRIVER_INCLUDE_PATHS
 	${PSA_ROOT_DIR}/platform/drivers/nvmem
 	${PSA_ROOT_DIR}/platform/drivers/uart/cmsdk
 	${PSA_ROOT_DIR}/platform/drivers/watchdog/cmsdk
+	${PSA_ROOT_DIR}/platform/drivers/timer/dwt
 )
 
 target_include_directories(${PSA_TARGET_PAL_NSPE_LIB} PRIVATE
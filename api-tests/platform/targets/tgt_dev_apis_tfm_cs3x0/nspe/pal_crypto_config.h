@@ -384,6 +384,15 @@
  * Enable ECC support for asymmetric API.
 */
 //#define ARCH_TEST_ECC_ASYMMETRIC_API_SUPPORT
+/**
+ * \def ARCH_TEST_BENCH_MAX_SIZE
+ *
+ * Largest buffer size, in bytes, swept by the crypto benchmark suite
+ * (BENCH_CRYPTO). Input and output buffers of this size are statically
+ * allocated, defaults to 1 MiB.
+ */
+#define ARCH_TEST_BENCH_MAX_SIZE (64 * 1024)
+
 #include "pal_crypto_config_check.h"
 
 #endif /* _PAL_CRYPTO_CONFIG_H_ */
@@ -39,7 +39,7 @@ else()
 	)
 endif()
 
-if(${SUITE} STREQUAL "CRYPTO")
+if((${SUITE} STREQUAL "CRYPTO") OR (${SUITE} STREQUAL "BENCH_CRYPTO"))
 	list(APPEND PAL_SRC_C_NSPE
 		${PSA_ROOT_DIR}/platform/targets/common/nspe/crypto/pal_crypto_intf.c
 	)
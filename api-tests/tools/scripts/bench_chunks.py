@@ -0,0 +1,64 @@
+#!/usr/bin/python
+#/** @file
+# * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+# * SPDX-License-Identifier : Apache-2.0
+# *
+# * Licensed under the Apache License, Version 2.0 (the "License");
+# * you may not use this file except in compliance with the License.
+# * You may obtain a copy of the License at
+# *
+# *  http://www.apache.org/licenses/LICENSE-2.0
+# *
+# * Unless required by applicable law or agreed to in writing, software
+# * distributed under the License is distributed on an "AS IS" BASIS,
+# * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# * See the License for the specific language governing permissions and
+# * limitations under the License.
+#**/
+
+# Charts the chunk size sweeps of the BENCH_CRYPTO suite (test_b005 to
+# test_b008) from a JSON Lines result file: for each algorithm, the throughput
+# of each chunk size next to the single-shot API ("single"), and the overhead
+# of each update.
+
+import json
+import sys
+
+BAR_WIDTH = 40
+
+if (len(sys.argv) != 2):
+        print("\nUsage: bench_chunks.py <JSON Lines result file>")
+        sys.exit(1)
+
+singles = {}
+sweeps = {}
+with open(sys.argv[1]) as results:
+        for line in results:
+                try:
+                        record = json.loads(line)
+                except ValueError:
+                        continue
+                if (record.get("type") != "bench"):
+                        continue
+                key = (record["test"], record["alg_name"], record["key_bits"], record["size"])
+                if ("chunk" in record):
+                        sweeps.setdefault(key, []).append(record)
+                else:
+                        singles[key] = record
+
+for key in sorted(sweeps):
+        test, alg_name, key_bits, size = key
+        single = singles.get(key)
+        samples = sorted(sweeps[key], key=lambda record: record["chunk"])
+        scale = max([record["mb_per_s"] or 0 for record in samples] +
+                    [(single or {}).get("mb_per_s") or 0])
+
+        print("\n%s %s, %d byte payload" % (samples[0]["op"], alg_name, size))
+        print("%10s %10s %14s" % ("chunk", "MB/s", "ns/chunk"))
+        rows = [("single", single, None)] if single else []
+        rows += [(str(record["chunk"]), record, record["chunk_overhead_ns"]) for record in samples]
+        for label, record, overhead in rows:
+                mb_per_s = record["mb_per_s"] or 0
+                bar = int(BAR_WIDTH * mb_per_s / scale) if scale else 0
+                print("%10s %10.2f %14s %s" % (label, mb_per_s,
+                      "" if overhead is None else str(overhead), "#" * bar))
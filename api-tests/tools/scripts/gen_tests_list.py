@@ -58,7 +58,7 @@ else:
 	suite_test_end_number      = sys.maxsize
 
 # Dictionary to hold the mapping between suite and the base number
-suite_with_base_dict = {"ipc":0, "crypto":1, "internal_trusted_storage":2, "protected_storage":2, "storage":2, "initial_attestation":3}
+suite_with_base_dict = {"ipc":0, "crypto":1, "internal_trusted_storage":2, "protected_storage":2, "storage":2, "initial_attestation":3, "bench_crypto":4}
 
 def gen_test_list():
 	"""
@@ -0,0 +1,297 @@
+#!/usr/bin/python
+#/** @file
+# * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+# * SPDX-License-Identifier : Apache-2.0
+# *
+# * Licensed under the Apache License, Version 2.0 (the "License");
+# * you may not use this file except in compliance with the License.
+# * You may obtain a copy of the License at
+# *
+# *  http://www.apache.org/licenses/LICENSE-2.0
+# *
+# * Unless required by applicable law or agreed to in writing, software
+# * distributed under the License is distributed on an "AS IS" BASIS,
+# * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# * See the License for the specific language governing permissions and
+# * limitations under the License.
+#**/
+
+# Packs crypto test vectors into the binary corpus run by test_c069 of the
+# crypto suite (see val/nspe/val_vectors.h for the format). Inputs are
+# Wycheproof JSON files (HMAC, AES-CBC-PKCS5, AES-GCM, AES-CCM,
+# CHACHA20-POLY1305, ECDSA and EdDSA verification) and NIST CAVP hash
+# response files (SHA*ShortMsg.rsp, SHA*LongMsg.rsp). Wycheproof vectors with
+# an "acceptable" result are left out, as their outcome is implementation
+# defined.
+
+import json
+import os
+import re
+import struct
+import sys
+
+VECTORS_MAGIC = 0x56415350
+VECTORS_VERSION = 1
+
+KIND_HASH = 1
+KIND_MAC = 2
+KIND_CIPHER = 3
+KIND_AEAD = 4
+KIND_SIGN = 5
+KIND_VERIFY = 6
+
+FLAG_INVALID = 0x1
+
+# PSA algorithm and key type encodings
+HASH_ALGS = {
+        "SHA-1":       0x02000005,
+        "SHA-224":     0x02000008,
+        "SHA-256":     0x02000009,
+        "SHA-384":     0x0200000a,
+        "SHA-512":     0x0200000b,
+        "SHA-512/224": 0x0200000c,
+        "SHA-512/256": 0x0200000d,
+        "SHA3-224":    0x02000010,
+        "SHA3-256":    0x02000011,
+        "SHA3-384":    0x02000012,
+        "SHA3-512":    0x02000013,
+}
+HASH_LENGTH_BYTES = {
+        "SHA-1":       20,
+        "SHA-224":     28,
+        "SHA-256":     32,
+        "SHA-384":     48,
+        "SHA-512":     64,
+        "SHA-512/224": 28,
+        "SHA-512/256": 32,
+        "SHA3-224":    28,
+        "SHA3-256":    32,
+        "SHA3-384":    48,
+        "SHA3-512":    64,
+}
+# Hash of the CAVP SHA-1 and SHA-2 files, told apart by their digest length
+HASH_LENGTHS = {20: "SHA-1", 28: "SHA-224", 32: "SHA-256", 48: "SHA-384", 64: "SHA-512"}
+
+# Hash of the Wycheproof HMAC algorithms, e.g. HMACSHA512/224 or HMACSHA3-256
+HMAC_HASHES = {
+        "HMACSHA1":       "SHA-1",
+        "HMACSHA224":     "SHA-224",
+        "HMACSHA256":     "SHA-256",
+        "HMACSHA384":     "SHA-384",
+        "HMACSHA512":     "SHA-512",
+        "HMACSHA512/224": "SHA-512/224",
+        "HMACSHA512/256": "SHA-512/256",
+        "HMACSHA3-224":   "SHA3-224",
+        "HMACSHA3-256":   "SHA3-256",
+        "HMACSHA3-384":   "SHA3-384",
+        "HMACSHA3-512":   "SHA3-512",
+}
+
+ALG_HMAC_BASE = 0x03800000
+ALG_CBC_PKCS7 = 0x04404100
+ALG_CCM = 0x05500100
+ALG_GCM = 0x05500200
+ALG_CHACHA20_POLY1305 = 0x05100500
+ALG_ECDSA_BASE = 0x06000600
+ALG_PURE_EDDSA = 0x06000800
+ALG_LENGTH_MASK = 0x003f0000
+ALG_LENGTH_OFFSET = 16
+
+KEY_TYPE_HMAC = 0x1100
+KEY_TYPE_AES = 0x2400
+KEY_TYPE_CHACHA20 = 0x2004
+KEY_TYPE_ECC_PUBLIC_KEY_BASE = 0x4100
+
+ECC_FAMILIES = {
+        "secp224r1":       (0x12, 28),
+        "secp256r1":       (0x12, 32),
+        "secp384r1":       (0x12, 48),
+        "secp521r1":       (0x12, 66),
+        "brainpoolP256r1": (0x30, 32),
+        "brainpoolP384r1": (0x30, 48),
+        "brainpoolP512r1": (0x30, 64),
+        "edwards25519":    (0x42, 32),
+}
+
+AEAD_ALGS = {
+        "AES-GCM":           (ALG_GCM, KEY_TYPE_AES, 16),
+        "AES-CCM":           (ALG_CCM, KEY_TYPE_AES, 16),
+        "CHACHA20-POLY1305": (ALG_CHACHA20_POLY1305, KEY_TYPE_CHACHA20, 16),
+}
+
+def with_length(alg, length):
+        return (alg & ~ALG_LENGTH_MASK) | (length << ALG_LENGTH_OFFSET)
+
+def pack_field(data):
+        padding = (4 - (len(data) % 4)) % 4
+        return struct.pack("<I", len(data)) + data + (b"\0" * padding)
+
+def pack_record(kind, flags, vector_id, alg, key_type, key=b"", iv=b"", aad=b"",
+                input=b"", output=b""):
+        fields = b"".join(pack_field(field) for field in (key, iv, aad, input, output))
+        size = 20 + len(fields)
+        return struct.pack("<IHHIII", size, kind, flags, vector_id, alg, key_type) + fields
+
+def wycheproof_flags(test):
+        return FLAG_INVALID if (test["result"] == "invalid") else 0
+
+def der_length(der, offset):
+        # DER length at offset as (length, offset of the contents), None if it
+        # is not in its shortest form
+        if (offset >= len(der)):
+                return None
+        if (der[offset] < 0x80):
+                return der[offset], offset + 1
+        # Long form, one length byte is enough for any ECDSA signature
+        if (der[offset] != 0x81 or offset + 1 >= len(der) or der[offset + 1] < 0x80):
+                return None
+        return der[offset + 1], offset + 2
+
+def der_to_raw(der, size):
+        # ECDSA-Sig-Value ::= SEQUENCE { r INTEGER, s INTEGER } in strict DER,
+        # None if malformed or not canonical: BER lengths, negative or
+        # zero-padded integers would not survive a conversion to the raw form
+        if (len(der) < 2 or der[0] != 0x30):
+                return None
+        header = der_length(der, 1)
+        if (header is None or header[0] != len(der) - header[1]):
+                return None
+        values = []
+        offset = header[1]
+        for i in range(2):
+                if (offset >= len(der) or der[offset] != 0x02):
+                        return None
+                header = der_length(der, offset + 1)
+                if (header is None):
+                        return None
+                length, offset = header
+                value = der[offset:offset + length]
+                if (length == 0 or len(value) != length or value[0] & 0x80):
+                        return None
+                if (length > 1 and value[0] == 0):
+                        if (not value[1] & 0x80):
+                                return None
+                        value = value[1:]
+                if (len(value) > size):
+                        return None
+                values.append(value.rjust(size, b"\0"))
+                offset += length
+        if (offset != len(der)):
+                return None
+        return values[0] + values[1]
+
+def pack_wycheproof(document):
+        records = []
+        algorithm = document.get("algorithm", "")
+        schema = document.get("schema", "")
+        if (algorithm.startswith("HMAC") and algorithm not in HMAC_HASHES):
+                print("%s: unsupported hash, skipped" % algorithm)
+                return records
+        for group in document["testGroups"]:
+                for test in group["tests"]:
+                        if (test["result"] == "acceptable"):
+                                continue
+                        flags = wycheproof_flags(test)
+                        tc_id = test["tcId"]
+                        unhex = lambda name: bytes.fromhex(test.get(name, ""))
+
+                        if (algorithm.startswith("HMAC")):
+                                hash_name = HMAC_HASHES[algorithm]
+                                alg = ALG_HMAC_BASE | (HASH_ALGS[hash_name] & 0xff)
+                                tag = unhex("tag")
+                                if (group["tagSize"] // 8 != HASH_LENGTH_BYTES[hash_name]):
+                                        alg = with_length(alg, group["tagSize"] // 8)
+                                records.append(pack_record(KIND_MAC, flags, tc_id, alg,
+                                                           KEY_TYPE_HMAC, key=unhex("key"),
+                                                           input=unhex("msg"), output=tag))
+                        elif (algorithm == "AES-CBC-PKCS5"):
+                                records.append(pack_record(KIND_CIPHER, flags, tc_id,
+                                                           ALG_CBC_PKCS7, KEY_TYPE_AES,
+                                                           key=unhex("key"), iv=unhex("iv"),
+                                                           input=unhex("msg"),
+                                                           output=unhex("ct")))
+                        elif (algorithm in AEAD_ALGS):
+                                alg, key_type, default_tag = AEAD_ALGS[algorithm]
+                                if (group["tagSize"] // 8 != default_tag):
+                                        alg = with_length(alg, group["tagSize"] // 8)
+                                records.append(pack_record(KIND_AEAD, flags, tc_id, alg,
+                                                           key_type, key=unhex("key"),
+                                                           iv=unhex("iv"), aad=unhex("aad"),
+                                                           input=unhex("msg"),
+                                                           output=unhex("ct") + unhex("tag")))
+                        elif (algorithm in ("ECDSA", "EDDSA")):
+                                key = group.get("publicKey", group.get("key"))
+                                family, size = ECC_FAMILIES.get(key["curve"], (None, 0))
+                                if (family is None):
+                                        continue
+                                signature = unhex("sig")
+                                if (algorithm == "EDDSA"):
+                                        alg = ALG_PURE_EDDSA
+                                        public = bytes.fromhex(key["pk"])
+                                else:
+                                        alg = ALG_ECDSA_BASE | (HASH_ALGS[group["sha"]] & 0xff)
+                                        public = bytes.fromhex(key["uncompressed"])
+                                        if ("p1363" not in schema):
+                                                signature = der_to_raw(signature, size)
+                                                if (signature is None):
+                                                        # Malformed or non-canonical DER,
+                                                        # no raw form to give PSA
+                                                        continue
+                                records.append(pack_record(KIND_VERIFY, flags, tc_id, alg,
+                                                           KEY_TYPE_ECC_PUBLIC_KEY_BASE | family,
+                                                           key=public, input=unhex("msg"),
+                                                           output=signature))
+                        else:
+                                raise ValueError("unsupported Wycheproof algorithm '%s'" %
+                                                 algorithm)
+        return records
+
+def pack_cavp_hash(path, text):
+        records = []
+        name = os.path.basename(path).upper()
+        hash_name = None
+        for prefix, candidate in (("SHA512_224", "SHA-512/224"), ("SHA512_256", "SHA-512/256"),
+                                  ("SHA3_224", "SHA3-224"), ("SHA3_256", "SHA3-256"),
+                                  ("SHA3_384", "SHA3-384"), ("SHA3_512", "SHA3-512")):
+                if (name.startswith(prefix)):
+                        hash_name = candidate
+        length = None
+        message = None
+        count = 0
+        for line in text.splitlines():
+                match = re.match(r"\s*(\w+)\s*=\s*(\w*)", line)
+                if (not match):
+                        continue
+                field, value = match.groups()
+                if (field == "Len"):
+                        length = int(value)
+                elif (field == "Msg"):
+                        message = bytes.fromhex(value)
+                elif (field == "MD" and length is not None and length % 8 == 0):
+                        digest = bytes.fromhex(value)
+                        alg = HASH_ALGS[hash_name or HASH_LENGTHS[len(digest)]]
+                        records.append(pack_record(KIND_HASH, 0, count, alg, 0,
+                                                   input=message[:length // 8], output=digest))
+                        count += 1
+        return records
+
+if (len(sys.argv) < 3):
+        print("\nUsage: pack_vectors.py <corpus file> <Wycheproof .json or CAVP .rsp file>...")
+        sys.exit(1)
+
+records = []
+for path in sys.argv[2:]:
+        with open(path) as source:
+                text = source.read()
+        if (path.endswith(".json")):
+                packed = pack_wycheproof(json.loads(text))
+        else:
+                packed = pack_cavp_hash(path, text)
+        print("%s: %d vectors" % (path, len(packed)))
+        records += packed
+
+with open(sys.argv[1], "wb") as corpus:
+        corpus.write(struct.pack("<IHHII", VECTORS_MAGIC, VECTORS_VERSION, 16, len(records), 0))
+        for record in records:
+                corpus.write(record)
+print("%s: %d vectors" % (sys.argv[1], len(records)))
@@ -87,6 +87,7 @@
 #define VAL_CRYPTO_BASE                        1
 #define VAL_STORAGE_BASE                       2
 #define VAL_INITIAL_ATTESTATION_BASE           3
+#define VAL_BENCH_CRYPTO_BASE                  4
 
 #define VAL_GET_COMP_NUM(test_id)      \
    ((test_id - (test_id % VAL_MAX_TEST_PER_COMP)) / VAL_MAX_TEST_PER_COMP)
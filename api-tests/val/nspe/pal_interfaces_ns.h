@@ -22,6 +22,10 @@
 #include "val_client_defs.h"
 #include <stdarg.h>
 
+#ifdef CRYPTO
+#include "pal_crypto_api.h"
+#endif
+
 /**
     @brief    - This function initializes the UART
     @param    - uart base addr
@@ -82,12 +86,78 @@ int pal_nvmem_read_ns(addr_t base, uint32_t offset, void *buffer, int size);
 int pal_nvmem_write_ns(addr_t base, uint32_t offset, const void *buffer, int size);
 
 /**
- *   @brief    - This API will call the requested crypto function
- *   @param    - type    : function code
- *               valist  : variable argument list
- *   @return   - error status
+ *   @brief    - Reads a free running, monotonic timer
+ *   @param    - void
+ *   @return   - Current timer value in ticks
+**/
+uint64_t pal_timer_get_ticks(void);
+
+/**
+ *   @brief    - Returns the frequency of the timer read by pal_timer_get_ticks
+ *   @param    - void
+ *   @return   - Timer ticks per second, 0 if the platform has no such timer
+**/
+uint32_t pal_timer_get_freq(void);
+
+/**
+ *   @brief    - Returns the clock frequency of the CPU running the tests, used to
+ *               express benchmark results in CPU cycles
+ *   @param    - void
+ *   @return   - CPU frequency in kHz, 0 if not known
 **/
-int32_t pal_crypto_function(int type, va_list valist);
+uint32_t pal_cpu_get_freq_khz(void);
+
+/**
+ *   @brief    - Returns the number of threads the benchmark suites may run
+ *               concurrently to measure contention. The PSA implementation
+ *               under test must be thread safe.
+ *   @param    - void
+ *   @return   - Maximum number of threads, 0 if threads are not supported
+**/
+uint32_t pal_thread_get_max(void);
+
+/**
+ *   @brief    - Runs a function in concurrent threads and waits for all of them
+ *   @param    - count : Number of threads, at most pal_thread_get_max()
+ *               fn    : Function run by each thread, with the thread index
+ *               arg   : Argument passed to the function
+ *   @return   - SUCCESS/FAILURE
+**/
+int pal_thread_run(uint32_t count, pal_thread_fn_t fn, void *arg);
+
+/**
+ *   @brief    - Returns the external crypto test vector corpus, mapped in memory
+ *               (see val_vectors.h for its format)
+ *   @param    - data : Start of the corpus
+ *               size : Corpus size in bytes
+ *   @return   - SUCCESS/FAILURE, PAL_STATUS_UNSUPPORTED_FUNC if there is no corpus
+**/
+int pal_vectors_get(const uint8_t **data, uint32_t *size);
+
+/**
+ *   @brief    - Returns the length of the messages streamed through the multipart
+ *               crypto APIs by the large message benchmarks
+ *   @param    - size : Message length in bytes
+ *   @return   - SUCCESS/FAILURE, PAL_STATUS_UNSUPPORTED_FUNC if no length is set
+**/
+int pal_get_stream_size(uint64_t *size);
+
+/**
+ *   @brief    - Returns the format of the result records expected by the platform
+ *   @param    - void
+ *   @return   - pal_result_format_t, PAL_RESULT_FORMAT_NONE if there is no result sink
+**/
+uint32_t pal_result_get_format(void);
+
+/**
+ *   @brief    - Writes a result record to the platform result sink. A long
+ *               record may be written in several consecutive parts, the last
+ *               one ending with a new line.
+ *   @param    - record : Record data
+ *               size   : Record size in bytes
+ *   @return   - SUCCESS/FAILURE
+**/
+int pal_result_write(const char *record, uint32_t size);
 
 /**
  *   @brief    - This API will call the requested internal trusted storage function
@@ -142,6 +212,46 @@ void pal_set_custom_test_list(char *custom_test_list);
 **/
 bool_t pal_is_test_enabled(test_id_t test_id);
 
+/**
+ *   @brief    - Returns the shard of the enabled tests the platform executes
+ *   @param    - index : Returns the shard index, from 0 to count - 1
+ *               count : Returns the number of shards
+ *   @return   - SUCCESS, PAL_STATUS_UNSUPPORTED_FUNC if all enabled tests are executed
+**/
+int pal_get_test_shard(uint32_t *index, uint32_t *count);
+
+/**
+ *   @brief    - Returns the historical duration of a test, used to balance the shards
+ *   @param    - test_id : Test ID
+ *   @return   - Duration in micro seconds, 0 if unknown
+**/
+uint32_t pal_get_test_weight(test_id_t test_id);
+
+/**
+ *   @brief    - Returns the test repetition (soak) settings
+ *   @param    - repeat : Returns the repetition settings
+ *   @return   - SUCCESS, PAL_STATUS_UNSUPPORTED_FUNC if tests are run once
+**/
+int pal_get_test_repeat(pal_test_repeat_t *repeat);
+
+/**
+ *   @brief    - Returns the number of isolated workers the platform executes tests in
+ *   @return   - Zero if tests run sequentially in the VAL context, else worker count
+**/
+uint32_t pal_get_test_workers(void);
+
+/**
+ *   @brief    - Executes each test of the list in its own isolated context
+ *   @param    - test_ids : Tests to be executed
+ *               count    : Number of tests in test_ids
+ *               ops      : Callbacks to prepare the shared state, run a test and
+ *                          report an aborted test
+ *               results  : Returns the test state of each test
+ *   @return   - SUCCESS/FAILURE
+**/
+int pal_run_tests(const test_id_t *test_ids, uint32_t count,
+                  const pal_test_ops_t *ops, uint32_t *results);
+
 /**
  *   @brief    - initialize anything relavent to a platform
  *   @return   - TRUE/FALSE
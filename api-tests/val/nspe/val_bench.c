@@ -0,0 +1,634 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_bench.h"
+#include "val_dispatcher.h"
+#include "val_peripherals.h"
+#include "val_results.h"
+#include "val_histogram.h"
+#include "pal_interfaces_ns.h"
+
+/* Latencies of the operations of a latency sample */
+static val_histogram_t g_bench_histogram;
+
+/* Work shared with the threads of a multithreaded sample */
+typedef struct {
+    val_bench_op_t op;
+    void         **ctx;
+    uint32_t       iterations;
+    int32_t        status[VAL_BENCH_MAX_THREADS];
+} val_bench_threads_t;
+
+static val_bench_threads_t g_bench_threads;
+
+/* Seed of the streamed message. Byte n of the message is byte n % 8 (least
+ * significant first) of the SplitMix64 output for the counter n / 8, so that
+ * any part of the message can be generated on its own, e.g. by a host tool
+ * computing reference digests.
+ */
+#define VAL_BENCH_STREAM_SEED       0x5053415354524D31ULL
+
+/**
+    @brief    - Converts timer ticks into CPU cycles
+    @param    - ticks : Number of timer ticks
+    @return   - Number of CPU cycles, 0 if the CPU frequency is not known
+**/
+static uint64_t val_bench_ticks_to_cycles(uint64_t ticks)
+{
+    uint64_t timer_freq = pal_timer_get_freq();
+    uint64_t cpu_khz = pal_cpu_get_freq_khz();
+
+    if ((timer_freq == 0) || (cpu_khz == 0))
+    {
+        return 0;
+    }
+
+    /* Split, as ticks * frequency overflows for samples of a few seconds */
+    return ((ticks / timer_freq) * cpu_khz * 1000)
+           + ((((ticks % timer_freq) * cpu_khz) / timer_freq) * 1000);
+}
+
+/**
+    @brief    - Converts timer ticks into nano seconds
+    @param    - ticks : Number of timer ticks
+    @return   - Duration in nano seconds, 0 if there is no timer
+**/
+static uint64_t val_bench_ticks_to_ns(uint64_t ticks)
+{
+    uint64_t timer_freq = pal_timer_get_freq();
+
+    if (timer_freq == 0)
+    {
+        return 0;
+    }
+
+    return ((ticks / timer_freq) * 1000000000)
+           + (((ticks % timer_freq) * 1000000000) / timer_freq);
+}
+
+/**
+    @brief    - Derives the mean duration of one operation and, for a
+                multipart operation with a single-shot baseline, the overhead
+                of each update
+    @param    - sample : Measured sample
+    @return   - None
+**/
+static void val_bench_derive_latency(val_bench_sample_t *sample)
+{
+    uint64_t ns;
+    uint32_t ops = sample->iterations;
+    uint32_t chunks;
+    int64_t  overhead;
+
+    sample->ns_per_op = VAL_BENCH_UNKNOWN;
+    sample->chunk_overhead_ns = VAL_BENCH_NO_OVERHEAD;
+
+    if (sample->iterations == 0)
+    {
+        return;
+    }
+
+    /* Each thread of a multithreaded sample ran its share of the operations
+     * back to back over the whole duration
+     */
+    if (sample->threads > 1)
+    {
+        ops = sample->iterations / sample->threads;
+    }
+
+    ns = val_bench_ticks_to_ns(sample->ticks) / ops;
+    sample->ns_per_op = (ns < VAL_BENCH_UNKNOWN) ? (uint32_t)ns : (VAL_BENCH_UNKNOWN - 1);
+
+    if ((sample->chunk == 0) || (sample->baseline_ns == 0))
+    {
+        return;
+    }
+
+    chunks = (sample->size + sample->chunk - 1) / sample->chunk;
+    overhead = ((int64_t)sample->ns_per_op - sample->baseline_ns) / (int64_t)chunks;
+    if (overhead > 0x7FFFFFFF)
+    {
+        overhead = 0x7FFFFFFF;
+    }
+    else if (overhead < -0x7FFFFFFF)
+    {
+        overhead = -0x7FFFFFFF;
+    }
+    sample->chunk_overhead_ns = (int32_t)overhead;
+}
+
+/**
+    @brief    - Prints a value given in hundredths with two decimals
+    @param    - value : Value in 1/100, VAL_BENCH_UNKNOWN prints n/a
+    @return   - None
+**/
+static void val_bench_print_x100(uint32_t value)
+{
+    if (value == VAL_BENCH_UNKNOWN)
+    {
+        val_print(PRINT_TEST, "n/a", 0);
+        return;
+    }
+
+    val_print(PRINT_TEST, "%d.", (int32_t)(value / 100));
+    if ((value % 100) < 10)
+    {
+        val_print(PRINT_TEST, "0", 0);
+    }
+    val_print(PRINT_TEST, "%d", (int32_t)(value % 100));
+}
+
+/**
+    @brief    - Derives the throughput of a measured sample, then prints and
+                records it
+    @param    - sample : Measured sample
+    @return   - None
+**/
+static void val_bench_report(val_bench_sample_t *sample)
+{
+    uint64_t  bytes = (sample->stream_bytes != 0) ? sample->stream_bytes
+                                                  : (uint64_t)sample->size * sample->iterations;
+    uint64_t  cycles = val_bench_ticks_to_cycles(sample->ticks);
+    uint64_t  value;
+    uint32_t  us = val_timer_ticks_to_us(sample->ticks);
+    test_id_t test_id = VAL_INVALID_TEST_ID;
+
+    sample->mb_per_s_x100 = VAL_BENCH_UNKNOWN;
+    sample->cycles_per_byte_x100 = VAL_BENCH_UNKNOWN;
+
+    /* Bytes per micro second are MB/s */
+    if (us != 0)
+    {
+        value = (bytes * 100) / us;
+        sample->mb_per_s_x100 = (value < VAL_BENCH_UNKNOWN) ? (uint32_t)value
+                                                            : (VAL_BENCH_UNKNOWN - 1);
+    }
+
+    if ((cycles != 0) && (bytes != 0))
+    {
+        value = (cycles * 100) / bytes;
+        sample->cycles_per_byte_x100 = (value < VAL_BENCH_UNKNOWN) ? (uint32_t)value
+                                                                   : (VAL_BENCH_UNKNOWN - 1);
+    }
+
+    val_bench_derive_latency(sample);
+
+    if (sample->latency)
+    {
+        value = (us != 0) ? (((uint64_t)sample->iterations * 100000000) / us) : VAL_BENCH_UNKNOWN;
+        sample->ops_per_s_x100 = (value < VAL_BENCH_UNKNOWN) ? (uint32_t)value
+                                                             : (VAL_BENCH_UNKNOWN - 1);
+        sample->min_us = g_bench_histogram.min;
+        sample->median_us = val_histogram_percentile(&g_bench_histogram, 50);
+        sample->p99_us = val_histogram_percentile(&g_bench_histogram, 99);
+        sample->max_us = g_bench_histogram.max;
+    }
+
+    val_print(PRINT_TEST, "\t", 0);
+    val_print(PRINT_TEST, sample->op, 0);
+    val_print(PRINT_TEST, " ", 0);
+    val_print(PRINT_TEST, sample->alg_name, 0);
+    if (sample->variant != NULL)
+    {
+        val_print(PRINT_TEST, " (", 0);
+        val_print(PRINT_TEST, sample->variant, 0);
+        val_print(PRINT_TEST, ")", 0);
+    }
+    if (sample->stream_bytes != 0)
+    {
+        val_print(PRINT_TEST, " %d MiB stream", (int32_t)(sample->stream_bytes >> 20));
+        val_print(PRINT_TEST, " in %d byte updates", (int32_t)sample->size);
+    }
+    else
+    {
+        val_print(PRINT_TEST, " %d bytes", (int32_t)sample->size);
+    }
+    if (sample->chunk != 0)
+    {
+        val_print(PRINT_TEST, " in %d byte chunks", (int32_t)sample->chunk);
+    }
+    if (sample->load != 0)
+    {
+        val_print(PRINT_TEST, " under load %d", (int32_t)sample->load);
+    }
+    if (sample->threads != 0)
+    {
+        val_print(PRINT_TEST, " on %d thread(s)", (int32_t)sample->threads);
+    }
+    val_print(PRINT_TEST, ": ", 0);
+    if (sample->latency)
+    {
+        val_bench_print_x100(sample->ops_per_s_x100);
+        val_print(PRINT_TEST, " ops/s, latency min %d us", (int32_t)sample->min_us);
+        val_print(PRINT_TEST, ", median %d us", (int32_t)sample->median_us);
+        val_print(PRINT_TEST, ", p99 %d us", (int32_t)sample->p99_us);
+        val_print(PRINT_TEST, ", max %d us", (int32_t)sample->max_us);
+    }
+    else
+    {
+        val_bench_print_x100(sample->mb_per_s_x100);
+        val_print(PRINT_TEST, " MB/s, ", 0);
+        val_bench_print_x100(sample->cycles_per_byte_x100);
+        val_print(PRINT_TEST, " cycles/byte", 0);
+        if (sample->ns_per_op != VAL_BENCH_UNKNOWN)
+        {
+            val_print(PRINT_TEST, ", %d ns/op", (int32_t)sample->ns_per_op);
+        }
+    }
+    if (sample->chunk_overhead_ns != VAL_BENCH_NO_OVERHEAD)
+    {
+        val_print(PRINT_TEST, ", %d ns/chunk overhead", sample->chunk_overhead_ns);
+    }
+    val_print(PRINT_TEST, "\n", 0);
+
+    if (VAL_ERROR(val_nvmem_read(VAL_NVMEM_OFFSET(NV_TEST_ID_CURRENT),
+                                 &test_id, sizeof(test_id_t))))
+    {
+        test_id = VAL_INVALID_TEST_ID;
+    }
+    val_results_bench(test_id, sample);
+}
+
+/**
+    @brief    - Runs an optional untimed step of a sample
+    @param    - step : Step, NULL if none
+                ctx  : Context passed to the step
+    @return   - Status of the step, 0 if there is none
+**/
+static int32_t val_bench_step(val_bench_op_t step, void *ctx)
+{
+    return (step != NULL) ? step(ctx) : 0;
+}
+
+/**
+    @brief    - Measures the throughput of an operation. The operation is run
+                once untimed to warm up caches and lazy initializations, then
+                in batches of doubling size until the timed iterations last
+                VAL_BENCH_MIN_TIME_US or reach VAL_BENCH_MAX_ITERATIONS.
+                Latency samples time each operation instead of each batch,
+                for at least VAL_BENCH_MIN_LATENCY_OPS operations, between
+                their untimed setup and teardown steps, unless they use up
+                VAL_BENCH_MAX_LATENCY_TIME_US first. The watchdog is
+                reprogrammed before each operation or batch.
+    @param    - sample : Sample description, filled in with the measurement
+                op     : Operation to be measured
+                ctx    : Context passed to the operation
+    @return   - VAL_STATUS_SUCCESS, skip status if there is no timer or the
+                operation is not supported, VAL_STATUS_ERROR if it failed
+**/
+val_status_t val_bench_run(val_bench_sample_t *sample, val_bench_op_t op, void *ctx)
+{
+    uint32_t freq = pal_timer_get_freq();
+    uint64_t min_ticks, max_ticks, begin, start, elapsed;
+    uint32_t batch = 1;
+    uint32_t i;
+    int32_t  status;
+
+    sample->iterations = 0;
+    sample->ticks = 0;
+
+    if (freq == 0)
+    {
+        val_print(PRINT_TEST, "\tNo timer, throughput cannot be measured\n", 0);
+        return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+    }
+
+    if (VAL_ERROR(val_wd_reprogram_timer(WD_CRYPTO_TIMEOUT)))
+    {
+        return VAL_STATUS_ERROR;
+    }
+
+    status = val_bench_step(sample->setup, ctx);
+    if (status == 0)
+    {
+        status = op(ctx);
+        if (status == 0)
+        {
+            status = val_bench_step(sample->teardown, ctx);
+        }
+    }
+    if (status == PAL_STATUS_UNSUPPORTED_FUNC)
+    {
+        return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+    }
+
+    min_ticks = ((uint64_t)VAL_BENCH_MIN_TIME_US * freq) / 1000000;
+    max_ticks = ((uint64_t)VAL_BENCH_MAX_LATENCY_TIME_US * freq) / 1000000;
+    val_histogram_reset(&g_bench_histogram);
+    begin = val_timer_get_ticks();
+    while (sample->latency && (status == 0)
+           && ((sample->ticks < min_ticks) || (sample->iterations < VAL_BENCH_MIN_LATENCY_OPS))
+           && (sample->iterations < VAL_BENCH_MAX_ITERATIONS))
+    {
+        if ((sample->iterations != 0) && ((val_timer_get_ticks() - begin) >= max_ticks))
+        {
+            val_print(PRINT_INFO, "\tLatency sample time budget used up after %d operations\n",
+                      (int32_t)sample->iterations);
+            break;
+        }
+
+        if (VAL_ERROR(val_wd_reprogram_timer(WD_CRYPTO_TIMEOUT)))
+        {
+            return VAL_STATUS_ERROR;
+        }
+
+        status = val_bench_step(sample->setup, ctx);
+        if (status != 0)
+        {
+            break;
+        }
+
+        start = val_timer_get_ticks();
+        status = op(ctx);
+        elapsed = val_timer_get_ticks() - start;
+
+        sample->ticks += elapsed;
+        sample->iterations++;
+        val_histogram_add(&g_bench_histogram, val_timer_ticks_to_us(elapsed));
+
+        if (status == 0)
+        {
+            status = val_bench_step(sample->teardown, ctx);
+        }
+    }
+
+    while (!sample->latency && (status == 0) && (sample->ticks < min_ticks)
+           && (sample->iterations < VAL_BENCH_MAX_ITERATIONS))
+    {
+        if (VAL_ERROR(val_wd_reprogram_timer(WD_CRYPTO_TIMEOUT)))
+        {
+            return VAL_STATUS_ERROR;
+        }
+
+        start = val_timer_get_ticks();
+        for (i = 0; (i < batch) && (status == 0); i++)
+        {
+            status = op(ctx);
+        }
+        sample->ticks += val_timer_get_ticks() - start;
+        sample->iterations += i;
+
+        /* Double the total, the timer is read once per batch only */
+        batch = sample->iterations;
+        if (batch > (VAL_BENCH_MAX_ITERATIONS - sample->iterations))
+        {
+            batch = VAL_BENCH_MAX_ITERATIONS - sample->iterations;
+        }
+    }
+
+    if (status != 0)
+    {
+        val_print(PRINT_ERROR, "\tBenchmarked operation failed: %d\n", status);
+        return VAL_STATUS_ERROR;
+    }
+
+    val_bench_report(sample);
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Returns the number of threads a multithreaded sample can use
+    @param    - None
+    @return   - Maximum number of threads, 0 if the platform has no threads
+**/
+uint32_t val_bench_get_max_threads(void)
+{
+    uint32_t threads = pal_thread_get_max();
+
+    return (threads < VAL_BENCH_MAX_THREADS) ? threads : VAL_BENCH_MAX_THREADS;
+}
+
+/**
+    @brief    - Returns the length of the messages streamed by the benchmarks
+    @param    - size : Message length in bytes
+    @return   - VAL_STATUS_SUCCESS, VAL_STATUS_UNSUPPORTED if the platform
+                gives no length
+**/
+val_status_t val_bench_get_stream_size(uint64_t *size)
+{
+    if ((pal_get_stream_size(size) != PAL_STATUS_SUCCESS) || (*size == 0))
+    {
+        return VAL_STATUS_UNSUPPORTED;
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Generates a part of the streamed message
+    @param    - offset : Offset of the part in the message
+                buffer : Output buffer
+                length : Part length
+    @return   - None
+**/
+static void val_bench_stream_fill(uint64_t offset, uint8_t *buffer, size_t length)
+{
+    uint64_t word = 0;
+    size_t   i;
+
+    for (i = 0; i < length; i++, offset++)
+    {
+        if ((i == 0) || ((offset & 7) == 0))
+        {
+            word = VAL_BENCH_STREAM_SEED + ((offset >> 3) + 1) * 0x9E3779B97F4A7C15ULL;
+            word = (word ^ (word >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            word = (word ^ (word >> 27)) * 0x94D049BB133111EBULL;
+            word = word ^ (word >> 31);
+        }
+        buffer[i] = (uint8_t)(word >> ((offset & 7) * 8));
+    }
+}
+
+/**
+    @brief    - Measures the sustained throughput of a multipart operation,
+                fed a message of stream_bytes bytes in updates of size bytes.
+                The message is a seekable pseudo-random stream generated into
+                the buffer before each update, so that no buffer holds more
+                than one update. Only the updates are timed, the teardown
+                step of the sample runs untimed after each of them, e.g. to
+                digest the output. The watchdog is reprogrammed before each
+                update.
+    @param    - sample : Sample description, with the stream_bytes and size
+                         of the message and updates, filled in with the
+                         measurement
+                update : Update of the operation, set up by the caller
+                ctx    : Context passed to the update and teardown
+                buffer : Buffer of at least size bytes for the message
+    @return   - VAL_STATUS_SUCCESS, skip status if there is no timer,
+                VAL_STATUS_ERROR if an update failed
+**/
+val_status_t val_bench_stream(val_bench_sample_t *sample, val_bench_update_t update, void *ctx,
+                              uint8_t *buffer)
+{
+    uint64_t offset, start;
+    size_t   length;
+    int32_t  status = 0;
+
+    sample->iterations = 0;
+    sample->ticks = 0;
+
+    if (pal_timer_get_freq() == 0)
+    {
+        val_print(PRINT_TEST, "\tNo timer, throughput cannot be measured\n", 0);
+        return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+    }
+
+    for (offset = 0; (offset < sample->stream_bytes) && (status == 0); offset += length)
+    {
+        length = sample->size;
+        if ((sample->stream_bytes - offset) < length)
+        {
+            length = (size_t)(sample->stream_bytes - offset);
+        }
+        val_bench_stream_fill(offset, buffer, length);
+
+        if (VAL_ERROR(val_wd_reprogram_timer(WD_CRYPTO_TIMEOUT)))
+        {
+            return VAL_STATUS_ERROR;
+        }
+
+        start = val_timer_get_ticks();
+        status = update(ctx, buffer, length);
+        sample->ticks += val_timer_get_ticks() - start;
+        sample->iterations++;
+
+        if (status == 0)
+        {
+            status = val_bench_step(sample->teardown, ctx);
+        }
+    }
+
+    if (status != 0)
+    {
+        val_print(PRINT_ERROR, "\tStreamed operation failed: %d", status);
+        val_print(PRINT_ERROR, " at MiB %d\n", (int32_t)(offset >> 20));
+        return VAL_STATUS_ERROR;
+    }
+
+    val_bench_report(sample);
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Thread function of a multithreaded sample, runs the operation
+                back to back on the context of the thread
+    @param    - arg   : val_bench_threads_t work
+                index : Thread index
+    @return   - None
+**/
+static void val_bench_thread(void *arg, uint32_t index)
+{
+    val_bench_threads_t *work = (val_bench_threads_t *)arg;
+    uint32_t             i;
+    int32_t              status = 0;
+
+    for (i = 0; (i < work->iterations) && (status == 0); i++)
+    {
+        status = work->op(work->ctx[index]);
+    }
+    work->status[index] = status;
+}
+
+/**
+    @brief    - Measures the aggregate throughput of an operation run in
+                several threads at once, e.g. to expose lock contention in the
+                implementation. The operation is run once per context untimed,
+                one context after the other in the VAL context, then all
+                threads run the same number of back to back operations,
+                doubled until the slowest thread lasts VAL_BENCH_MIN_TIME_US.
+                The sample reports the aggregate throughput and the mean
+                duration of one operation as seen by each thread. Latency
+                samples and their setup and teardown steps are not supported.
+    @param    - sample  : Sample description, filled in with the measurement
+                op      : Operation to be measured, must be thread safe
+                ctx     : Context of each thread, threads entries
+                threads : Number of threads, at most val_bench_get_max_threads()
+    @return   - VAL_STATUS_SUCCESS, skip status if there is no timer, no
+                threads or the operation is not supported, VAL_STATUS_ERROR if
+                it failed
+**/
+val_status_t val_bench_run_threads(val_bench_sample_t *sample, val_bench_op_t op, void **ctx,
+                                   uint32_t threads)
+{
+    uint32_t freq = pal_timer_get_freq();
+    uint64_t min_ticks, start;
+    uint32_t i;
+    int32_t  status = 0;
+
+    sample->iterations = 0;
+    sample->ticks = 0;
+    sample->threads = threads;
+
+    if (freq == 0)
+    {
+        val_print(PRINT_TEST, "\tNo timer, throughput cannot be measured\n", 0);
+        return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+    }
+
+    if ((threads == 0) || (threads > val_bench_get_max_threads()) || sample->latency)
+    {
+        return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+    }
+
+    for (i = 0; (i < threads) && (status == 0); i++)
+    {
+        status = op(ctx[i]);
+    }
+    if (status == PAL_STATUS_UNSUPPORTED_FUNC)
+    {
+        return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+    }
+
+    min_ticks = ((uint64_t)VAL_BENCH_MIN_TIME_US * freq) / 1000000;
+    g_bench_threads.op = op;
+    g_bench_threads.ctx = ctx;
+    g_bench_threads.iterations = 1;
+    while (status == 0)
+    {
+        memset(g_bench_threads.status, 0, sizeof(g_bench_threads.status));
+
+        start = val_timer_get_ticks();
+        if (pal_thread_run(threads, val_bench_thread, &g_bench_threads) != PAL_STATUS_SUCCESS)
+        {
+            val_print(PRINT_ERROR, "\tCannot run %d threads\n", threads);
+            return VAL_STATUS_ERROR;
+        }
+        sample->ticks = val_timer_get_ticks() - start;
+        sample->iterations = g_bench_threads.iterations * threads;
+
+        for (i = 0; (i < threads) && (status == 0); i++)
+        {
+            status = g_bench_threads.status[i];
+        }
+
+        if ((sample->ticks >= min_ticks)
+            || (sample->iterations > (VAL_BENCH_MAX_ITERATIONS / 2)))
+        {
+            break;
+        }
+        g_bench_threads.iterations *= 2;
+    }
+
+    if (status != 0)
+    {
+        val_print(PRINT_ERROR, "\tBenchmarked operation failed: %d\n", status);
+        return VAL_STATUS_ERROR;
+    }
+
+    val_bench_report(sample);
+    return VAL_STATUS_SUCCESS;
+}
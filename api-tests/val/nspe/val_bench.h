@@ -0,0 +1,140 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _VAL_BENCH_H_
+#define _VAL_BENCH_H_
+
+#include "val.h"
+
+/* Throughput measurement for the benchmark suites. An operation processing a
+ * fixed number of bytes is run back to back until the timed iterations last at
+ * least VAL_BENCH_MIN_TIME_US, then the throughput is printed and recorded as a
+ * "bench" result record. MB are 10^6 bytes. Long operations, such as
+ * asymmetric signatures, can also be timed one by one for their operation
+ * rate and latency distribution, or run in several threads at once for the
+ * aggregate throughput under contention, or fed a multi-gigabyte message in
+ * updates for the sustained throughput of a multipart operation.
+ */
+
+/* Minimum duration of the timed iterations of a sample */
+#ifndef VAL_BENCH_MIN_TIME_US
+#define VAL_BENCH_MIN_TIME_US       100000
+#endif
+
+/* Minimum number of timed operations of a latency sample, for slow
+ * operations such as RSA key generation
+ */
+#ifndef VAL_BENCH_MIN_LATENCY_OPS
+#define VAL_BENCH_MIN_LATENCY_OPS   10
+#endif
+
+/* Time budget of a latency sample, setup and teardown included. A slow
+ * operation stops short of VAL_BENCH_MIN_LATENCY_OPS once it is used up
+ */
+#ifndef VAL_BENCH_MAX_LATENCY_TIME_US
+#define VAL_BENCH_MAX_LATENCY_TIME_US 10000000
+#endif
+
+/* Maximum number of threads of a multithreaded sample, set by the targets
+ * with threads in pal_crypto_config.h. It sizes the per-thread state of the
+ * VAL and the benchmarks.
+ */
+#ifdef ARCH_TEST_BENCH_MAX_THREADS
+#define VAL_BENCH_MAX_THREADS       ARCH_TEST_BENCH_MAX_THREADS
+#else
+#define VAL_BENCH_MAX_THREADS       1
+#endif
+
+#if VAL_BENCH_MAX_THREADS < 1
+#error "ARCH_TEST_BENCH_MAX_THREADS must be at least 1"
+#endif
+
+/* Iteration cap, for operations faster than the timer resolution */
+#define VAL_BENCH_MAX_ITERATIONS    0x100000
+
+/* Value of the derived metrics which cannot be computed on the platform */
+#define VAL_BENCH_UNKNOWN           0xFFFFFFFF
+
+/* Chunk overhead of samples which are not a multipart operation compared to
+ * a single-shot one
+ */
+#define VAL_BENCH_NO_OVERHEAD       ((int32_t)0x80000000)
+
+/* Operation under measurement, returns 0 on success */
+typedef int32_t (*val_bench_op_t)(void *ctx);
+
+/* Update of a streamed operation, fed with the next length bytes of the
+ * message, returns 0 on success
+ */
+typedef int32_t (*val_bench_update_t)(void *ctx, const uint8_t *data, size_t length);
+
+/* Benchmark sample. The caller describes the operation, val_bench_run fills
+ * in the measurement. A multipart operation feeding size bytes in updates of
+ * chunk bytes can be given the duration of the equivalent single-shot
+ * operation, to derive the overhead of each update.
+ */
+typedef struct {
+    const char *op;                   /* Measured API, e.g. "hash_compute" */
+    const char *alg_name;             /* Algorithm name, e.g. "SHA_256" */
+    const char *variant;              /* Operation variant, e.g. "persistent",
+                                         NULL if none */
+    uint32_t    alg;                  /* PSA algorithm identifier */
+    uint32_t    key_bits;             /* Key size, 0 for keyless operations */
+    uint32_t    size;                 /* Bytes processed by one operation */
+    uint64_t    stream_bytes;         /* Message length of a streamed sample,
+                                         fed in updates of size bytes. 0 if
+                                         the sample is not streamed. */
+    uint32_t    chunk;                /* Update size, 0 for a single-shot operation */
+    uint32_t    load;                 /* Load the operation runs under, e.g. the
+                                         number of live keys, 0 if none */
+    uint32_t    threads;              /* Threads running the operation at once,
+                                         0 in the VAL context only. Set by
+                                         val_bench_run_threads. */
+    uint32_t    baseline_ns;          /* Single-shot duration, 0 if not known */
+    bool_t      latency;              /* Time each operation for the latency
+                                         distribution */
+    val_bench_op_t setup;             /* Run untimed before and after each */
+    val_bench_op_t teardown;          /* operation of a latency sample, e.g.
+                                         to create and destroy a key, or
+                                         after each update of a streamed
+                                         sample (teardown only). NULL if
+                                         none. */
+    uint32_t    iterations;           /* Number of timed operations */
+    uint64_t    ticks;                /* Duration of the timed operations */
+    uint32_t    mb_per_s_x100;        /* Throughput in 1/100 MB/s */
+    uint32_t    cycles_per_byte_x100; /* CPU cycles per byte in 1/100 */
+    uint32_t    ns_per_op;            /* Mean duration of one operation, as seen
+                                         by each thread */
+    int32_t     chunk_overhead_ns;    /* Extra duration of each update over the
+                                         single-shot operation */
+    uint32_t    ops_per_s_x100;       /* Operations per second in 1/100, latency
+                                         samples only */
+    uint32_t    min_us;               /* Latency distribution of the operations, */
+    uint32_t    median_us;            /* latency samples only. Median and p99 */
+    uint32_t    p99_us;               /* are histogram estimates within 1/32 */
+    uint32_t    max_us;               /* of the value. */
+} val_bench_sample_t;
+
+/* prototypes */
+val_status_t val_bench_run(val_bench_sample_t *sample, val_bench_op_t op, void *ctx);
+val_status_t val_bench_run_threads(val_bench_sample_t *sample, val_bench_op_t op, void **ctx,
+                                   uint32_t threads);
+uint32_t val_bench_get_max_threads(void);
+val_status_t val_bench_get_stream_size(uint64_t *size);
+val_status_t val_bench_stream(val_bench_sample_t *sample, val_bench_update_t update, void *ctx,
+                              uint8_t *buffer);
+#endif /* _VAL_BENCH_H_ */
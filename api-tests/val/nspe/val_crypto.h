@@ -53,97 +53,4 @@
 #define SYS_ACS_ALG_INVALID                 0xFFFFFFFF
 #define SYS_ACS_KEY_DERIVATION_STEP_INVALID 0x0000FFFF
 
-enum crypto_function_code {
-    VAL_CRYPTO_AEAD_ABORT                        = 0x1,
-    VAL_CRYPTO_AEAD_DECRYPT,
-    VAL_CRYPTO_AEAD_DECRYPT_SETUP,
-    VAL_CRYPTO_AEAD_ENCRYPT,
-    VAL_CRYPTO_AEAD_ENCRYPT_SETUP,
-    VAL_CRYPTO_AEAD_FINISH,
-    VAL_CRYPTO_AEAD_GENERATE_NONCE,
-    VAL_CRYPTO_AEAD_OPERATION_INIT,
-    VAL_CRYPTO_AEAD_SET_LENGTHS,
-    VAL_CRYPTO_AEAD_SET_NONCE,
-    VAL_CRYPTO_AEAD_UPDATE,
-    VAL_CRYPTO_AEAD_UPDATE_AD,
-    VAL_CRYPTO_AEAD_VERIFY,
-    VAL_CRYPTO_ASYMMETRIC_DECRYPT,
-    VAL_CRYPTO_ASYMMETRIC_ENCRYPT,
-    VAL_CRYPTO_CIPHER_ABORT,
-    VAL_CRYPTO_CIPHER_DECRYPT,
-    VAL_CRYPTO_CIPHER_DECRYPT_SETUP,
-    VAL_CRYPTO_CIPHER_ENCRYPT,
-    VAL_CRYPTO_CIPHER_ENCRYPT_SETUP,
-    VAL_CRYPTO_CIPHER_FINISH,
-    VAL_CRYPTO_CIPHER_GENERATE_IV,
-    VAL_CRYPTO_CIPHER_OPERATION_INIT,
-    VAL_CRYPTO_CIPHER_SET_IV,
-    VAL_CRYPTO_CIPHER_UPDATE,
-    VAL_CRYPTO_COPY_KEY,
-    VAL_CRYPTO_INIT,
-    VAL_CRYPTO_DESTROY_KEY,
-    VAL_CRYPTO_EXPORT_KEY,
-    VAL_CRYPTO_EXPORT_PUBLIC_KEY,
-    VAL_CRYPTO_GENERATE_KEY,
-    VAL_CRYPTO_GENERATE_RANDOM,
-    VAL_CRYPTO_GET_KEY_ALGORITHM,
-    VAL_CRYPTO_GET_KEY_ATTRIBUTES,
-    VAL_CRYPTO_GET_KEY_BITS,
-    VAL_CRYPTO_GET_KEY_ID,
-    VAL_CRYPTO_GET_KEY_LIFETIME,
-    VAL_CRYPTO_GET_KEY_TYPE,
-    VAL_CRYPTO_GET_KEY_USAGE_FLAGS,
-    VAL_CRYPTO_HASH_ABORT,
-    VAL_CRYPTO_HASH_CLONE,
-    VAL_CRYPTO_HASH_COMPARE,
-    VAL_CRYPTO_HASH_COMPUTE,
-    VAL_CRYPTO_HASH_FINISH,
-    VAL_CRYPTO_HASH_OPERATION_INIT,
-    VAL_CRYPTO_HASH_RESUME,
-    VAL_CRYPTO_HASH_SETUP,
-    VAL_CRYPTO_HASH_SUSPEND,
-    VAL_CRYPTO_HASH_UPDATE,
-    VAL_CRYPTO_HASH_VERIFY,
-    VAL_CRYPTO_IMPORT_KEY,
-    VAL_CRYPTO_KEY_ATTRIBUTES_INIT,
-    VAL_CRYPTO_KEY_DERIVATION_ABORT,
-    VAL_CRYPTO_KEY_DERIVATION_GET_CAPACITY,
-    VAL_CRYPTO_KEY_DERIVATION_INPUT_BYTES,
-    VAL_CRYPTO_KEY_DERIVATION_INPUT_INTEGER,
-    VAL_CRYPTO_KEY_DERIVATION_INPUT_KEY,
-    VAL_CRYPTO_KEY_DERIVATION_KEY_AGREEMENT,
-    VAL_CRYPTO_KEY_DERIVATION_OPERATION_INIT,
-    VAL_CRYPTO_KEY_DERIVATION_OUTPUT_BYTES,
-    VAL_CRYPTO_KEY_DERIVATION_OUTPUT_KEY,
-    VAL_CRYPTO_KEY_DERIVATION_VERIFY_BYTES,
-    VAL_CRYPTO_KEY_DERIVATION_VERIFY_KEY,
-    VAL_CRYPTO_KEY_DERIVATION_SET_CAPACITY,
-    VAL_CRYPTO_KEY_DERIVATION_SETUP,
-    VAL_CRYPTO_MAC_ABORT,
-    VAL_CRYPTO_MAC_COMPUTE,
-    VAL_CRYPTO_MAC_OPERATION_INIT,
-    VAL_CRYPTO_MAC_SIGN_FINISH,
-    VAL_CRYPTO_MAC_SIGN_SETUP,
-    VAL_CRYPTO_MAC_UPDATE,
-    VAL_CRYPTO_MAC_VERIFY,
-    VAL_CRYPTO_MAC_VERIFY_FINISH,
-    VAL_CRYPTO_MAC_VERIFY_SETUP,
-    VAL_CRYPTO_PURGE_KEY,
-    VAL_CRYPTO_RAW_KEY_AGREEMENT,
-    VAL_CRYPTO_RESET_KEY_ATTRIBUTES,
-    VAL_CRYPTO_SET_KEY_ALGORITHM,
-    VAL_CRYPTO_SET_KEY_BITS,
-    VAL_CRYPTO_SET_KEY_ID,
-    VAL_CRYPTO_SET_KEY_LIFETIME,
-    VAL_CRYPTO_SET_KEY_TYPE,
-    VAL_CRYPTO_SET_KEY_USAGE_FLAGS,
-    VAL_CRYPTO_SIGN_HASH,
-    VAL_CRYPTO_SIGN_MESSAGE,
-    VAL_CRYPTO_VERIFY_HASH,
-    VAL_CRYPTO_VERIFY_MESSAGE,
-    VAL_CRYPTO_RESET                            = 0xF0,
-    VAL_CRYPTO_FREE                             = 0xFE,
-};
-
-int32_t val_crypto_function(int type, ...);
 #endif /* _VAL_CRYPTO_H_ */
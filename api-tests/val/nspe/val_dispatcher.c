@@ -21,6 +21,9 @@
 #include "val_interfaces.h"
 #include "val_peripherals.h"
 #include "val_target.h"
+#include "val_crypto.h"
+#include "val_results.h"
+#include "val_repeat.h"
 
 extern val_api_t val_api;
 extern psa_api_t psa_api;
@@ -65,6 +68,22 @@ static val_test_info_t g_test_list[] = {
                                   {VAL_INVALID_TEST_ID, NULL}
                               };
 
+#define VAL_TEST_LIST_SIZE    (sizeof(g_test_list)/sizeof(g_test_list[0]))
+
+/* Tests of g_test_list executed by this platform, see val_select_test_shard */
+static uint8_t  g_test_selected[VAL_TEST_LIST_SIZE];
+static uint8_t  g_test_selection_done;
+static uint8_t  g_test_shard_balanced;
+static uint32_t g_test_shard;
+static uint32_t g_test_shard_count;
+
+/* Pass over the test list in progress, when the whole list is repeated */
+static uint64_t g_list_pass_start;
+static uint32_t g_list_pass_state;
+
+/* Status of the first failed iteration of the repeated test in progress, 0 if none */
+static uint32_t g_repeat_fail_status;
+
 /**
     @brief        - This function returns the IDs list of available tests
     @param        - test_id_list : Buffer allocated by caller
@@ -96,6 +115,160 @@ size_t val_get_test_list(uint32_t *test_id_list, size_t size)
     return test_list_size;
 }
 
+/**
+    @brief        - This function splits the enabled tests into the number of shards
+                    given by the platform and selects the tests of the platform shard.
+                    Tests are balanced by their historical duration when the platform
+                    knows it, tests of unknown duration counting for the mean duration.
+                    Otherwise the enabled tests are dealt round-robin. The split only
+                    depends on the test list and on the platform data, so that every
+                    shard, and a run resumed after a reset, computes the same split.
+    @param        - None
+    @return       - Error code
+**/
+static val_status_t val_select_test_shard(void)
+{
+    static uint32_t  order[VAL_TEST_LIST_SIZE];
+    static uint32_t  weights[VAL_TEST_LIST_SIZE];
+    static uint64_t  loads[VAL_TEST_SHARD_MAX];
+    uint32_t         count = 0, known = 0, i, j, least, index;
+    uint64_t         total = 0;
+
+    g_test_selection_done = 1;
+    g_test_shard = 0;
+    g_test_shard_count = 0;
+
+    for (i = 0; g_test_list[i].test_id != VAL_INVALID_TEST_ID; i++)
+    {
+        g_test_selected[i] = pal_is_test_enabled(g_test_list[i].test_id) ? 1 : 0;
+        if (g_test_selected[i])
+        {
+            order[count++] = i;
+        }
+    }
+
+    if ((pal_get_test_shard(&g_test_shard, &g_test_shard_count) != PAL_STATUS_SUCCESS)
+        || (g_test_shard_count <= 1))
+    {
+        g_test_shard_count = 0;
+        return VAL_STATUS_SUCCESS;
+    }
+
+    if ((g_test_shard_count > VAL_TEST_SHARD_MAX) || (g_test_shard >= g_test_shard_count))
+    {
+        val_print(PRINT_ERROR, "\n\tInvalid test shard count %d", g_test_shard_count);
+        return VAL_STATUS_INVALID;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        weights[i] = pal_get_test_weight(g_test_list[order[i]].test_id);
+        if (weights[i])
+        {
+            known++;
+            total += weights[i];
+        }
+    }
+
+    g_test_shard_balanced = (known > 0) ? 1 : 0;
+    if (!g_test_shard_balanced)
+    {
+        for (i = 0; i < count; i++)
+        {
+            g_test_selected[order[i]] = ((i % g_test_shard_count) == g_test_shard) ? 1 : 0;
+        }
+        return VAL_STATUS_SUCCESS;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        if (!weights[i])
+        {
+            weights[i] = (uint32_t)(total / known);
+        }
+    }
+
+    /* Longest tests first, list order for equal durations */
+    for (i = 1; i < count; i++)
+    {
+        for (j = i; (j > 0) && (weights[j] > weights[j - 1]); j--)
+        {
+            index = order[j];
+            order[j] = order[j - 1];
+            order[j - 1] = index;
+            index = weights[j];
+            weights[j] = weights[j - 1];
+            weights[j - 1] = index;
+        }
+    }
+
+    /* Each test goes to the least loaded shard, the lowest one on a tie */
+    memset(loads, 0, sizeof(loads));
+    for (i = 0; i < count; i++)
+    {
+        least = 0;
+        for (j = 1; j < g_test_shard_count; j++)
+        {
+            if (loads[j] < loads[least])
+            {
+                least = j;
+            }
+        }
+        loads[least] += weights[i];
+        g_test_selected[order[i]] = (least == g_test_shard) ? 1 : 0;
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief        - This function tells if a test of the test list is to be executed
+    @param        - test_info : Test list entry
+    @return       - TRUE/FALSE
+**/
+static bool_t val_is_test_selected(val_test_info_t *test_info)
+{
+    return g_test_selected[test_info - &g_test_list[0]];
+}
+
+/**
+    @brief        - This function prints the tests of the platform shard, so that
+                    the union of all shards can be checked against the test list
+    @param        - None
+    @return       - None
+**/
+static void val_print_shard_manifest(void)
+{
+    val_test_info_t *test_info = &g_test_list[0];
+    uint32_t         count = 0;
+
+    if (g_test_shard_count == 0)
+    {
+        return;
+    }
+
+    for (; test_info->test_id != VAL_INVALID_TEST_ID; test_info++)
+    {
+        count += val_is_test_selected(test_info);
+    }
+
+    val_print(PRINT_ALWAYS, "\nTest shard %d", g_test_shard + 1);
+    val_print(PRINT_ALWAYS, "/%d", g_test_shard_count);
+    val_print(PRINT_ALWAYS, g_test_shard_balanced ? " (balanced by duration)"
+                                                  : " (round-robin)", 0);
+    val_print(PRINT_ALWAYS, ", %d tests :", count);
+
+    for (test_info = &g_test_list[0]; test_info->test_id != VAL_INVALID_TEST_ID; test_info++)
+    {
+        if (val_is_test_selected(test_info))
+        {
+            val_print(PRINT_ALWAYS, " %d", test_info->test_id);
+            val_results_shard(test_info->test_id, g_test_shard + 1, g_test_shard_count);
+        }
+    }
+    val_print(PRINT_ALWAYS, "\n", 0);
+}
+
 /**
     @brief        - This function reads the test ELFs from RAM or secondary storage and loads into
                     system memory
@@ -106,6 +279,16 @@ size_t val_get_test_list(uint32_t *test_id_list, size_t size)
 val_status_t val_test_load(test_id_t *test_id, test_id_t test_id_prev)
 {
     val_test_info_t *test_info = &g_test_list[0];
+    val_status_t     status;
+
+    if (!g_test_selection_done)
+    {
+        status = val_select_test_shard();
+        if (VAL_ERROR(status))
+        {
+            return status;
+        }
+    }
 
     if (test_id_prev != VAL_INVALID_TEST_ID)
     {
@@ -121,7 +304,7 @@ val_status_t val_test_load(test_id_t *test_id, test_id_t test_id_prev)
 
     for (; test_info->test_id != VAL_INVALID_TEST_ID; test_info++)
     {
-        if (pal_is_test_enabled(test_info->test_id))
+        if (val_is_test_selected(test_info))
         {
             *test_id = test_info->test_id;
             g_test_info_addr = (addr_t) test_info->entry_addr;
@@ -161,6 +344,26 @@ void val_execute_test_fn(void)
     return;
 }
 
+/**
+    @brief    - This function looks up the test info for the given test ID
+    @param    - test_id : Test ID
+    @return   - Test info, NULL if the test is not part of the test list
+**/
+static val_test_info_t *val_find_test(test_id_t test_id)
+{
+    val_test_info_t *test_info = &g_test_list[0];
+
+    for (; test_info->test_id != VAL_INVALID_TEST_ID; test_info++)
+    {
+        if (test_info->test_id == test_id)
+        {
+            return test_info;
+        }
+    }
+
+    return NULL;
+}
+
 /*
     @brief    - Reads the pre-defined component name against given test_id
     @param    - test_id  : Current Test ID
@@ -178,11 +381,404 @@ char *val_get_comp_name(test_id_t test_id)
             return "Storage Suite";
         case VAL_INITIAL_ATTESTATION_BASE:
             return "Attestation Suite";
+        case VAL_BENCH_CRYPTO_BASE:
+            return "Crypto Benchmark Suite";
         default:
             return "Unknown Suite";
     }
 }
 
+/**
+    @brief    - This function prints the suite banner when moving to a new component
+    @param    - test_id      : Test ID about to be executed
+                test_id_prev : Previously executed test ID
+    @return   - None
+**/
+static void val_print_suite_banner(test_id_t test_id, test_id_t test_id_prev)
+{
+    if (VAL_GET_COMP_NUM(test_id_prev) != VAL_GET_COMP_NUM(test_id))
+    {
+        val_print(PRINT_ALWAYS, "\nRunning.. ", 0);
+        val_print(PRINT_ALWAYS, val_get_comp_name(test_id), 0);
+	//	val_print_api_version();
+#ifdef TESTS_COVERAGE
+        val_print(PRINT_ALWAYS, "\nNOTE : Known failing tests are excluded from this \
+build. For PSA functional API certification, all tests must be run.\n", 0);
+#endif
+        val_print(PRINT_ALWAYS, "\n******************************************\n", 0);
+        val_results_suite_begin(test_id, test_id_prev);
+    }
+}
+
+/**
+    @brief    - This function warns about the keys created by the test which did
+                not fit in the tracked key set
+    @param    - None
+    @return   - None
+**/
+static void val_check_key_tracking(void)
+{
+#ifdef CRYPTO
+    uint32_t             untracked = pal_crypto_api.key_track_overflow();
+
+    if (untracked != 0)
+    {
+        val_print(PRINT_WARN, "\n\tKey tracking full, %d key(s) left in the key store",
+                  untracked);
+    }
+#endif
+}
+
+/**
+    @brief    - This function reports the result of the given test on the console
+                and to the result sink
+    @param    - test_id : Test ID
+    @return   - Test state
+**/
+static uint32_t val_report_test(test_id_t test_id)
+{
+    uint32_t             state;
+
+    val_check_key_tracking();
+    state = val_report_status();
+
+    val_results_test(test_id, state, val_get_status() & TEST_STATUS_MASK,
+                     val_get_test_duration());
+    return state;
+}
+
+/**
+    @brief    - This function ends an iteration of a repeated test without
+                reporting it, recording its state and duration for the summary
+                of the repetition
+    @param    - None
+    @return   - State of the iteration
+**/
+static uint32_t val_record_iteration(void)
+{
+    uint32_t             state = val_end_test();
+
+    if ((state != TEST_PASS) && (state != TEST_SKIP) && (g_repeat_fail_status == 0))
+    {
+        g_repeat_fail_status = val_get_status();
+    }
+    val_repeat_record(state, val_get_test_duration());
+    return state;
+}
+
+/**
+    @brief    - This function executes the loaded test, repeating it when each test
+                is to be repeated. The iterations are only recorded, the test is
+                reported once by val_report_repeated_test.
+    @param    - None
+    @return   - None
+**/
+static void val_execute_repeated_test(void)
+{
+    if (!val_repeat_enabled(PAL_TEST_REPEAT_TEST))
+    {
+        val_execute_test_fn();
+        return;
+    }
+
+    g_repeat_fail_status = 0;
+    val_repeat_begin();
+    val_execute_test_fn();
+
+    /* Skipped tests would only be skipped again */
+    while (!IS_TEST_SKIP(val_get_status()) && val_repeat_more())
+    {
+        (void)val_record_iteration();
+        val_execute_test_fn();
+    }
+}
+
+/**
+    @brief    - This function reports a test and, for a repeated test, the summary
+                of its iterations. A repeated test is reported once, with the
+                status of its first failed iteration if any iteration failed, and
+                the total duration of its iterations.
+    @param    - test_id : Test ID
+    @return   - Test state, failed if any iteration of a repeated test failed
+**/
+static uint32_t val_report_repeated_test(test_id_t test_id)
+{
+    uint32_t             state;
+
+    if (!val_repeat_enabled(PAL_TEST_REPEAT_TEST))
+    {
+        return val_report_test(test_id);
+    }
+
+    val_check_key_tracking();
+    state = val_record_iteration();
+    state = val_repeat_end(test_id, (g_repeat_fail_status != 0) ? TEST_FAIL : state);
+
+    if (g_repeat_fail_status != 0)
+    {
+        val_set_status(g_repeat_fail_status);
+        state = IS_TEST_PENDING(g_repeat_fail_status) ? TEST_PENDING : TEST_FAIL;
+    }
+    else if (state == TEST_FAIL)
+    {
+        /* Every iteration passed but the key store did not return to its baseline */
+        val_set_status(RESULT_FAIL(VAL_STATUS_ERROR));
+    }
+
+    val_print_status();
+    val_results_test(test_id, state, val_get_status() & TEST_STATUS_MASK,
+                     val_repeat_duration());
+    return state;
+}
+
+/**
+    @brief    - This function ends a pass over the test list when the whole list is
+                to be repeated
+    @param    - test_id : Last executed test ID
+    @return   - TRUE if the test list is to be run again
+**/
+static bool_t val_repeat_test_list(test_id_t test_id)
+{
+    uint64_t             now = val_timer_get_ticks();
+    bool_t               more;
+
+    if (!val_repeat_enabled(PAL_TEST_REPEAT_LIST))
+    {
+        return 0;
+    }
+
+    more = val_repeat_more();
+    val_repeat_record(g_list_pass_state, now - g_list_pass_start);
+    g_list_pass_start = now;
+    g_list_pass_state = TEST_PASS;
+
+    if (more)
+    {
+        val_print(PRINT_ALWAYS, "\nRepeating the test list\n", 0);
+        return 1;
+    }
+
+    val_repeat_end(test_id, TEST_PASS);
+    return 0;
+}
+
+/**
+    @brief    - This function adds the given test result to the suite summary
+                data structure kept in NVMEM
+    @param    - test_result : Test state returned by val_report_status
+    @return   - val_status_t
+**/
+static val_status_t val_update_test_count(uint32_t test_result)
+{
+    val_status_t         status;
+    test_count_t         test_count;
+
+    status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_TEST_CNT), &test_count, sizeof(test_count_t));
+    if (VAL_ERROR(status))
+    {
+        val_print(PRINT_ERROR, "\n\tNVMEM read error", 0);
+        return status;
+    }
+
+    switch (test_result)
+    {
+        case TEST_PASS:
+            test_count.pass_cnt += 1;
+            break;
+        case TEST_FAIL:
+            test_count.fail_cnt += 1;
+            break;
+        case TEST_SKIP:
+            test_count.skip_cnt += 1;
+            break;
+        case TEST_PENDING:
+            test_count.sim_error_cnt += 1;
+            break;
+    }
+
+    status = val_nvmem_write(VAL_NVMEM_OFFSET(NV_TEST_CNT), &test_count, sizeof(test_count_t));
+    if (VAL_ERROR(status))
+    {
+        val_print(PRINT_ERROR, "\n\tNVMEM write error", 0);
+    }
+
+    return status;
+}
+
+/**
+    @brief    - This function prints the suite summary report
+    @param    - test_id : Last executed test ID
+    @return   - 0 if success Or error code for the failure.
+**/
+static int32_t val_print_test_report(test_id_t test_id)
+{
+   val_status_t         status;
+   test_count_t         test_count;
+
+   status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_TEST_CNT), &test_count, sizeof(test_count_t));
+   if (VAL_ERROR(status))
+   {
+       val_print(PRINT_ERROR, "\n\tNVMEM read error", 0);
+       return status;
+   }
+
+   val_print(PRINT_ALWAYS, "\n************ ", 0);
+   val_print(PRINT_ALWAYS, val_get_comp_name(test_id), 0);
+   val_print(PRINT_ALWAYS, " Report **********\n", 0);
+   val_print(PRINT_ALWAYS, "TOTAL TESTS     : %d\n", test_count.pass_cnt + test_count.fail_cnt
+            + test_count.skip_cnt + test_count.sim_error_cnt);
+   val_print(PRINT_ALWAYS, "TOTAL PASSED    : %d\n", test_count.pass_cnt);
+   val_print(PRINT_ALWAYS, "TOTAL SIM ERROR : %d\n", test_count.sim_error_cnt);
+   val_print(PRINT_ALWAYS, "TOTAL FAILED    : %d\n", test_count.fail_cnt);
+   val_print(PRINT_ALWAYS, "TOTAL SKIPPED   : %d\n", test_count.skip_cnt);
+   val_print(PRINT_ALWAYS, "******************************************\n", 0);
+
+   val_results_suite_end(test_id, &test_count);
+
+   return (test_count.fail_cnt > 0) ? VAL_STATUS_TEST_FAILED : VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - This function executes a single test inside an isolated context
+                created by the platform. The boot flag and current test ID are
+                recorded in the (private) NVMEM of the context as for a regular run.
+    @param    - test_id : Test ID to be executed
+    @return   - Test state
+**/
+static uint32_t val_run_isolated_test(test_id_t test_id)
+{
+    val_test_info_t     *test_info = val_find_test(test_id);
+    val_status_t         status;
+
+    if (test_info == NULL)
+    {
+        val_set_status(RESULT_FAIL(VAL_STATUS_NOT_FOUND));
+        return val_report_test(test_id);
+    }
+
+    g_test_info_addr = (addr_t) test_info->entry_addr;
+
+    status = val_nvmem_write(VAL_NVMEM_OFFSET(NV_TEST_ID_CURRENT),
+                             &test_id, sizeof(test_id_t));
+    if (VAL_ERROR(status))
+    {
+        val_print(PRINT_ERROR, "\n\tNVMEM write error", 0);
+        val_set_status(RESULT_FAIL(status));
+        return val_report_test(test_id);
+    }
+
+    status = val_set_boot_flag(BOOT_NOT_EXPECTED);
+    if (VAL_ERROR(status))
+    {
+        val_set_status(RESULT_FAIL(status));
+        return val_report_test(test_id);
+    }
+
+    val_execute_repeated_test();
+    return val_report_repeated_test(test_id);
+}
+
+/**
+    @brief    - This function reports a test whose isolated context terminated
+                before reporting a result (crash or hang). Such test is
+                reported as SIM ERROR, as after an unexpected reboot.
+    @param    - test_id : Test ID of the aborted test
+    @return   - Test state
+**/
+static uint32_t val_abort_isolated_test(test_id_t test_id)
+{
+    (void)test_id;
+
+    val_set_status(RESULT_PENDING(VAL_STATUS_ERROR));
+    return val_report_test(test_id);
+}
+
+/**
+    @brief    - This function initializes the services under test once, for
+                platforms creating the isolated test contexts from a snapshot
+                of the VAL context. Tests then start from an initialized
+                service instead of paying its setup cost each time.
+    @return   - 0 if success Or error code for the failure.
+**/
+static int32_t val_prepare_isolated_tests(void)
+{
+#ifdef CRYPTO
+    int32_t              status;
+
+    status = pal_crypto_api.crypto_init();
+    if (status != 0)
+    {
+        val_print(PRINT_ERROR, "\n\tCrypto initialization failed. Error=0x%x", status);
+        return VAL_STATUS_INIT_FAILED;
+    }
+#endif
+
+    return VAL_STATUS_SUCCESS;
+}
+
+static const pal_test_ops_t g_isolated_test_ops = {
+    .prepare = val_prepare_isolated_tests,
+    .run     = val_run_isolated_test,
+    .abort   = val_abort_isolated_test,
+};
+
+/**
+    @brief    - This function hands over all enabled tests to the platform which
+                runs each of them in its own isolated context, possibly several at
+                a time. Results are reported in test ID order.
+    @return   - 0 if success Or error code for the failure.
+**/
+static int32_t val_dispatch_isolated_tests(void)
+{
+    static test_id_t     test_ids[VAL_TEST_LIST_SIZE];
+    static uint32_t      test_results[VAL_TEST_LIST_SIZE];
+    val_test_info_t     *test_info = &g_test_list[0];
+    uint32_t             count = 0, i;
+    val_status_t         status;
+
+    for (; test_info->test_id != VAL_INVALID_TEST_ID; test_info++)
+    {
+        if (val_is_test_selected(test_info))
+        {
+            test_ids[count++] = test_info->test_id;
+        }
+    }
+
+    if (count == 0)
+    {
+        val_print(PRINT_DEBUG, "\n\nNo more valid tests found. Exiting.", 0);
+        return val_print_test_report(VAL_INVALID_TEST_ID);
+    }
+
+    val_print_suite_banner(test_ids[0], VAL_INVALID_TEST_ID);
+
+    status = pal_run_tests(test_ids, count, &g_isolated_test_ops, test_results);
+    if (VAL_ERROR(status))
+    {
+        val_print(PRINT_ERROR, "\n\tIsolated test execution failed. Error=0x%x", status);
+        return status;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        status = val_update_test_count(test_results[i]);
+        if (VAL_ERROR(status))
+        {
+            return status;
+        }
+    }
+
+    status = val_nvmem_write(VAL_NVMEM_OFFSET(NV_TEST_ID_PREVIOUS),
+                             &test_ids[count - 1], sizeof(test_id_t));
+    if (VAL_ERROR(status))
+    {
+        val_print(PRINT_ERROR, "\n\tNVMEM write error", 0);
+        return status;
+    }
+
+    return val_print_test_report(test_ids[count - 1]);
+}
+
 /**
     @brief    - This function is responsible for setting up VAL infrastructure.
                 Loads test one by one from combine binary and calls test_entry
@@ -195,8 +791,45 @@ int32_t val_dispatcher(test_id_t test_id_prev)
     test_id_t            test_id;
     val_status_t         status;
     boot_t               boot;
-    test_count_t         test_count;
     uint32_t             test_result;
+    bool_t               restart_list = 0;
+
+    status = val_select_test_shard();
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    /* A run resumed after a reset starts the repetition again */
+    val_repeat_init();
+    if (val_repeat_enabled(PAL_TEST_REPEAT_LIST))
+    {
+        val_repeat_begin();
+        g_list_pass_start = val_timer_get_ticks();
+        g_list_pass_state = TEST_PASS;
+    }
+
+    if (test_id_prev == VAL_INVALID_TEST_ID)
+    {
+        status = val_get_boot_flag(&boot.state);
+        if (VAL_ERROR(status))
+        {
+            return status;
+        }
+
+        /* Fresh start. Platforms able to isolate tests take over the execution
+           of the whole test list, resumed runs and repeated test lists continue
+           sequentially. */
+        if (boot.state == BOOT_UNKNOWN)
+        {
+            val_print_shard_manifest();
+
+            if ((pal_get_test_workers() > 0) && !val_repeat_enabled(PAL_TEST_REPEAT_LIST))
+            {
+                return val_dispatch_isolated_tests();
+            }
+        }
+    }
 
     do
     {
@@ -238,7 +871,8 @@ int32_t val_dispatcher(test_id_t test_id_prev)
         }
         else
         {
-            status = val_test_load(&test_id, test_id_prev);
+            status = val_test_load(&test_id, restart_list ? VAL_INVALID_TEST_ID : test_id_prev);
+            restart_list = 0;
 
             if (VAL_ERROR(status))
             {
@@ -246,6 +880,11 @@ int32_t val_dispatcher(test_id_t test_id_prev)
             }
             else if (test_id == VAL_INVALID_TEST_ID)
             {
+                if (val_repeat_test_list(test_id_prev))
+                {
+                    restart_list = 1;
+                    continue;
+                }
                 break;
             }
 
@@ -257,17 +896,7 @@ int32_t val_dispatcher(test_id_t test_id_prev)
                 return status;
             }
 
-            if (VAL_GET_COMP_NUM(test_id_prev) != VAL_GET_COMP_NUM(test_id))
-            {
-                val_print(PRINT_ALWAYS, "\nRunning.. ", 0);
-                val_print(PRINT_ALWAYS, val_get_comp_name(test_id), 0);
-			//	val_print_api_version();
-#ifdef TESTS_COVERAGE
-                val_print(PRINT_ALWAYS, "\nNOTE : Known failing tests are excluded from this \
-build. For PSA functional API certification, all tests must be run.\n", 0);
-#endif
-                val_print(PRINT_ALWAYS, "\n******************************************\n", 0);
-            }
+            val_print_suite_banner(test_id, test_id_prev);
 
             if (boot.state == BOOT_UNKNOWN)
             {
@@ -278,10 +907,14 @@ build. For PSA functional API certification, all tests must be run.\n", 0);
                     return status;
                 }
             }
-            val_execute_test_fn();
+            val_execute_repeated_test();
         }
 
-        test_result = val_report_status();
+        test_result = val_report_repeated_test(test_id);
+        if ((test_result == TEST_FAIL) || (test_result == TEST_PENDING))
+        {
+            g_list_pass_state = TEST_FAIL;
+        }
 
         /* Reset boot.state to UNKNOWN before lunching next test */
         status = val_set_boot_flag(BOOT_UNKNOWN);
@@ -291,33 +924,9 @@ build. For PSA functional API certification, all tests must be run.\n", 0);
         }
 
         /* Prepare suite summary data structure */
-        status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_TEST_CNT), &test_count, sizeof(test_count_t));
-        if (VAL_ERROR(status))
-        {
-            val_print(PRINT_ERROR, "\n\tNVMEM read error", 0);
-            return status;
-        }
-
-        switch (test_result)
-        {
-            case TEST_PASS:
-                test_count.pass_cnt += 1;
-                break;
-            case TEST_FAIL:
-                test_count.fail_cnt += 1;
-                break;
-            case TEST_SKIP:
-                test_count.skip_cnt += 1;
-                break;
-            case TEST_PENDING:
-                test_count.sim_error_cnt += 1;
-                break;
-        }
-
-        status = val_nvmem_write(VAL_NVMEM_OFFSET(NV_TEST_CNT), &test_count, sizeof(test_count_t));
+        status = val_update_test_count(test_result);
         if (VAL_ERROR(status))
         {
-            val_print(PRINT_ERROR, "\n\tNVMEM write error", 0);
             return status;
         }
 
@@ -332,30 +941,5 @@ build. For PSA functional API certification, all tests must be run.\n", 0);
 
    } while (1);
 
-   status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_TEST_CNT), &test_count, sizeof(test_count_t));
-   if (VAL_ERROR(status))
-   {
-       val_print(PRINT_ERROR, "\n\tNVMEM read error", 0);
-       return status;
-   }
-
-   val_print(PRINT_ALWAYS, "\n************ ", 0);
-   val_print(PRINT_ALWAYS, val_get_comp_name(test_id_prev), 0);
-   val_print(PRINT_ALWAYS, " Report **********\n", 0);
-   val_print(PRINT_ALWAYS, "TOTAL TESTS     : %d\n", test_count.pass_cnt + test_count.fail_cnt
-            + test_count.skip_cnt + test_count.sim_error_cnt);
-   val_print(PRINT_ALWAYS, "TOTAL PASSED    : %d\n", test_count.pass_cnt);
-   val_print(PRINT_ALWAYS, "TOTAL SIM ERROR : %d\n", test_count.sim_error_cnt);
-   val_print(PRINT_ALWAYS, "TOTAL FAILED    : %d\n", test_count.fail_cnt);
-   val_print(PRINT_ALWAYS, "TOTAL SKIPPED   : %d\n", test_count.skip_cnt);
-   val_print(PRINT_ALWAYS, "******************************************\n", 0);
-
-   return (test_count.fail_cnt > 0) ? VAL_STATUS_TEST_FAILED : VAL_STATUS_SUCCESS;
+   return val_print_test_report(test_id_prev);
 }
-
-
-
-
-
-
-
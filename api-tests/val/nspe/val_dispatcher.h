@@ -24,6 +24,7 @@
 #define VAL_INVALID_TEST_ID            0xffffffff
 #define VAL_TEST_START_MARKER          0xfaceface
 #define VAL_TEST_END_MARKER            0xc3c3c3c3
+#define VAL_TEST_SHARD_MAX             256
 
 /* typedef's */
 typedef uint32_t  elf32_word;
@@ -67,4 +68,5 @@ typedef struct {
 } test_header_t;
 
 int32_t val_dispatcher(test_id_t test_id_prev);
+char *val_get_comp_name(test_id_t test_id);
 #endif
@@ -21,6 +21,8 @@
 #include "val_peripherals.h"
 #include "pal_interfaces_ns.h"
 #include "val_target.h"
+#include "val_results.h"
+#include "val_repeat.h"
 
 extern val_api_t val_api;
 extern psa_api_t psa_api;
@@ -28,6 +30,28 @@ extern psa_api_t psa_api;
 /* globals */
 test_status_buffer_t    g_status_buffer;
 
+/* Timer value when the running test started, and duration of the last reported test */
+static uint64_t         g_test_start_ticks;
+static uint64_t         g_test_ticks;
+
+#ifdef TEST_TIMING
+/**
+    @brief    - Prints a duration measured with the platform timer
+    @param    - verbosity : Print verbosity
+                ticks     : Duration in timer ticks
+    @return   - None
+**/
+static void val_print_duration(print_verbosity_t verbosity, uint64_t ticks)
+{
+    uint32_t us = val_timer_ticks_to_us(ticks);
+
+    if (us > INT32_MAX)
+        val_print(verbosity, ">%d us\n", INT32_MAX);
+    else
+        val_print(verbosity, "%d us\n", (int32_t)us);
+}
+#endif
+
 #ifdef IPC
 /**
  * @brief Connect to given sid
@@ -105,13 +129,12 @@ val_status_t val_execute_non_secure_tests(uint32_t test_num, const client_test_t
     val_status_t          test_status = VAL_STATUS_SUCCESS;
     boot_t                boot;
     uint32_t              i = 1;
+    uint64_t              check_start, check_ticks;
 #ifdef IPC
     psa_handle_t          handle;
     test_info_t           test_info;
 
     test_info.test_num = test_num;
-#else
-   (void)test_num;
 #endif
 
     status = val_get_boot_flag(&boot.state);
@@ -186,7 +209,13 @@ val_status_t val_execute_non_secure_tests(uint32_t test_num, const client_test_t
             /* keep track of the test block numbers, helps when the panic happened */
         	status = val_set_test_data(NV_TEST_DATA2, i);
             /* Execute client tests */
+            check_start = val_timer_get_ticks();
             test_status = tests_list[i](CALLER_NONSECURE);
+            check_ticks = val_timer_get_ticks() - check_start;
+#ifdef TEST_TIMING
+            val_print(PRINT_TEST, "\t[Check %d] Time: ", i);
+            val_print_duration(PRINT_TEST, check_ticks);
+#endif
 #ifdef IPC
             if (server_hs == TRUE)
             {
@@ -195,6 +224,11 @@ val_status_t val_execute_non_secure_tests(uint32_t test_num, const client_test_t
             }
 #endif
             status = test_status ? test_status:status;
+            /* The iterations of a repeated test are summed up by its repeat record */
+            if (!val_repeat_enabled(PAL_TEST_REPEAT_TEST))
+            {
+                val_results_check(test_num, i, status, check_ticks);
+            }
             if (IS_TEST_SKIP(status))
             {
                 val_set_status(status);
@@ -444,11 +478,36 @@ val_status_t val_get_secure_test_result(psa_handle_t *handle)
 #endif
 
 /**
-    @brief    - Parses input status for a given test and
-                outputs appropriate information on the console
+    @brief    - Ends the current test without reporting it, taking its duration
     @return   - Test state
 **/
-uint32_t val_report_status(void)
+uint32_t val_end_test(void)
+{
+    uint32_t state = (val_get_status() >> TEST_STATE_BIT) & TEST_STATE_MASK;
+
+    g_test_ticks = g_test_start_ticks ? (val_timer_get_ticks() - g_test_start_ticks) : 0;
+    g_test_start_ticks = 0;
+
+    switch (state)
+    {
+        case TEST_END:
+            return TEST_PASS;
+
+        case TEST_FAIL:
+        case TEST_SKIP:
+        case TEST_PENDING:
+            return state;
+
+        default:
+            return TEST_FAIL;
+    }
+}
+
+/**
+    @brief    - Prints the result of the test ended by val_end_test on the console
+    @return   - None
+**/
+void val_print_status(void)
 {
     uint32_t status, state;
 
@@ -460,13 +519,11 @@ uint32_t val_report_status(void)
     switch (state)
     {
         case TEST_START:
-            state = TEST_FAIL;
             val_print(PRINT_ALWAYS, "\nTEST RESULT: FAILED (Error Code=0x%x)\n",
                                                     VAL_STATUS_INIT_FAILED);
             break;
 
         case TEST_END:
-            state = TEST_PASS;
             val_print(PRINT_ALWAYS, "\nTEST RESULT: PASSED\n", 0);
             break;
 
@@ -475,7 +532,6 @@ uint32_t val_report_status(void)
             break;
 
         case TEST_SKIP:
-            state = TEST_SKIP;
             val_print(PRINT_ALWAYS, "\nTEST RESULT: SKIPPED (Skip Code=0x%x)\n", status);
             break;
 
@@ -484,16 +540,44 @@ uint32_t val_report_status(void)
             break;
 
         default:
-            state = TEST_FAIL;
             val_print(PRINT_ALWAYS, "\nTEST RESULT: FAILED(Error Code=0x%x)\n", VAL_STATUS_INVALID);
             break;
 
     }
 
+#ifdef TEST_TIMING
+    if (g_test_ticks != 0)
+    {
+        val_print(PRINT_ALWAYS, "TEST TIME: ", 0);
+        val_print_duration(PRINT_ALWAYS, g_test_ticks);
+    }
+#endif
+
     val_print(PRINT_ALWAYS, "\n******************************************\n", 0);
+}
+
+/**
+    @brief    - Parses input status for a given test and
+                outputs appropriate information on the console
+    @return   - Test state
+**/
+uint32_t val_report_status(void)
+{
+    uint32_t state = val_end_test();
+
+    val_print_status();
     return state;
 }
 
+/**
+    @brief    - Returns the duration of the last test reported by val_report_status
+    @return   - Duration in timer ticks, 0 if unknown
+**/
+uint64_t val_get_test_duration(void)
+{
+    return g_test_ticks;
+}
+
 /**
     @brief    - Records the state and status of test
     @return   - val_status_t
@@ -566,6 +650,8 @@ void val_test_init(uint32_t test_num, char8_t *desc, uint32_t test_bitfield)
    g_status_buffer.state   = TEST_FAIL;
    g_status_buffer.status  = VAL_STATUS_INVALID;
 
+   g_test_start_ticks = val_timer_get_ticks();
+
    val_print(PRINT_ALWAYS, "\nTEST: %d | DESCRIPTION: ", test_num);
    val_print(PRINT_ALWAYS, desc, 0);
 
@@ -24,7 +24,10 @@
 #include "val_interfaces.h"
 
 /* prototypes */
+uint32_t     val_end_test(void);
+void         val_print_status(void);
 uint32_t     val_report_status(void);
+uint64_t     val_get_test_duration(void);
 val_status_t val_set_status(uint32_t status);
 uint32_t     val_get_status(void);
 val_status_t val_err_check_set(uint32_t checkpoint, val_status_t status);
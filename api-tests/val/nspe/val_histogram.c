@@ -0,0 +1,124 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_histogram.h"
+
+/**
+    @brief    - Empties a histogram
+    @param    - histogram : Histogram
+    @return   - None
+**/
+void val_histogram_reset(val_histogram_t *histogram)
+{
+    memset(histogram, 0, sizeof(*histogram));
+}
+
+/**
+    @brief    - Returns the bucket of a value
+    @param    - value : Recorded value
+    @return   - Bucket index
+**/
+static uint32_t val_histogram_bucket(uint32_t value)
+{
+    uint32_t msb = VAL_HISTOGRAM_SUB_BITS;
+
+    if (value < VAL_HISTOGRAM_SUB_BUCKETS)
+    {
+        return value;
+    }
+
+    while ((value >> (msb + 1)) != 0)
+    {
+        msb++;
+    }
+
+    return ((msb - VAL_HISTOGRAM_SUB_BITS + 1) * VAL_HISTOGRAM_SUB_BUCKETS)
+           + ((value >> (msb - VAL_HISTOGRAM_SUB_BITS)) & (VAL_HISTOGRAM_SUB_BUCKETS - 1));
+}
+
+/**
+    @brief    - Returns the value at the middle of a bucket
+    @param    - bucket : Bucket index
+    @return   - Value
+**/
+static uint32_t val_histogram_bucket_value(uint32_t bucket)
+{
+    uint32_t shift, low;
+
+    if (bucket < VAL_HISTOGRAM_SUB_BUCKETS)
+    {
+        return bucket;
+    }
+
+    shift = (bucket / VAL_HISTOGRAM_SUB_BUCKETS) - 1;
+    low = (VAL_HISTOGRAM_SUB_BUCKETS + (bucket % VAL_HISTOGRAM_SUB_BUCKETS)) << shift;
+    return low + ((1u << shift) >> 1);
+}
+
+/**
+    @brief    - Records a value
+    @param    - histogram : Histogram
+                value     : Recorded value
+    @return   - None
+**/
+void val_histogram_add(val_histogram_t *histogram, uint32_t value)
+{
+    if ((histogram->count == 0) || (value < histogram->min))
+    {
+        histogram->min = value;
+    }
+    if (value > histogram->max)
+    {
+        histogram->max = value;
+    }
+    histogram->buckets[val_histogram_bucket(value)]++;
+    histogram->count++;
+}
+
+/**
+    @brief    - Returns a percentile of the recorded values
+    @param    - histogram : Histogram
+                percent   : Percentile, from 1 to 100
+    @return   - Estimated value, 0 if no value was recorded
+**/
+uint32_t val_histogram_percentile(const val_histogram_t *histogram, uint32_t percent)
+{
+    uint64_t rank = (((uint64_t)histogram->count * percent) + 99) / 100;
+    uint64_t seen = 0;
+    uint32_t bucket, value;
+
+    if (histogram->count == 0)
+    {
+        return 0;
+    }
+
+    for (bucket = 0; bucket < VAL_HISTOGRAM_BUCKETS; bucket++)
+    {
+        seen += histogram->buckets[bucket];
+        if (seen >= rank)
+        {
+            break;
+        }
+    }
+
+    value = val_histogram_bucket_value(bucket);
+    if (value < histogram->min)
+    {
+        return histogram->min;
+    }
+    return (value > histogram->max) ? histogram->max : value;
+}
@@ -0,0 +1,44 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _VAL_HISTOGRAM_H_
+#define _VAL_HISTOGRAM_H_
+
+#include "val.h"
+
+/* Log-linear histogram of 32-bit values (latencies), so that the memory cost
+ * does not depend on the number of recorded values: values below
+ * VAL_HISTOGRAM_SUB_BUCKETS have their own bucket, larger values share
+ * VAL_HISTOGRAM_SUB_BUCKETS buckets per power of two. Percentiles are
+ * estimated within 1/32 of the value.
+ */
+#define VAL_HISTOGRAM_SUB_BITS       4
+#define VAL_HISTOGRAM_SUB_BUCKETS    (1u << VAL_HISTOGRAM_SUB_BITS)
+#define VAL_HISTOGRAM_BUCKETS        (VAL_HISTOGRAM_SUB_BUCKETS * (33 - VAL_HISTOGRAM_SUB_BITS))
+
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint32_t buckets[VAL_HISTOGRAM_BUCKETS];
+} val_histogram_t;
+
+/* prototypes */
+void     val_histogram_reset(val_histogram_t *histogram);
+void     val_histogram_add(val_histogram_t *histogram, uint32_t value);
+uint32_t val_histogram_percentile(const val_histogram_t *histogram, uint32_t percent);
+#endif /* _VAL_HISTOGRAM_H_ */
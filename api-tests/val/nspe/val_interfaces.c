@@ -23,6 +23,9 @@
 #include "val_crypto.h"
 #include "val_storage.h"
 #include "val_attestation.h"
+#include "val_bench.h"
+#include "val_leakage.h"
+#include "val_vectors.h"
 
 /*VAL APIs to be used by test */
 const val_api_t val_api = {
@@ -59,7 +62,19 @@ const val_api_t val_api = {
     .get_boot_flag             = val_get_boot_flag,
 	.set_test_data             = val_set_test_data,
 	.get_test_data             = val_get_test_data,
-    .crypto_function           = val_crypto_function,
+    .bench_run                 = val_bench_run,
+    .bench_run_threads         = val_bench_run_threads,
+    .bench_get_max_threads     = val_bench_get_max_threads,
+    .bench_get_stream_size     = val_bench_get_stream_size,
+    .bench_stream              = val_bench_stream,
+    .leakage_run               = val_leakage_run,
+    .vectors_open              = val_vectors_open,
+    .vectors_next              = val_vectors_next,
+#ifdef CRYPTO
+    .crypto                    = &pal_crypto_api,
+#else
+    .crypto                    = NULL,
+#endif
     .storage_function          = val_storage_function,
     .attestation_function      = val_attestation_function,
 };
@@ -20,6 +20,9 @@
 
 #include "val.h"
 #include "val_client_defs.h"
+#include "val_bench.h"
+#include "val_leakage.h"
+#include "val_vectors.h"
 #include "pal_interfaces_ns.h"
 
 /* typedef's */
@@ -59,7 +62,21 @@ typedef struct {
     val_status_t     (*get_boot_flag)             (boot_state_t *state);
     val_status_t     (*get_test_data)             (int32_t nvm_index, int32_t *test_data);
     val_status_t     (*set_test_data)             (int32_t nvm_index, int32_t test_data);
-    int32_t          (*crypto_function)           (int type, ...);
+    val_status_t     (*bench_run)                 (val_bench_sample_t *sample,
+                                                   val_bench_op_t op, void *ctx);
+    val_status_t     (*bench_run_threads)         (val_bench_sample_t *sample,
+                                                   val_bench_op_t op, void **ctx,
+                                                   uint32_t threads);
+    uint32_t         (*bench_get_max_threads)     (void);
+    val_status_t     (*bench_get_stream_size)     (uint64_t *size);
+    val_status_t     (*bench_stream)              (val_bench_sample_t *sample,
+                                                   val_bench_update_t update, void *ctx,
+                                                   uint8_t *buffer);
+    val_status_t     (*leakage_run)               (val_leakage_sample_t *sample,
+                                                   val_leakage_op_t op, void *ctx);
+    val_status_t     (*vectors_open)              (val_vectors_t *corpus);
+    val_status_t     (*vectors_next)              (val_vectors_t *corpus, val_vector_t *vector);
+    const struct pal_crypto_api_s *crypto;
     int32_t          (*storage_function)          (int type, ...);
     int32_t          (*attestation_function)      (int type, ...);
 } val_api_t;
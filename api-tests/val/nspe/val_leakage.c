@@ -0,0 +1,353 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_leakage.h"
+#include "val_dispatcher.h"
+#include "val_peripherals.h"
+#include "val_results.h"
+#include "val_histogram.h"
+#include "pal_interfaces_ns.h"
+
+/* Percentile the slowest measurements are cropped at, for each t-test */
+static const uint32_t g_leakage_crops[VAL_LEAKAGE_TESTS] = {100, 99, 95, 90, 75, 50};
+
+/* Moments of each t-test and input class */
+static val_leakage_moments_t g_leakage_moments[VAL_LEAKAGE_TESTS][2];
+
+/* Durations of the calibration measurements */
+static val_histogram_t g_leakage_histogram;
+
+/* State of the input class generator */
+static uint32_t g_leakage_random;
+
+/**
+    @brief    - Draws a random input class. The order of the classes only
+                has to be independent of the measured operation, xorshift32
+                is enough.
+    @param    - None
+    @return   - 0 or 1
+**/
+static uint32_t val_leakage_class(void)
+{
+    g_leakage_random ^= g_leakage_random << 13;
+    g_leakage_random ^= g_leakage_random >> 17;
+    g_leakage_random ^= g_leakage_random << 5;
+    return g_leakage_random >> 31;
+}
+
+/**
+    @brief    - Integer square root
+    @param    - value : Value
+    @return   - Largest integer whose square is not above value
+**/
+static uint64_t val_leakage_sqrt(uint64_t value)
+{
+    uint64_t root = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+
+    while (bit > value)
+    {
+        bit >>= 2;
+    }
+
+    while (bit != 0)
+    {
+        if (value >= (root + bit))
+        {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return root;
+}
+
+/**
+    @brief    - Computes Welch's t statistic of the two classes of a t-test
+    @param    - moments : Moments of class 0 and class 1
+    @return   - |t| in 1/100, 0 if a class has too few measurements
+**/
+static uint32_t val_leakage_t_x100(const val_leakage_moments_t *moments)
+{
+    uint64_t mean[2], var, ex2, se, diff, t;
+    uint64_t se2 = 0;
+    uint32_t i;
+
+    for (i = 0; i < 2; i++)
+    {
+        if (moments[i].count < VAL_LEAKAGE_MIN_COUNT)
+        {
+            return 0;
+        }
+
+        /* Mean and variance with VAL_LEAKAGE_FRAC_BITS fractional bits */
+        mean[i] = (moments[i].sum << VAL_LEAKAGE_FRAC_BITS) / moments[i].count;
+        ex2 = (moments[i].sum_sq << VAL_LEAKAGE_FRAC_BITS) / moments[i].count;
+        var = (mean[i] * mean[i]) >> VAL_LEAKAGE_FRAC_BITS;
+        var = (ex2 > var) ? (ex2 - var) : 0;
+        var = (var * moments[i].count) / (moments[i].count - 1);
+
+        /* Squared standard error with three times the fractional bits */
+        se2 += (var << (2 * VAL_LEAKAGE_FRAC_BITS)) / moments[i].count;
+    }
+
+    /* Both in 1.5 times the fractional bits */
+    se = val_leakage_sqrt(se2);
+    diff = (mean[0] > mean[1]) ? (mean[0] - mean[1]) : (mean[1] - mean[0]);
+    diff <<= VAL_LEAKAGE_FRAC_BITS / 2;
+
+    if (se == 0)
+    {
+        return (diff == 0) ? 0 : VAL_LEAKAGE_T_MAX_X100;
+    }
+
+    t = (diff * 100) / se;
+    return (t < VAL_LEAKAGE_T_MAX_X100) ? (uint32_t)t : VAL_LEAKAGE_T_MAX_X100;
+}
+
+/**
+    @brief    - Finds the t-test with the largest |t| of a sample
+    @param    - sample : Sample, its t_x100 and crop_percent are updated
+    @return   - None
+**/
+static void val_leakage_update(val_leakage_sample_t *sample)
+{
+    uint32_t i, t;
+
+    sample->t_x100 = 0;
+    sample->crop_percent = 100;
+    for (i = 0; i < VAL_LEAKAGE_TESTS; i++)
+    {
+        t = val_leakage_t_x100(g_leakage_moments[i]);
+        if (t > sample->t_x100)
+        {
+            sample->t_x100 = t;
+            sample->crop_percent = g_leakage_crops[i];
+        }
+    }
+}
+
+/**
+    @brief    - Prints a value given in hundredths with two decimals
+    @param    - value : Value in 1/100
+    @return   - None
+**/
+static void val_leakage_print_x100(uint32_t value)
+{
+    val_print(PRINT_TEST, "%d.", (int32_t)(value / 100));
+    if ((value % 100) < 10)
+    {
+        val_print(PRINT_TEST, "0", 0);
+    }
+    val_print(PRINT_TEST, "%d", (int32_t)(value % 100));
+}
+
+/**
+    @brief    - Prints and records a measured sample
+    @param    - sample : Measured sample
+    @return   - None
+**/
+static void val_leakage_report(val_leakage_sample_t *sample)
+{
+    test_id_t test_id = VAL_INVALID_TEST_ID;
+
+    val_print(PRINT_TEST, "\t", 0);
+    val_print(PRINT_TEST, sample->op, 0);
+    val_print(PRINT_TEST, " ", 0);
+    val_print(PRINT_TEST, sample->alg_name, 0);
+    if (sample->variant != NULL)
+    {
+        val_print(PRINT_TEST, " (", 0);
+        val_print(PRINT_TEST, sample->variant, 0);
+        val_print(PRINT_TEST, ")", 0);
+    }
+    val_print(PRINT_TEST, " %d bytes", (int32_t)sample->size);
+    val_print(PRINT_TEST, ": %d measurements, max |t| ", (int32_t)sample->measurements);
+    val_leakage_print_x100(sample->t_x100);
+    if (sample->crop_percent != 100)
+    {
+        val_print(PRINT_TEST, " cropped at p%d", (int32_t)sample->crop_percent);
+    }
+    val_print(PRINT_TEST, sample->leak ? ", timing leak\n" : ", no leak detected\n", 0);
+
+    if (VAL_ERROR(val_nvmem_read(VAL_NVMEM_OFFSET(NV_TEST_ID_CURRENT),
+                                 &test_id, sizeof(test_id_t))))
+    {
+        test_id = VAL_INVALID_TEST_ID;
+    }
+    val_results_leakage(test_id, sample);
+}
+
+/**
+    @brief    - Runs the operation once with a random input class and times it,
+                reprogramming the watchdog before as a sample outlasts its
+                timeout, and a slow operation may too within a few measurements
+    @param    - op    : Operation to be measured
+                ctx   : Context passed to the operation
+                ticks : Duration of the operation
+                input_class : Class of the input
+    @return   - Status of the operation
+**/
+static int32_t val_leakage_measure(val_leakage_op_t op, void *ctx, uint64_t *ticks,
+                                   uint32_t *input_class)
+{
+    uint64_t start;
+    int32_t  status;
+
+    *ticks = 0;
+    *input_class = 0;
+    if (VAL_ERROR(val_wd_reprogram_timer(WD_CRYPTO_TIMEOUT)))
+    {
+        return VAL_STATUS_ERROR;
+    }
+
+    *input_class = val_leakage_class();
+    start = val_timer_get_ticks();
+    status = op(ctx, *input_class);
+    *ticks = val_timer_get_ticks() - start;
+    return status;
+}
+
+/**
+    @brief    - Tests whether the duration of an operation depends on the
+                class of its input. Both classes are run once untimed to warm
+                up, then VAL_LEAKAGE_CALIBRATION measurements, or as many as
+                fit in a quarter of VAL_LEAKAGE_MAX_TIME_S, set the crop
+                percentiles and the value scale, then the t-tests run on up to
+                VAL_LEAKAGE_MEASUREMENTS measurements in a random class order.
+                The sample stops early once VAL_LEAKAGE_MAX_TIME_S seconds have
+                passed since the calibration started, checked after each
+                measurement, or once |t| reached VAL_LEAKAGE_T_STOP_X100.
+    @param    - sample : Sample description, filled in with the measurement
+                op     : Operation to be measured
+                ctx    : Context passed to the operation
+    @return   - VAL_STATUS_SUCCESS whether a leak was found or not, skip
+                status if there is no timer or the operation is not
+                supported, VAL_STATUS_ERROR if it failed
+**/
+val_status_t val_leakage_run(val_leakage_sample_t *sample, val_leakage_op_t op, void *ctx)
+{
+    uint32_t freq = pal_timer_get_freq();
+    uint32_t thresholds[VAL_LEAKAGE_TESTS];
+    uint32_t offset, range, duration, value, input_class, i, j;
+    uint32_t shift = 0;
+    uint64_t max_ticks, begin, elapsed;
+    int32_t  status;
+
+    sample->measurements = 0;
+    sample->ticks = 0;
+    sample->t_x100 = 0;
+    sample->crop_percent = 100;
+    sample->leak = 0;
+
+    if (freq == 0)
+    {
+        val_print(PRINT_TEST, "\tNo timer, timing leakage cannot be measured\n", 0);
+        return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+    }
+
+    status = op(ctx, 0);
+    if (status == 0)
+    {
+        status = op(ctx, 1);
+    }
+    if (status == PAL_STATUS_UNSUPPORTED_FUNC)
+    {
+        return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+    }
+
+    g_leakage_random = (uint32_t)val_timer_get_ticks() | 1;
+    val_histogram_reset(&g_leakage_histogram);
+    max_ticks = (uint64_t)VAL_LEAKAGE_MAX_TIME_S * freq;
+    begin = val_timer_get_ticks();
+    for (i = 0; (i < VAL_LEAKAGE_CALIBRATION) && (status == 0); i++)
+    {
+        if ((i != 0) && ((val_timer_get_ticks() - begin) >= (max_ticks / 4)))
+        {
+            break;
+        }
+
+        status = val_leakage_measure(op, ctx, &elapsed, &input_class);
+        val_histogram_add(&g_leakage_histogram, (elapsed < 0xFFFFFFFF) ? (uint32_t)elapsed
+                                                                       : 0xFFFFFFFF);
+    }
+
+    for (i = 0; i < VAL_LEAKAGE_TESTS; i++)
+    {
+        thresholds[i] = (g_leakage_crops[i] == 100) ? 0xFFFFFFFF
+                        : val_histogram_percentile(&g_leakage_histogram, g_leakage_crops[i]);
+    }
+
+    /* Scale the durations so that four times the spread up to the 99th
+     * percentile fits in VAL_LEAKAGE_VALUE_BITS, slower outliers saturate
+     */
+    offset = g_leakage_histogram.min;
+    range = val_histogram_percentile(&g_leakage_histogram, 99) - offset;
+    while ((((uint64_t)range * 4) >> shift) > VAL_LEAKAGE_VALUE_MAX)
+    {
+        shift++;
+    }
+
+    memset(g_leakage_moments, 0, sizeof(g_leakage_moments));
+    while ((status == 0) && (sample->measurements < VAL_LEAKAGE_MEASUREMENTS)
+           && ((val_timer_get_ticks() - begin) < max_ticks)
+           && (sample->t_x100 < VAL_LEAKAGE_T_STOP_X100))
+    {
+        for (i = 0; (i < VAL_LEAKAGE_BATCH) && (status == 0)
+                    && (sample->measurements < VAL_LEAKAGE_MEASUREMENTS)
+                    && ((val_timer_get_ticks() - begin) < max_ticks); i++)
+        {
+            status = val_leakage_measure(op, ctx, &elapsed, &input_class);
+            sample->ticks += elapsed;
+            sample->measurements++;
+
+            duration = (elapsed < 0xFFFFFFFF) ? (uint32_t)elapsed : 0xFFFFFFFF;
+            value = (duration > offset) ? ((duration - offset) >> shift) : 0;
+            if (value > VAL_LEAKAGE_VALUE_MAX)
+            {
+                value = VAL_LEAKAGE_VALUE_MAX;
+            }
+
+            for (j = 0; j < VAL_LEAKAGE_TESTS; j++)
+            {
+                if (duration <= thresholds[j])
+                {
+                    g_leakage_moments[j][input_class].count++;
+                    g_leakage_moments[j][input_class].sum += value;
+                    g_leakage_moments[j][input_class].sum_sq += (uint64_t)value * value;
+                }
+            }
+        }
+
+        val_leakage_update(sample);
+    }
+
+    if (status != 0)
+    {
+        val_print(PRINT_ERROR, "\tMeasured operation failed: %d\n", status);
+        return VAL_STATUS_ERROR;
+    }
+
+    sample->leak = (sample->t_x100 >= VAL_LEAKAGE_T_THRESHOLD_X100) ? 1 : 0;
+    val_leakage_report(sample);
+    return VAL_STATUS_SUCCESS;
+}
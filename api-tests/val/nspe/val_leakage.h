@@ -0,0 +1,117 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _VAL_LEAKAGE_H_
+#define _VAL_LEAKAGE_H_
+
+#include "val.h"
+
+/* Timing leakage detection for the benchmark suites, after the dudect method
+ * (Reparaz, Balasch, Verbauwhede, "Dude, is my code constant time?"). An
+ * operation is run with inputs of two classes, e.g. a correct MAC and a MAC
+ * which is wrong in its first byte, in a random order. Welch's t-test is run
+ * online on the durations of both classes, so that the memory cost does not
+ * depend on the number of measurements. The durations are also tested with
+ * the slowest measurements cropped at several percentiles, as interrupts and
+ * cache misses hide a leak in the tail of the distribution. A |t| above
+ * VAL_LEAKAGE_T_THRESHOLD_X100 / 100 in any test means the duration depends
+ * on the input class.
+ */
+
+/* Number of measurements of a sample */
+#ifndef VAL_LEAKAGE_MEASUREMENTS
+#define VAL_LEAKAGE_MEASUREMENTS        1000000
+#endif
+
+/* Duration after which a sample stops short of VAL_LEAKAGE_MEASUREMENTS,
+ * for slow operations such as RSA decryption, calibration included
+ */
+#ifndef VAL_LEAKAGE_MAX_TIME_S
+#define VAL_LEAKAGE_MAX_TIME_S          60
+#endif
+
+/* |t| threshold of a leak, in 1/100 */
+#ifndef VAL_LEAKAGE_T_THRESHOLD_X100
+#define VAL_LEAKAGE_T_THRESHOLD_X100    450
+#endif
+
+/* |t| after which a sample stops early, the leak being beyond doubt */
+#define VAL_LEAKAGE_T_STOP_X100         1000
+
+/* |t| of classes of constant but different durations */
+#define VAL_LEAKAGE_T_MAX_X100          0xFFFFFFFE
+
+/* Untested measurements setting the crop percentiles and the value scale,
+ * fewer if they outlast a quarter of VAL_LEAKAGE_MAX_TIME_S
+ */
+#define VAL_LEAKAGE_CALIBRATION         1024
+
+/* Measurements between two checks of the t statistics */
+#define VAL_LEAKAGE_BATCH               4096
+
+/* Minimum measurements of each class for a test to count */
+#define VAL_LEAKAGE_MIN_COUNT           100
+
+/* Durations are scaled to VAL_LEAKAGE_VALUE_BITS bits above the fastest
+ * calibration measurement, and the moments kept with VAL_LEAKAGE_FRAC_BITS
+ * fractional bits, so that the sums fit in 64 bits
+ */
+#define VAL_LEAKAGE_VALUE_BITS          12
+#define VAL_LEAKAGE_FRAC_BITS           12
+#define VAL_LEAKAGE_VALUE_MAX           ((1u << VAL_LEAKAGE_VALUE_BITS) - 1)
+
+#if VAL_LEAKAGE_MEASUREMENTS > 0x8000000
+#error "VAL_LEAKAGE_MEASUREMENTS overflows the moments of the t-test"
+#endif
+
+/* Number of t-tests of a sample, see g_leakage_crops */
+#define VAL_LEAKAGE_TESTS               6
+
+/* Operation under measurement, run with an input of class 0 or 1. Returns 0
+ * if the operation gave the result expected for the class.
+ */
+typedef int32_t (*val_leakage_op_t)(void *ctx, uint32_t input_class);
+
+/* Running moments of the scaled durations of one class */
+typedef struct {
+    uint32_t count;
+    uint64_t sum;
+    uint64_t sum_sq;
+} val_leakage_moments_t;
+
+/* Leakage sample. The caller describes the operation, val_leakage_run fills
+ * in the measurement.
+ */
+typedef struct {
+    const char *op;                 /* Measured API, e.g. "mac_verify" */
+    const char *alg_name;           /* Algorithm name, e.g. "HMAC SHA 256" */
+    const char *variant;            /* Compared input classes, e.g. "first
+                                       byte", NULL if none */
+    uint32_t    alg;                /* PSA algorithm identifier */
+    uint32_t    key_bits;           /* Key size, 0 for keyless operations */
+    uint32_t    size;               /* Bytes processed by one operation */
+    uint32_t    measurements;       /* Number of tested measurements */
+    uint64_t    ticks;              /* Duration of the tested measurements */
+    uint32_t    t_x100;             /* Largest |t| of the tests, in 1/100 */
+    uint32_t    crop_percent;       /* Percentile the slowest measurements were
+                                       cropped at in that test, 100 if none */
+    bool_t      leak;               /* t_x100 reached VAL_LEAKAGE_T_THRESHOLD_X100 */
+} val_leakage_sample_t;
+
+/* prototypes */
+val_status_t val_leakage_run(val_leakage_sample_t *sample, val_leakage_op_t op, void *ctx);
+#endif /* _VAL_LEAKAGE_H_ */
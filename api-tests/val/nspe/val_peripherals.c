@@ -233,3 +233,32 @@ val_status_t val_nvmem_write(uint32_t offset, const void *buffer, int size)
 
    return pal_nvmem_write_ns(memory_desc->start, offset, buffer, size);
 }
+
+/**
+    @brief    - Reads the platform free running timer.
+    @return   - Current timer value in ticks, 0 if the platform has no timer
+**/
+uint64_t val_timer_get_ticks(void)
+{
+   return pal_timer_get_ticks();
+}
+
+/**
+    @brief    - Converts a number of platform timer ticks into micro seconds.
+    @param    - ticks : Number of timer ticks
+    @return   - Micro seconds, saturated to UINT32_MAX. 0 if the platform has no timer.
+**/
+uint32_t val_timer_ticks_to_us(uint64_t ticks)
+{
+   uint32_t freq = pal_timer_get_freq();
+   uint64_t us;
+
+   if (freq == 0)
+   {
+        return 0;
+   }
+
+   us = ((ticks / freq) * 1000000) + (((ticks % freq) * 1000000) / freq);
+
+   return (us > UINT32_MAX) ? UINT32_MAX : (uint32_t)us;
+}
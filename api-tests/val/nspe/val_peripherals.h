@@ -28,4 +28,6 @@ val_status_t val_wd_timer_init(wd_timeout_type_t timeout_type);
 val_status_t val_wd_timer_enable(void);
 val_status_t val_wd_timer_disable(void);
 val_status_t val_wd_reprogram_timer(wd_timeout_type_t timeout_type);
+uint64_t     val_timer_get_ticks(void);
+uint32_t     val_timer_ticks_to_us(uint64_t ticks);
 #endif
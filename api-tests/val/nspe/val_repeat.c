@@ -0,0 +1,292 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_repeat.h"
+#include "val_peripherals.h"
+#include "val_results.h"
+#include "val_histogram.h"
+
+static pal_test_repeat_t  g_repeat;
+static uint8_t            g_repeat_enabled;
+static uint8_t            g_repeat_active;
+static uint64_t           g_repeat_start;
+static uint64_t           g_repeat_ticks;
+static uint32_t           g_repeat_baseline_keys;
+static uint32_t           g_repeat_baseline_slots;
+static uint8_t            g_repeat_check_slots;
+static val_repeat_stats_t g_repeat_stats;
+
+/* Iteration latencies, kept in a histogram so that the memory cost does not
+ * depend on the number of iterations of a long soak run
+ */
+static val_histogram_t    g_repeat_histogram;
+
+/**
+    @brief    - Reads the repetition settings of the platform
+    @param    - None
+    @return   - None
+**/
+void val_repeat_init(void)
+{
+    g_repeat_enabled = (pal_get_test_repeat(&g_repeat) == PAL_STATUS_SUCCESS) ? 1 : 0;
+
+    if (g_repeat_enabled && g_repeat.duration_s && (pal_timer_get_freq() == 0))
+    {
+        val_print(PRINT_WARN, "\n\tNo timer, repetition duration ignored\n", 0);
+        g_repeat.duration_s = 0;
+        if (g_repeat.iterations == 0)
+        {
+            g_repeat_enabled = 0;
+        }
+    }
+}
+
+/**
+    @brief    - Tells if the repetition is enabled for the given scope
+    @param    - scope : pal_test_repeat_scope_t
+    @return   - TRUE/FALSE
+**/
+bool_t val_repeat_enabled(uint32_t scope)
+{
+    return (g_repeat_enabled && (g_repeat.scope == scope)) ? 1 : 0;
+}
+
+/**
+    @brief    - Returns the number of keys present in the key store
+    @param    - None
+    @return   - Number of live keys created through the PAL, 0 for non crypto suites
+**/
+static uint32_t val_repeat_live_keys(void)
+{
+    uint32_t live = 0;
+
+#ifdef CRYPTO
+    live = pal_crypto_api.live_key_count();
+#endif
+    return live;
+}
+
+/**
+    @brief    - Returns the number of free slots of the key store
+    @param    - None
+    @return   - Number of free key slots, 0 for non crypto suites
+**/
+static uint32_t val_repeat_free_slots(void)
+{
+    uint32_t slots = 0;
+
+#ifdef CRYPTO
+    slots = pal_crypto_api.free_key_slots();
+#endif
+    return slots;
+}
+
+/**
+    @brief    - Takes the free key slot baseline, after the first iteration which
+                may leave state held by the crypto service for the whole run.
+                A key is leaked on purpose to check that the slot count sees it,
+                the slots are not checked otherwise.
+    @param    - None
+    @return   - None
+**/
+static void val_repeat_slot_baseline(void)
+{
+#ifdef CRYPTO
+    psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+    psa_key_id_t         key;
+    const uint8_t        data[1] = {0};
+
+    g_repeat_baseline_slots = val_repeat_free_slots();
+    pal_crypto_api.set_key_type(&attributes, PSA_KEY_TYPE_RAW_DATA);
+    if (pal_crypto_api.import_key(&attributes, data, sizeof(data), &key) == PSA_SUCCESS)
+    {
+        g_repeat_check_slots = ((val_repeat_free_slots() + 1) == g_repeat_baseline_slots) ? 1 : 0;
+        pal_crypto_api.destroy_key(key);
+    }
+
+    if (!g_repeat_check_slots)
+    {
+        val_print(PRINT_INFO, "\n\tKey slot count does not see a leaked key,", 0);
+        val_print(PRINT_INFO, " only tracked keys are checked\n", 0);
+    }
+#endif
+}
+
+/**
+    @brief    - Starts a repetition, taking the key store baseline
+    @param    - None
+    @return   - None
+**/
+void val_repeat_begin(void)
+{
+    memset(&g_repeat_stats, 0, sizeof(g_repeat_stats));
+    val_histogram_reset(&g_repeat_histogram);
+    g_repeat_baseline_keys = val_repeat_live_keys();
+    g_repeat_check_slots = 0;
+    g_repeat_start = val_timer_get_ticks();
+    g_repeat_ticks = 0;
+    g_repeat_active = 1;
+}
+
+/**
+    @brief    - Tells if another iteration is due after the current one
+    @param    - None
+    @return   - TRUE/FALSE
+**/
+bool_t val_repeat_more(void)
+{
+    uint64_t elapsed;
+
+    if (!g_repeat_active)
+    {
+        return 0;
+    }
+
+    if (g_repeat.iterations && ((g_repeat_stats.iterations + 1) >= g_repeat.iterations))
+    {
+        return 0;
+    }
+
+    if (g_repeat.duration_s)
+    {
+        elapsed = val_timer_get_ticks() - g_repeat_start;
+        if ((elapsed / pal_timer_get_freq()) >= g_repeat.duration_s)
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+    @brief    - Records an iteration and checks that the key store is back to
+                its baseline: the tracked keys still live, those the end of test
+                sweep could not destroy, and the free key slots, which also
+                account for the keys leaked around the tracking
+    @param    - state : Test state of the iteration
+                ticks : Iteration duration in timer ticks
+    @return   - None
+**/
+void val_repeat_record(uint32_t state, uint64_t ticks)
+{
+    uint32_t us = val_timer_ticks_to_us(ticks);
+    uint32_t live, slots, leaked = 0;
+
+    if (!g_repeat_active)
+    {
+        return;
+    }
+
+    if ((g_repeat_stats.iterations == 0) || (us < g_repeat_stats.min_us))
+    {
+        g_repeat_stats.min_us = us;
+    }
+    if (us > g_repeat_stats.max_us)
+    {
+        g_repeat_stats.max_us = us;
+    }
+    val_histogram_add(&g_repeat_histogram, us);
+    g_repeat_stats.iterations++;
+    g_repeat_ticks += ticks;
+
+    if ((state != TEST_PASS) && (state != TEST_SKIP))
+    {
+        g_repeat_stats.failed++;
+    }
+
+    live = val_repeat_live_keys();
+    if (live > g_repeat_baseline_keys)
+    {
+        leaked = live - g_repeat_baseline_keys;
+    }
+
+    if (g_repeat_stats.iterations == 1)
+    {
+        val_repeat_slot_baseline();
+    }
+    else if (g_repeat_check_slots)
+    {
+        slots = val_repeat_free_slots();
+        if ((slots < g_repeat_baseline_slots) && ((g_repeat_baseline_slots - slots) > leaked))
+        {
+            leaked = g_repeat_baseline_slots - slots;
+        }
+    }
+
+    if (leaked)
+    {
+        val_print(PRINT_ERROR, "\tKey store above baseline after iteration %d",
+                  g_repeat_stats.iterations);
+        val_print(PRINT_ERROR, ", %d key(s) leaked\n", leaked);
+        if (leaked > g_repeat_stats.leaked_keys)
+        {
+            g_repeat_stats.leaked_keys = leaked;
+        }
+    }
+}
+
+/**
+    @brief    - Returns the total duration of the iterations recorded so far
+    @param    - None
+    @return   - Duration in timer ticks
+**/
+uint64_t val_repeat_duration(void)
+{
+    return g_repeat_ticks;
+}
+
+/**
+    @brief    - Ends a repetition, printing and recording its summary
+    @param    - test_id : Repeated test ID, or last test ID of the repeated test list
+                state   : Test state of the last iteration
+    @return   - Overall test state, failed if any iteration failed or leaked keys.
+                The given state if no repetition is in progress.
+**/
+uint32_t val_repeat_end(test_id_t test_id, uint32_t state)
+{
+    if (!g_repeat_active)
+    {
+        return state;
+    }
+    g_repeat_active = 0;
+
+    if (g_repeat_stats.failed || g_repeat_stats.leaked_keys)
+    {
+        state = TEST_FAIL;
+    }
+
+    if (g_repeat_stats.iterations)
+    {
+        g_repeat_stats.median_us = val_histogram_percentile(&g_repeat_histogram, 50);
+        g_repeat_stats.p99_us = val_histogram_percentile(&g_repeat_histogram, 99);
+    }
+
+    val_print(PRINT_ALWAYS, "\nREPEAT          : %d iterations\n", g_repeat_stats.iterations);
+    val_print(PRINT_ALWAYS, "FAILED          : %d\n", g_repeat_stats.failed);
+    val_print(PRINT_ALWAYS, "LEAKED KEYS     : %d\n", g_repeat_stats.leaked_keys);
+    if (pal_timer_get_freq() != 0)
+    {
+        val_print(PRINT_ALWAYS, "LATENCY MIN     : %d us\n", g_repeat_stats.min_us);
+        val_print(PRINT_ALWAYS, "LATENCY MEDIAN  : %d us\n", g_repeat_stats.median_us);
+        val_print(PRINT_ALWAYS, "LATENCY P99     : %d us\n", g_repeat_stats.p99_us);
+        val_print(PRINT_ALWAYS, "LATENCY MAX     : %d us\n", g_repeat_stats.max_us);
+    }
+
+    val_results_repeat(test_id, g_repeat.scope, state, &g_repeat_stats);
+    return state;
+}
@@ -0,0 +1,49 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _VAL_REPEAT_H_
+#define _VAL_REPEAT_H_
+
+#include "val.h"
+#include "pal_interfaces_ns.h"
+
+/* Test repetition (soak mode). The dispatcher runs each test, or the whole test
+ * list, for the iterations and/or duration given by pal_get_test_repeat, and
+ * this module collects the latency distribution of the iterations and checks
+ * that the key store returns to its baseline after each of them.
+ */
+
+/* Summary of a repetition */
+typedef struct {
+    uint32_t iterations;   /* Number of iterations */
+    uint32_t failed;       /* Number of iterations which did not pass */
+    uint32_t leaked_keys;  /* Largest number of keys left above the baseline */
+    uint32_t min_us;       /* Latency distribution of the iterations, in micro */
+    uint32_t median_us;    /* seconds. Median and p99 are histogram estimates */
+    uint32_t p99_us;       /* within 1/32 of the value. All zero if the */
+    uint32_t max_us;       /* platform has no timer. */
+} val_repeat_stats_t;
+
+/* prototypes */
+void     val_repeat_init(void);
+bool_t   val_repeat_enabled(uint32_t scope);
+void     val_repeat_begin(void);
+bool_t   val_repeat_more(void);
+void     val_repeat_record(uint32_t state, uint64_t ticks);
+uint64_t val_repeat_duration(void);
+uint32_t val_repeat_end(test_id_t test_id, uint32_t state);
+#endif /* _VAL_REPEAT_H_ */
@@ -0,0 +1,763 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_results.h"
+#include "val_dispatcher.h"
+#include "val_peripherals.h"
+#include "pal_interfaces_ns.h"
+
+/* Records are built in a single buffer and handed over to the platform one at a
+ * time, so the memory cost does not depend on the number of tests. A record
+ * longer than the buffer, e.g. with long algorithm names, is handed over in
+ * several parts, so it is never cut.
+ *
+ * JSON Lines records (one object per line):
+ *   {"type":"check","suite":"Crypto Suite","test_id":201,"test":"test_c001",
+ *    "check":1,"state":"PASSED","status":0,"duration_us":12}
+ *   {"type":"test","suite":"Crypto Suite","test_id":201,"test":"test_c001",
+ *    "state":"PASSED","status":0,"duration_us":40}
+ *   {"type":"summary","suite":"Crypto Suite","total":1,"passed":1,"failed":0,
+ *    "skipped":0,"sim_error":0}
+ *   {"type":"shard","suite":"Crypto Suite","test_id":201,"test":"test_c001",
+ *    "shard":1,"shards":4}
+ *   {"type":"repeat","suite":"Crypto Suite","scope":"test","test_id":201,
+ *    "test":"test_c001","state":"PASSED","iterations":100,"failed":0,
+ *    "leaked_keys":0,"min_us":35,"median_us":40,"p99_us":61,"max_us":75}
+ *   {"type":"bench","suite":"Crypto Benchmark Suite","test_id":801,"test":"test_b001",
+ *    "op":"hash_compute","alg":"0x2000009","alg_name":"SHA_256","key_bits":0,
+ *    "size":1024,"iterations":4096,"duration_us":10250,"mb_per_s":409.21,
+ *    "cycles_per_byte":7.33,"ns_per_op":2502}
+ *   {"type":"bench","suite":"Crypto Benchmark Suite","test_id":805,"test":"test_b005",
+ *    "op":"hash_update","alg":"0x2000009","alg_name":"SHA_256","key_bits":0,
+ *    "size":65536,"iterations":64,"duration_us":106000,"mb_per_s":39.56,
+ *    "cycles_per_byte":75.83,"ns_per_op":1656250,"chunk":16,"chunk_overhead_ns":365}
+ *   {"type":"bench","suite":"Crypto Benchmark Suite","test_id":810,"test":"test_b010",
+ *    "op":"verify_hash","alg":"0x6000609","alg_name":"ECDSA(SHA_256)","key_bits":256,
+ *    "size":32,"iterations":1220,"duration_us":100040,"mb_per_s":0.39,
+ *    "cycles_per_byte":7687.50,"ns_per_op":82000,"ops_per_s":12195.12,"min_us":79,
+ *    "median_us":81,"p99_us":97,"max_us":143}
+ *   {"type":"bench","suite":"Crypto Benchmark Suite","test_id":817,"test":"test_b017",
+ *    "op":"import_key","alg":"0x0","alg_name":"16 bytes AES","variant":"persistent",
+ *    "key_bits":128,"size":16,"iterations":812,"duration_us":100120,"mb_per_s":0.12,
+ *    "cycles_per_byte":24658.12,"ns_per_op":123300,"ops_per_s":8110.26,"min_us":109,
+ *    "median_us":121,"p99_us":187,"max_us":402}
+ *   {"type":"bench","suite":"Crypto Benchmark Suite","test_id":832,"test":"test_b032",
+ *    "op":"hash_update","alg":"0x2000009","alg_name":"SHA_256","key_bits":0,
+ *    "size":65536,"stream_bytes":4294968323,"iterations":65537,"duration_us":2862000,
+ *    "mb_per_s":1500.69,"cycles_per_byte":1.60,"ns_per_op":43670}
+ *   {"type":"leakage","suite":"Crypto Benchmark Suite","test_id":826,"test":"test_b026",
+ *    "op":"mac_verify","alg":"0x3800009","alg_name":"HMAC SHA 256","variant":"first byte",
+ *    "key_bits":160,"size":8,"measurements":1000000,"duration_us":2150000,"max_t":1.27,
+ *    "crop_percent":95,"leak":false}
+ *
+ * JUnit XML has no notion of test checks, so only the test records are emitted,
+ * as one <testcase> per test.
+ */
+
+#define VAL_RESULT_RECORD_SIZE    512
+
+typedef struct {
+    char     buf[VAL_RESULT_RECORD_SIZE];
+    uint32_t len;
+    bool_t   failed;    /* A part of the record could not be written */
+} val_result_record_t;
+
+static val_result_record_t g_result_record;
+
+/* Component letters used in test names, indexed by component number */
+static const char g_comp_letters[] = {'i', 'c', 's', 'a', 'b'};
+
+static void val_record_reset(val_result_record_t *record)
+{
+    record->len = 0;
+    record->failed = 0;
+}
+
+/**
+    @brief    - Hands the part of the record built so far over to the platform
+                result sink, and empties the buffer
+    @param    - record : Record being built
+    @return   - None
+**/
+static void val_record_flush(val_result_record_t *record)
+{
+    if ((record->len != 0) && (pal_result_write(record->buf, record->len) != PAL_STATUS_SUCCESS))
+    {
+        record->failed = 1;
+    }
+    record->len = 0;
+}
+
+static void val_record_char(val_result_record_t *record, char c)
+{
+    if (record->len == VAL_RESULT_RECORD_SIZE)
+    {
+        val_record_flush(record);
+    }
+    record->buf[record->len++] = c;
+}
+
+static void val_record_str(val_result_record_t *record, const char *str)
+{
+    while (*str)
+    {
+        val_record_char(record, *str++);
+    }
+}
+
+/**
+    @brief    - Appends a string escaped for the current record format
+    @param    - record : Record being built
+                format : Record format
+                str    : String to append
+    @return   - None
+**/
+static void val_record_escaped(val_result_record_t *record, uint32_t format, const char *str)
+{
+    for (; *str; str++)
+    {
+        if (format == PAL_RESULT_FORMAT_JUNIT)
+        {
+            switch (*str)
+            {
+                case '<':  val_record_str(record, "&lt;");   break;
+                case '>':  val_record_str(record, "&gt;");   break;
+                case '&':  val_record_str(record, "&amp;");  break;
+                case '"':  val_record_str(record, "&quot;"); break;
+                default:   val_record_char(record, *str);    break;
+            }
+        }
+        else
+        {
+            if (*str == '"' || *str == '\\')
+            {
+                val_record_char(record, '\\');
+                val_record_char(record, *str);
+            }
+            else if ((unsigned char)*str >= 0x20)
+            {
+                val_record_char(record, *str);
+            }
+        }
+    }
+}
+
+/**
+    @brief    - Appends an unsigned decimal number
+    @param    - record : Record being built
+                value  : Number to append
+                width  : Minimum number of digits, zero padded
+    @return   - None
+**/
+static void val_record_uint(val_result_record_t *record, uint32_t value, uint32_t width)
+{
+    char     digits[10];
+    uint32_t count = 0;
+
+    do
+    {
+        digits[count++] = (char)('0' + (value % 10));
+        value /= 10;
+    } while (value && count < sizeof(digits));
+
+    while (width > count)
+    {
+        val_record_char(record, '0');
+        width--;
+    }
+
+    while (count)
+    {
+        val_record_char(record, digits[--count]);
+    }
+}
+
+/**
+    @brief    - Appends a 64 bit unsigned decimal number
+    @param    - record : Record being built
+                value  : Number to append
+    @return   - None
+**/
+static void val_record_uint64(val_result_record_t *record, uint64_t value)
+{
+    char     digits[20];
+    uint32_t count = 0;
+
+    do
+    {
+        digits[count++] = (char)('0' + (value % 10));
+        value /= 10;
+    } while (value && count < sizeof(digits));
+
+    while (count)
+    {
+        val_record_char(record, digits[--count]);
+    }
+}
+
+static void val_record_hex(val_result_record_t *record, uint32_t value)
+{
+    const char *hex = "0123456789abcdef";
+    int32_t     shift = 28;
+
+    val_record_str(record, "0x");
+    while (shift > 0 && ((value >> shift) & 0xF) == 0)
+    {
+        shift -= 4;
+    }
+
+    for (; shift >= 0; shift -= 4)
+    {
+        val_record_char(record, hex[(value >> shift) & 0xF]);
+    }
+}
+
+/**
+    @brief    - Appends a value given in hundredths as a JSON number with two decimals
+    @param    - record : Record being built
+                value  : Value in 1/100, VAL_BENCH_UNKNOWN appends null
+    @return   - None
+**/
+static void val_record_x100(val_result_record_t *record, uint32_t value)
+{
+    if (value == VAL_BENCH_UNKNOWN)
+    {
+        val_record_str(record, "null");
+        return;
+    }
+
+    val_record_uint(record, value / 100, 0);
+    val_record_char(record, '.');
+    val_record_uint(record, value % 100, 2);
+}
+
+/**
+    @brief    - Appends the test name, e.g. test_c001
+    @param    - record  : Record being built
+                test_id : Test ID
+    @return   - None
+**/
+static void val_record_test_name(val_result_record_t *record, test_id_t test_id)
+{
+    uint32_t comp = VAL_GET_COMP_NUM(test_id);
+
+    val_record_str(record, "test_");
+    if (comp < sizeof(g_comp_letters))
+    {
+        val_record_char(record, g_comp_letters[comp]);
+        val_record_uint(record, VAL_GET_TEST_NUM(test_id), 3);
+    }
+    else
+    {
+        val_record_uint(record, test_id, 0);
+    }
+}
+
+/**
+    @brief    - Appends the JSON fields common to all records
+    @param    - record  : Record being built
+                type    : Record type
+                test_id : Test ID, used for the suite name
+    @return   - None
+**/
+static void val_record_json_header(val_result_record_t *record, const char *type,
+                                   test_id_t test_id)
+{
+    val_record_str(record, "{\"type\":\"");
+    val_record_str(record, type);
+    val_record_str(record, "\",\"suite\":\"");
+    val_record_escaped(record, PAL_RESULT_FORMAT_JSONL, val_get_comp_name(test_id));
+    val_record_str(record, "\"");
+}
+
+static void val_record_json_test(val_result_record_t *record, test_id_t test_id)
+{
+    val_record_str(record, ",\"test_id\":");
+    val_record_uint(record, test_id, 0);
+    val_record_str(record, ",\"test\":\"");
+    val_record_test_name(record, test_id);
+    val_record_str(record, "\"");
+}
+
+static void val_record_json_duration(val_result_record_t *record, uint64_t ticks)
+{
+    val_record_str(record, ",\"duration_us\":");
+    if (ticks == 0 || pal_timer_get_freq() == 0)
+    {
+        val_record_str(record, "null");
+    }
+    else
+    {
+        val_record_uint(record, val_timer_ticks_to_us(ticks), 0);
+    }
+}
+
+static const char *val_result_state_name(uint32_t state)
+{
+    switch (state)
+    {
+        case TEST_PASS:
+            return "PASSED";
+        case TEST_SKIP:
+            return "SKIPPED";
+        case TEST_PENDING:
+            return "SIM ERROR";
+        default:
+            return "FAILED";
+    }
+}
+
+/**
+    @brief    - Hands the record over to the platform result sink
+    @param    - record : Record to be written
+    @return   - None
+**/
+static void val_record_write(val_result_record_t *record)
+{
+    val_record_char(record, '\n');
+    val_record_flush(record);
+    if (record->failed)
+    {
+        val_print(PRINT_WARN, "\tResult record write failed\n", 0);
+    }
+}
+
+/**
+    @brief    - Starts the records of a test suite. The previous test ID rather
+                than a local state tells if a suite is being closed, so that a
+                run resumed after a reset continues the records of the run
+                it was reset from.
+    @param    - test_id      : First test ID of the suite
+                test_id_prev : Last test ID of the previous suite, VAL_INVALID_TEST_ID
+                               for the first suite
+    @return   - None
+**/
+void val_results_suite_begin(test_id_t test_id, test_id_t test_id_prev)
+{
+    val_result_record_t *record = &g_result_record;
+
+    if (pal_result_get_format() != PAL_RESULT_FORMAT_JUNIT)
+    {
+        return;
+    }
+
+    val_record_reset(record);
+    if (test_id_prev != VAL_INVALID_TEST_ID)
+    {
+        val_record_str(record, "</testsuite>\n");
+    }
+    else
+    {
+        val_record_str(record, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<testsuites>\n");
+    }
+    val_record_str(record, "<testsuite name=\"");
+    val_record_escaped(record, PAL_RESULT_FORMAT_JUNIT, val_get_comp_name(test_id));
+    val_record_str(record, "\">");
+    val_record_write(record);
+}
+
+/**
+    @brief    - Records a test of the test shard executed by the platform
+    @param    - test_id     : Test ID
+                shard       : Shard number, from 1
+                shard_count : Number of shards
+    @return   - None
+**/
+void val_results_shard(test_id_t test_id, uint32_t shard, uint32_t shard_count)
+{
+    val_result_record_t *record = &g_result_record;
+
+    if (pal_result_get_format() != PAL_RESULT_FORMAT_JSONL)
+    {
+        return;
+    }
+
+    val_record_reset(record);
+    val_record_json_header(record, "shard", test_id);
+    val_record_json_test(record, test_id);
+    val_record_str(record, ",\"shard\":");
+    val_record_uint(record, shard, 0);
+    val_record_str(record, ",\"shards\":");
+    val_record_uint(record, shard_count, 0);
+    val_record_str(record, "}");
+    val_record_write(record);
+}
+
+/**
+    @brief    - Records the result of a test check
+    @param    - test_id : Test ID
+                check   : Check number in the test
+                status  : Status returned by the check
+                ticks   : Check duration in timer ticks
+    @return   - None
+**/
+void val_results_check(test_id_t test_id, uint32_t check, val_status_t status, uint64_t ticks)
+{
+    val_result_record_t *record = &g_result_record;
+    uint32_t             state;
+
+    if (pal_result_get_format() != PAL_RESULT_FORMAT_JSONL)
+    {
+        return;
+    }
+
+    if (IS_TEST_SKIP(status))
+    {
+        state = TEST_SKIP;
+    }
+    else
+    {
+        state = VAL_ERROR(status) ? TEST_FAIL : TEST_PASS;
+    }
+
+    val_record_reset(record);
+    val_record_json_header(record, "check", test_id);
+    val_record_json_test(record, test_id);
+    val_record_str(record, ",\"check\":");
+    val_record_uint(record, check, 0);
+    val_record_str(record, ",\"state\":\"");
+    val_record_str(record, val_result_state_name(state));
+    val_record_str(record, "\",\"status\":");
+    val_record_uint(record, status & TEST_STATUS_MASK, 0);
+    val_record_json_duration(record, ticks);
+    val_record_str(record, "}");
+    val_record_write(record);
+}
+
+/**
+    @brief    - Records the result of a test
+    @param    - test_id : Test ID
+                state   : Test state returned by val_report_status
+                status  : Status code of the test
+                ticks   : Test duration in timer ticks
+    @return   - None
+**/
+void val_results_test(test_id_t test_id, uint32_t state, uint32_t status, uint64_t ticks)
+{
+    val_result_record_t *record = &g_result_record;
+    uint32_t             format = pal_result_get_format();
+    uint32_t             us;
+
+    val_record_reset(record);
+    if (format == PAL_RESULT_FORMAT_JSONL)
+    {
+        val_record_json_header(record, "test", test_id);
+        val_record_json_test(record, test_id);
+        val_record_str(record, ",\"state\":\"");
+        val_record_str(record, val_result_state_name(state));
+        val_record_str(record, "\",\"status\":");
+        val_record_uint(record, status, 0);
+        val_record_json_duration(record, ticks);
+        val_record_str(record, "}");
+    }
+    else if (format == PAL_RESULT_FORMAT_JUNIT)
+    {
+        us = val_timer_ticks_to_us(ticks);
+
+        val_record_str(record, "<testcase classname=\"");
+        val_record_escaped(record, format, val_get_comp_name(test_id));
+        val_record_str(record, "\" name=\"");
+        val_record_test_name(record, test_id);
+        val_record_str(record, "\" id=\"");
+        val_record_uint(record, test_id, 0);
+        val_record_str(record, "\" time=\"");
+        val_record_uint(record, us / 1000000, 0);
+        val_record_char(record, '.');
+        val_record_uint(record, us % 1000000, 6);
+        val_record_str(record, "\"");
+
+        if (state == TEST_PASS)
+        {
+            val_record_str(record, "/>");
+        }
+        else
+        {
+            val_record_str(record, ">");
+            if (state == TEST_SKIP)
+            {
+                val_record_str(record, "<skipped message=\"Skip Code=");
+            }
+            else if (state == TEST_PENDING)
+            {
+                val_record_str(record, "<error message=\"SIM ERROR, Error Code=");
+            }
+            else
+            {
+                val_record_str(record, "<failure message=\"Error Code=");
+            }
+            val_record_hex(record, status);
+            val_record_str(record, "\"/></testcase>");
+        }
+    }
+    else
+    {
+        return;
+    }
+
+    val_record_write(record);
+}
+
+/**
+    @brief    - Records the summary of a test repetition
+    @param    - test_id : Repeated test ID, or last test ID of the repeated test list
+                scope   : pal_test_repeat_scope_t
+                state   : Overall test state of the repetition
+                stats   : Repetition summary
+    @return   - None
+**/
+void val_results_repeat(test_id_t test_id, uint32_t scope, uint32_t state,
+                        const val_repeat_stats_t *stats)
+{
+    val_result_record_t *record = &g_result_record;
+    const char          *names[] = {"min_us", "median_us", "p99_us", "max_us"};
+    uint32_t             values[] = {stats->min_us, stats->median_us,
+                                     stats->p99_us, stats->max_us};
+    uint32_t             i;
+
+    if (pal_result_get_format() != PAL_RESULT_FORMAT_JSONL)
+    {
+        return;
+    }
+
+    val_record_reset(record);
+    val_record_json_header(record, "repeat", test_id);
+    if (scope == PAL_TEST_REPEAT_LIST)
+    {
+        val_record_str(record, ",\"scope\":\"list\"");
+    }
+    else
+    {
+        val_record_str(record, ",\"scope\":\"test\"");
+        val_record_json_test(record, test_id);
+    }
+    val_record_str(record, ",\"state\":\"");
+    val_record_str(record, val_result_state_name(state));
+    val_record_str(record, "\",\"iterations\":");
+    val_record_uint(record, stats->iterations, 0);
+    val_record_str(record, ",\"failed\":");
+    val_record_uint(record, stats->failed, 0);
+    val_record_str(record, ",\"leaked_keys\":");
+    val_record_uint(record, stats->leaked_keys, 0);
+
+    for (i = 0; i < (sizeof(values) / sizeof(values[0])); i++)
+    {
+        val_record_str(record, ",\"");
+        val_record_str(record, names[i]);
+        val_record_str(record, "\":");
+        if (pal_timer_get_freq() == 0)
+        {
+            val_record_str(record, "null");
+        }
+        else
+        {
+            val_record_uint(record, values[i], 0);
+        }
+    }
+    val_record_str(record, "}");
+    val_record_write(record);
+}
+
+/**
+    @brief    - Ends the records of a test suite
+    @param    - test_id    : Last test ID of the suite
+                test_count : Suite test counters
+    @return   - None
+**/
+void val_results_suite_end(test_id_t test_id, const test_count_t *test_count)
+{
+    val_result_record_t *record = &g_result_record;
+    uint32_t             format = pal_result_get_format();
+
+    val_record_reset(record);
+    if (format == PAL_RESULT_FORMAT_JSONL)
+    {
+        val_record_json_header(record, "summary", test_id);
+        val_record_str(record, ",\"total\":");
+        val_record_uint(record, test_count->pass_cnt + test_count->fail_cnt
+                        + test_count->skip_cnt + test_count->sim_error_cnt, 0);
+        val_record_str(record, ",\"passed\":");
+        val_record_uint(record, test_count->pass_cnt, 0);
+        val_record_str(record, ",\"failed\":");
+        val_record_uint(record, test_count->fail_cnt, 0);
+        val_record_str(record, ",\"skipped\":");
+        val_record_uint(record, test_count->skip_cnt, 0);
+        val_record_str(record, ",\"sim_error\":");
+        val_record_uint(record, test_count->sim_error_cnt, 0);
+        val_record_str(record, "}");
+    }
+    else if (format == PAL_RESULT_FORMAT_JUNIT)
+    {
+        /* No test was run, so no suite was started */
+        if (test_id == VAL_INVALID_TEST_ID)
+        {
+            val_results_suite_begin(test_id, VAL_INVALID_TEST_ID);
+            val_record_reset(record);
+        }
+        val_record_str(record, "</testsuite>\n</testsuites>");
+    }
+    else
+    {
+        return;
+    }
+
+    val_record_write(record);
+}
+
+/**
+    @brief    - Records a benchmark sample
+    @param    - test_id : Test ID
+                sample  : Measured sample, see val_bench_run
+    @return   - None
+**/
+void val_results_bench(test_id_t test_id, const val_bench_sample_t *sample)
+{
+    val_result_record_t *record = &g_result_record;
+
+    if (pal_result_get_format() != PAL_RESULT_FORMAT_JSONL)
+    {
+        return;
+    }
+
+    val_record_reset(record);
+    val_record_json_header(record, "bench", test_id);
+    val_record_json_test(record, test_id);
+    val_record_str(record, ",\"op\":\"");
+    val_record_escaped(record, PAL_RESULT_FORMAT_JSONL, sample->op);
+    val_record_str(record, "\",\"alg\":\"");
+    val_record_hex(record, sample->alg);
+    val_record_str(record, "\",\"alg_name\":\"");
+    val_record_escaped(record, PAL_RESULT_FORMAT_JSONL, sample->alg_name);
+    if (sample->variant != NULL)
+    {
+        val_record_str(record, "\",\"variant\":\"");
+        val_record_escaped(record, PAL_RESULT_FORMAT_JSONL, sample->variant);
+    }
+    val_record_str(record, "\",\"key_bits\":");
+    val_record_uint(record, sample->key_bits, 0);
+    val_record_str(record, ",\"size\":");
+    val_record_uint(record, sample->size, 0);
+    if (sample->stream_bytes != 0)
+    {
+        val_record_str(record, ",\"stream_bytes\":");
+        val_record_uint64(record, sample->stream_bytes);
+    }
+    val_record_str(record, ",\"iterations\":");
+    val_record_uint(record, sample->iterations, 0);
+    val_record_json_duration(record, sample->ticks);
+    val_record_str(record, ",\"mb_per_s\":");
+    val_record_x100(record, sample->mb_per_s_x100);
+    val_record_str(record, ",\"cycles_per_byte\":");
+    val_record_x100(record, sample->cycles_per_byte_x100);
+    val_record_str(record, ",\"ns_per_op\":");
+    if (sample->ns_per_op == VAL_BENCH_UNKNOWN)
+    {
+        val_record_str(record, "null");
+    }
+    else
+    {
+        val_record_uint(record, sample->ns_per_op, 0);
+    }
+    if (sample->latency)
+    {
+        val_record_str(record, ",\"ops_per_s\":");
+        val_record_x100(record, sample->ops_per_s_x100);
+        val_record_str(record, ",\"min_us\":");
+        val_record_uint(record, sample->min_us, 0);
+        val_record_str(record, ",\"median_us\":");
+        val_record_uint(record, sample->median_us, 0);
+        val_record_str(record, ",\"p99_us\":");
+        val_record_uint(record, sample->p99_us, 0);
+        val_record_str(record, ",\"max_us\":");
+        val_record_uint(record, sample->max_us, 0);
+    }
+    if (sample->load != 0)
+    {
+        val_record_str(record, ",\"load\":");
+        val_record_uint(record, sample->load, 0);
+    }
+    if (sample->threads != 0)
+    {
+        val_record_str(record, ",\"threads\":");
+        val_record_uint(record, sample->threads, 0);
+    }
+    if (sample->chunk != 0)
+    {
+        val_record_str(record, ",\"chunk\":");
+        val_record_uint(record, sample->chunk, 0);
+        val_record_str(record, ",\"chunk_overhead_ns\":");
+        if (sample->chunk_overhead_ns == VAL_BENCH_NO_OVERHEAD)
+        {
+            val_record_str(record, "null");
+        }
+        else
+        {
+            if (sample->chunk_overhead_ns < 0)
+            {
+                val_record_char(record, '-');
+            }
+            val_record_uint(record, (sample->chunk_overhead_ns < 0)
+                                    ? (uint32_t)(-sample->chunk_overhead_ns)
+                                    : (uint32_t)sample->chunk_overhead_ns, 0);
+        }
+    }
+    val_record_str(record, "}");
+    val_record_write(record);
+}
+
+/**
+    @brief    - Records a timing leakage sample
+    @param    - test_id : Test ID
+                sample  : Measured sample, see val_leakage_run
+    @return   - None
+**/
+void val_results_leakage(test_id_t test_id, const val_leakage_sample_t *sample)
+{
+    val_result_record_t *record = &g_result_record;
+
+    if (pal_result_get_format() != PAL_RESULT_FORMAT_JSONL)
+    {
+        return;
+    }
+
+    val_record_reset(record);
+    val_record_json_header(record, "leakage", test_id);
+    val_record_json_test(record, test_id);
+    val_record_str(record, ",\"op\":\"");
+    val_record_escaped(record, PAL_RESULT_FORMAT_JSONL, sample->op);
+    val_record_str(record, "\",\"alg\":\"");
+    val_record_hex(record, sample->alg);
+    val_record_str(record, "\",\"alg_name\":\"");
+    val_record_escaped(record, PAL_RESULT_FORMAT_JSONL, sample->alg_name);
+    if (sample->variant != NULL)
+    {
+        val_record_str(record, "\",\"variant\":\"");
+        val_record_escaped(record, PAL_RESULT_FORMAT_JSONL, sample->variant);
+    }
+    val_record_str(record, "\",\"key_bits\":");
+    val_record_uint(record, sample->key_bits, 0);
+    val_record_str(record, ",\"size\":");
+    val_record_uint(record, sample->size, 0);
+    val_record_str(record, ",\"measurements\":");
+    val_record_uint(record, sample->measurements, 0);
+    val_record_json_duration(record, sample->ticks);
+    val_record_str(record, ",\"max_t\":");
+    val_record_x100(record, sample->t_x100);
+    val_record_str(record, ",\"crop_percent\":");
+    val_record_uint(record, sample->crop_percent, 0);
+    val_record_str(record, sample->leak ? ",\"leak\":true}" : ",\"leak\":false}");
+    val_record_write(record);
+}
@@ -0,0 +1,41 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _VAL_RESULTS_H_
+#define _VAL_RESULTS_H_
+
+#include "val.h"
+#include "val_repeat.h"
+#include "val_bench.h"
+#include "val_leakage.h"
+
+/* Machine readable result records, streamed to the platform result sink
+ * (pal_result_write) in the format selected by the platform as the run
+ * progresses. A duration of zero ticks means the duration is not known.
+ */
+
+/* prototypes */
+void val_results_suite_begin(test_id_t test_id, test_id_t test_id_prev);
+void val_results_shard(test_id_t test_id, uint32_t shard, uint32_t shard_count);
+void val_results_check(test_id_t test_id, uint32_t check, val_status_t status, uint64_t ticks);
+void val_results_test(test_id_t test_id, uint32_t state, uint32_t status, uint64_t ticks);
+void val_results_repeat(test_id_t test_id, uint32_t scope, uint32_t state,
+                        const val_repeat_stats_t *stats);
+void val_results_bench(test_id_t test_id, const val_bench_sample_t *sample);
+void val_results_leakage(test_id_t test_id, const val_leakage_sample_t *sample);
+void val_results_suite_end(test_id_t test_id, const test_count_t *test_count);
+#endif /* _VAL_RESULTS_H_ */
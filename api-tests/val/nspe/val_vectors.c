@@ -0,0 +1,165 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_vectors.h"
+#include "val_peripherals.h"
+#include "pal_interfaces_ns.h"
+
+/**
+    @brief    - Reads a little-endian 16-bit value
+    @param    - data : Value bytes
+    @return   - Value
+**/
+static uint32_t val_vectors_u16(const uint8_t *data)
+{
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8);
+}
+
+/**
+    @brief    - Reads a little-endian 32-bit value
+    @param    - data : Value bytes
+    @return   - Value
+**/
+static uint32_t val_vectors_u32(const uint8_t *data)
+{
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8) |
+           ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+/**
+    @brief    - Opens the test vector corpus of the platform and checks its
+                header
+    @param    - corpus : Corpus position, set to the first record
+    @return   - VAL_STATUS_SUCCESS, VAL_STATUS_NOT_FOUND if the platform has
+                no corpus, VAL_STATUS_LOAD_ERROR if its header is not valid
+**/
+val_status_t val_vectors_open(val_vectors_t *corpus)
+{
+    const uint8_t *data = NULL;
+    uint32_t       size = 0;
+    uint32_t       header_size;
+
+    memset(corpus, 0, sizeof(*corpus));
+
+    if ((pal_vectors_get(&data, &size) != PAL_STATUS_SUCCESS) || (data == NULL))
+    {
+        return VAL_STATUS_NOT_FOUND;
+    }
+
+    if ((size < VAL_VECTORS_HEADER_SIZE) || (val_vectors_u32(data) != VAL_VECTORS_MAGIC))
+    {
+        val_print(PRINT_ERROR, "\tNot a test vector corpus\n", 0);
+        return VAL_STATUS_LOAD_ERROR;
+    }
+
+    if (val_vectors_u16(data + 4) != VAL_VECTORS_VERSION)
+    {
+        val_print(PRINT_ERROR, "\tUnsupported test vector corpus version %d\n",
+                  (int32_t)val_vectors_u16(data + 4));
+        return VAL_STATUS_LOAD_ERROR;
+    }
+
+    header_size = val_vectors_u16(data + 6);
+    if ((header_size < VAL_VECTORS_HEADER_SIZE) || (header_size > size))
+    {
+        val_print(PRINT_ERROR, "\tCorrupted test vector corpus header\n", 0);
+        return VAL_STATUS_LOAD_ERROR;
+    }
+
+    corpus->data = data;
+    corpus->size = size;
+    corpus->offset = header_size;
+    corpus->count = val_vectors_u32(data + 8);
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Reads the next record of a corpus, in place
+    @param    - corpus : Corpus position, moved to the following record
+                vector : Vector, its fields point into the corpus
+    @return   - VAL_STATUS_SUCCESS, VAL_STATUS_NOT_FOUND after the last
+                record, VAL_STATUS_LOAD_ERROR if the record is corrupted
+**/
+val_status_t val_vectors_next(val_vectors_t *corpus, val_vector_t *vector)
+{
+    val_vector_field_t *fields[VAL_VECTOR_FIELDS];
+    const uint8_t      *record;
+    uint32_t            record_size, offset, length, i;
+
+    if (corpus->index >= corpus->count)
+    {
+        return VAL_STATUS_NOT_FOUND;
+    }
+
+    record = corpus->data + corpus->offset;
+    if ((corpus->size - corpus->offset) < VAL_VECTOR_HEADER_SIZE)
+    {
+        val_print(PRINT_ERROR, "\tTruncated test vector record %d\n", (int32_t)corpus->index);
+        return VAL_STATUS_LOAD_ERROR;
+    }
+
+    record_size = val_vectors_u32(record);
+    if ((record_size < VAL_VECTOR_HEADER_SIZE) || ((record_size & 3) != 0) ||
+        (record_size > (corpus->size - corpus->offset)))
+    {
+        val_print(PRINT_ERROR, "\tCorrupted test vector record %d\n", (int32_t)corpus->index);
+        return VAL_STATUS_LOAD_ERROR;
+    }
+
+    vector->kind = val_vectors_u16(record + 4);
+    vector->flags = val_vectors_u16(record + 6);
+    vector->id = val_vectors_u32(record + 8);
+    vector->alg = val_vectors_u32(record + 12);
+    vector->key_type = val_vectors_u32(record + 16);
+
+    fields[0] = &vector->key;
+    fields[1] = &vector->iv;
+    fields[2] = &vector->aad;
+    fields[3] = &vector->input;
+    fields[4] = &vector->output;
+
+    offset = VAL_VECTOR_HEADER_SIZE;
+    for (i = 0; i < VAL_VECTOR_FIELDS; i++)
+    {
+        if ((record_size - offset) < 4)
+        {
+            val_print(PRINT_ERROR, "\tCorrupted test vector record %d\n",
+                      (int32_t)corpus->index);
+            return VAL_STATUS_LOAD_ERROR;
+        }
+        length = val_vectors_u32(record + offset);
+        offset += 4;
+
+        if (length > (record_size - offset))
+        {
+            val_print(PRINT_ERROR, "\tCorrupted test vector record %d\n",
+                      (int32_t)corpus->index);
+            return VAL_STATUS_LOAD_ERROR;
+        }
+        fields[i]->data = record + offset;
+        fields[i]->size = length;
+        offset += (length + 3) & ~3u;
+        if (offset > record_size)
+        {
+            offset = record_size;
+        }
+    }
+
+    corpus->offset += record_size;
+    corpus->index++;
+    return VAL_STATUS_SUCCESS;
+}
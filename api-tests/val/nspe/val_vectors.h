@@ -0,0 +1,92 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _VAL_VECTORS_H_
+#define _VAL_VECTORS_H_
+
+#include "val.h"
+
+/* External crypto test vector corpus. The corpus is a packed binary file,
+ * converted offline from Wycheproof or NIST CAVP files by
+ * tools/scripts/pack_vectors.py, which the platform maps in memory
+ * (pal_vectors_get). Its records are walked in place: the fields of a vector
+ * point into the corpus, nothing is copied. All integers are little-endian.
+ *
+ * Header, VAL_VECTORS_HEADER_SIZE bytes:
+ *   uint32 magic (VAL_VECTORS_MAGIC), uint16 version, uint16 header size,
+ *   uint32 record count, uint32 reserved
+ * Record, a multiple of 4 bytes:
+ *   uint32 record size, header and fields included
+ *   uint16 kind (val_vector_kind_t), uint16 flags (VAL_VECTOR_INVALID)
+ *   uint32 identifier of the vector in its source file
+ *   uint32 PSA algorithm, uint32 PSA key type
+ *   VAL_VECTOR_FIELDS fields, each a uint32 length then the data padded to
+ *   4 bytes: key, iv or nonce, additional data, input, output
+ */
+#define VAL_VECTORS_MAGIC           0x56415350  /* "PSAV" */
+#define VAL_VECTORS_VERSION         1
+#define VAL_VECTORS_HEADER_SIZE     16
+#define VAL_VECTOR_HEADER_SIZE      20
+#define VAL_VECTOR_FIELDS           5
+
+/* Operation checked by a vector */
+typedef enum {
+    VAL_VECTOR_HASH   = 1,  /* output = hash of input */
+    VAL_VECTOR_MAC    = 2,  /* output = MAC of input with key */
+    VAL_VECTOR_CIPHER = 3,  /* output = input encrypted with key and iv */
+    VAL_VECTOR_AEAD   = 4,  /* output = input encrypted with key, nonce and aad,
+                               followed by the tag */
+    VAL_VECTOR_SIGN   = 5,  /* output = signature of the input message with the
+                               key pair, checked by verification if randomized */
+    VAL_VECTOR_VERIFY = 6,  /* output = signature of the input message, to be
+                               verified with the public key */
+} val_vector_kind_t;
+
+/* The operation is expected to fail, e.g. a tampered tag or signature */
+#define VAL_VECTOR_INVALID          0x1
+
+typedef struct {
+    const uint8_t *data;
+    uint32_t       size;
+} val_vector_field_t;
+
+typedef struct {
+    uint32_t           kind;      /* val_vector_kind_t */
+    uint32_t           flags;
+    uint32_t           id;        /* Identifier in the source file, e.g. tcId */
+    uint32_t           alg;       /* PSA algorithm */
+    uint32_t           key_type;  /* PSA key type, 0 for hash vectors */
+    val_vector_field_t key;
+    val_vector_field_t iv;
+    val_vector_field_t aad;
+    val_vector_field_t input;
+    val_vector_field_t output;
+} val_vector_t;
+
+/* Position in a corpus */
+typedef struct {
+    const uint8_t *data;
+    uint32_t       size;
+    uint32_t       offset;    /* Offset of the next record */
+    uint32_t       count;     /* Number of records */
+    uint32_t       index;     /* Index of the next record */
+} val_vectors_t;
+
+/* prototypes */
+val_status_t val_vectors_open(val_vectors_t *corpus);
+val_status_t val_vectors_next(val_vectors_t *corpus, val_vector_t *vector);
+#endif /* _VAL_VECTORS_H_ */
@@ -21,9 +21,14 @@ list(APPEND VAL_SRC_C_NSPE
 	${PSA_ROOT_DIR}/val/nspe/val_entry.c
 	${PSA_ROOT_DIR}/val/nspe/val_dispatcher.c
 	${PSA_ROOT_DIR}/val/nspe/val_framework.c
-	${PSA_ROOT_DIR}/val/nspe/val_crypto.c
 	${PSA_ROOT_DIR}/val/nspe/val_interfaces.c
 	${PSA_ROOT_DIR}/val/nspe/val_peripherals.c
+	${PSA_ROOT_DIR}/val/nspe/val_results.c
+	${PSA_ROOT_DIR}/val/nspe/val_histogram.c
+	${PSA_ROOT_DIR}/val/nspe/val_repeat.c
+	${PSA_ROOT_DIR}/val/nspe/val_bench.c
+	${PSA_ROOT_DIR}/val/nspe/val_leakage.c
+	${PSA_ROOT_DIR}/val/nspe/val_vectors.c
 	${PSA_ROOT_DIR}/val/common/val_target.c
 	${PSA_ROOT_DIR}/val/nspe/val_attestation.c
 	${PSA_ROOT_DIR}/val/nspe/val_storage.c
@@ -58,4 +63,7 @@ target_include_directories(${PSA_TARGET_VAL_NSPE_LIB} PRIVATE
 if(${WATCHDOG_AVAILABLE} EQUAL 1)
 	target_compile_definitions(${PSA_TARGET_VAL_NSPE_LIB} PRIVATE WATCHDOG_AVAILABLE)
 endif()
+if(${TEST_TIMING} EQUAL 1)
+	target_compile_definitions(${PSA_TARGET_VAL_NSPE_LIB} PRIVATE TEST_TIMING)
+endif()
 target_compile_definitions(${PSA_TARGET_VAL_NSPE_LIB} PRIVATE VAL_NSPE_BUILD)